@@ -0,0 +1,11 @@
+
+AC_DEFUN([SST_ENABLE_MEM_ACCOUNTING], [
+
+  AC_ARG_ENABLE([mem-accounting],
+    [AS_HELP_STRING([--enable-mem-accounting],
+      [Enables accounting of core memory by subsystem.  Replaces the global operator new and delete, which adds a header to every allocation and slows allocation down.])])
+
+  AS_IF([test "x$enable_mem_accounting" = "xyes" ],
+	[AC_DEFINE([__SST_ENABLE_MEM_ACCOUNTING__], [1], [Defines if core should account memory by subsystem.])])
+
+])
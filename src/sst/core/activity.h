@@ -21,7 +21,9 @@
 #include "sst/core/output.h"
 #include "sst/core/mempool.h"
 
+#include <map>
 #include <unordered_map>
+#include <vector>
 #include <cinttypes>
 #include <cstring>
 
@@ -302,6 +304,19 @@ public:
         }
     }
 
+    /** Per event size: bytes held by the pools, entries in use, and
+     * the pools' high-water marks of entries in use, summed over the
+     * threads */
+    static void getMemPoolSizeClasses(std::map<uint64_t, std::vector<uint64_t>>& classes) {
+        for ( auto && entry : Activity::memPools ) {
+            std::vector<uint64_t>& counts = classes[entry.size];
+            counts.resize(3);
+            counts[0] += entry.pool->getBytesMemUsed();
+            counts[1] += entry.pool->getUndeletedEntries();
+            counts[2] += entry.pool->getPeakEntries();
+        }
+    }
+
     static void printUndeletedActivities(const std::string& header, Output &out, SimTime_t before = MAX_SIMTIME_T) {
         for ( auto && entry : Activity::memPools ) {
             const std::list<uint8_t*>& arenas = entry.pool->getArenas();
@@ -356,6 +371,9 @@ protected:
 #endif
 
 private:
+    /* Writes and restores the fields below in its compact wire format */
+    friend class SyncQueue;
+
     uint64_t  queue_order;
     SimTime_t delivery_time;
     int       priority;
@@ -22,6 +22,9 @@
 #include "sst/core/factory.h"
 #include "sst/core/link.h"
 #include "sst/core/linkMap.h"
+#include "sst/core/linkTelemetry.h"
+#include "sst/core/memuse.h"
+#include "sst/core/runtimeProfile.h"
 #include "sst/core/simulation.h"
 #include "sst/core/timeConverter.h"
 #include "sst/core/timeLord.h"
@@ -57,28 +60,27 @@ BaseComponent::~BaseComponent()
     if ( isExtension ) return;
 
     // Start by deleting children
-    std::map<ComponentId_t,ComponentInfo>& subcomps = my_info->getSubComponents();
-    for ( auto &ci : subcomps ) {
+    ComponentInfo::subComponentList_t& subcomps = my_info->getSubComponents();
+    for ( auto ci : subcomps ) {
         // Delete the subcomponent
 
         // Remove the parent info from the child so that it won't try
-        // to delete itself out of the map.  We'll clear the map
+        // to delete itself out of the list.  We'll clear the list
         // after deleting everything.
-        ci.second.parent_info = nullptr;
-        delete ci.second.component;
-        ci.second.component = nullptr;
+        ci->parent_info = nullptr;
+        delete ci->component;
+        ci->component = nullptr;
     }
-    // Now clear the map.  This will delete all the ComponentInfo
+    // Now clear the list.  This will delete all the ComponentInfo
     // objects; since the component field was set to nullptr, it will
     // not try to delete the component again.
-    subcomps.clear();
+    my_info->clearSubComponents();
 
     // Now for the tricky part, I need to remove myself from my
     // parent's subcomponent map (if I have a parent).
     my_info->component = nullptr;
     if ( my_info->parent_info ) {
-        std::map<ComponentId_t,ComponentInfo>& parent_subcomps = my_info->parent_info->getSubComponents();
-        size_t deleted = parent_subcomps.erase(my_info->id);
+        size_t deleted = my_info->parent_info->deleteSubComponent(my_info->id);
         if ( deleted != 1 ) {
             // This can't be checked while we still have backward
             // compatibility to the old subcomponent API.  Making
@@ -97,7 +99,7 @@ void
 BaseComponent::setDefaultTimeBaseForLinks(TimeConverter* tc) {
     LinkMap* myLinks = my_info->getLinkMap();
     if (nullptr != myLinks) {
-        for ( std::pair<std::string,Link*> p : myLinks->getLinkMap() ) {
+        for ( auto p : *myLinks ) {
             // if ( nullptr == p.second->getDefaultTimeBase() ) {
             if ( nullptr == p.second->getDefaultTimeBase() && p.second->isConfigured() ) {
                 p.second->setDefaultTimeBase(tc);
@@ -117,6 +119,7 @@ BaseComponent::pushValidParams(Params& params, const std::string& type)
 
 TimeConverter* BaseComponent::registerClock( const std::string& freq, Clock::HandlerBase* handler, bool regAll) {
     TimeConverter* tc = getSimulation()->registerClock(freq, handler, CLOCKPRIORITY);
+    profileClockHandler(handler);
 
     // if regAll is true set tc as the default for the component and
     // for all the links
@@ -129,6 +132,7 @@ TimeConverter* BaseComponent::registerClock( const std::string& freq, Clock::Han
 
 TimeConverter* BaseComponent::registerClock( const UnitAlgebra& freq, Clock::HandlerBase* handler, bool regAll) {
     TimeConverter* tc = getSimulation()->registerClock(freq, handler, CLOCKPRIORITY);
+    profileClockHandler(handler);
 
     // if regAll is true set tc as the default for the component and
     // for all the links
@@ -141,6 +145,7 @@ TimeConverter* BaseComponent::registerClock( const UnitAlgebra& freq, Clock::Han
 
 TimeConverter* BaseComponent::registerClock( TimeConverter* tc, Clock::HandlerBase* handler, bool regAll) {
     TimeConverter* tcRet = getSimulation()->registerClock(tc, handler, CLOCKPRIORITY);
+    profileClockHandler(handler);
 
     // if regAll is true set tc as the default for the component and
     // for all the links
@@ -151,6 +156,13 @@ TimeConverter* BaseComponent::registerClock( TimeConverter* tc, Clock::HandlerBa
     return tcRet;
 }
 
+void BaseComponent::profileClockHandler( Clock::HandlerBase* handler ) {
+    Core::Profile::RuntimeProfile* profile = getSimulation()->getRuntimeProfile();
+    if ( nullptr != profile ) profile->registerClockHandler(handler, my_info->getName());
+    Core::Profile::LinkTelemetry* telemetry = getSimulation()->getLinkTelemetry();
+    if ( nullptr != telemetry ) telemetry->registerClockHandler(handler, my_info->getName());
+}
+
 Cycle_t BaseComponent::reregisterClock( TimeConverter* freq, Clock::HandlerBase* handler) {
     return getSimulation()->reregisterClock(freq, handler, CLOCKPRIORITY);
 }
@@ -171,6 +183,14 @@ TimeConverter* BaseComponent::registerOneShot( const UnitAlgebra& timeDelay, One
     return getSimulation()->registerOneShot(timeDelay, handler, ONESHOTPRIORITY);
 }
 
+OneShot::Handle BaseComponent::registerCancelableOneShot( const UnitAlgebra& timeDelay, OneShot::HandlerBase* handler) {
+    return getSimulation()->registerCancelableOneShot(timeDelay, handler, ONESHOTPRIORITY);
+}
+
+bool BaseComponent::cancelOneShot( OneShot::Handle& handle) {
+    return handle.cancel();
+}
+
 TimeConverter* BaseComponent::registerTimeBase( const std::string& base, bool regAll) {
     TimeConverter* tc = getSimulation()->getTimeLord()->getTimeConverter(base);
 
@@ -283,8 +303,7 @@ BaseComponent::configureLink(const std::string& name, TimeConverter* time_base,
             // link map
             if ( nullptr != tmp ) {
                 if ( nullptr == myLinks ) {
-                    myLinks = new LinkMap();
-                    my_info->link_map = myLinks;
+                    myLinks = my_info->getLinkMap();
                 }
                 myLinks->insertLink(name,tmp);
                 // Need to set the link's defaultTimeBase to nullptr
@@ -300,6 +319,14 @@ BaseComponent::configureLink(const std::string& name, TimeConverter* time_base,
         if ( handler == nullptr ) {
             tmp->setPolling();
         }
+        else {
+            if ( nullptr != getSimulation()->getRuntimeProfile() ) {
+                handler = getSimulation()->getRuntimeProfile()->wrapEventHandler(handler, my_info->getName());
+            }
+            if ( nullptr != getSimulation()->getLinkTelemetry() ) {
+                handler = getSimulation()->getLinkTelemetry()->wrapEventHandler(handler, my_info->getName());
+            }
+        }
         tmp->setFunctor(handler);
         if ( nullptr != time_base ) tmp->setDefaultTimeBase(time_base);
         else tmp->setDefaultTimeBase(my_info->defaultTimeBase);
@@ -540,6 +567,7 @@ StatisticBase*
 BaseComponent::registerStatisticCore(SST::Params& params, const std::string& statName, const std::string& statSubId,
                                      fieldType_t fieldType, CreateFxn&& create)
 {
+    Core::MemAccounting::Scope mem_scope(Core::MemAccounting::STATISTICS);
     SST::Params statParams = params.find_prefix_params(statName);
     std::string                     fullStatName;
     bool                            statGood = true;
@@ -239,6 +239,22 @@ protected:
     TimeConverter* registerOneShot( const std::string& timeDelay, OneShot::HandlerBase* handler) __attribute__ ((deprecated("registerOneShot is deprecated and will be removed in  SST 11. Please use configureSelfLink to create a mechanism for waking up Component/SubComponents")));
     TimeConverter* registerOneShot( const UnitAlgebra& timeDelay, OneShot::HandlerBase* handler) __attribute__ ((deprecated("registerOneShot is deprecated and will be removed in  SST 11. Please use configureSelfLink to create a mechanism for waking up Component/SubComponents")));
 
+    /** Registers a OneShot event for this component that can be
+        canceled, for example a retransmit timer or a watchdog.
+        @param timeDelay Time delay for the OneShot in SI units
+        @param handler Pointer to OneShot::HandlerBase which is to be invoked
+        after the delay
+        @return handle to pass to cancelOneShot()
+    */
+    OneShot::Handle registerCancelableOneShot( const UnitAlgebra& timeDelay, OneShot::HandlerBase* handler);
+
+    /** Cancels a OneShot registered with registerCancelableOneShot().
+        The handler is not deleted.
+        @param handle Handle returned by registerCancelableOneShot()
+        @return true if the call was still pending
+    */
+    bool cancelOneShot( OneShot::Handle& handle);
+
     /** Registers a default time base for the component and optionally
         sets the the component's links to that timebase. Useful for
         components which do not have a clock, but would like a default
@@ -418,13 +434,12 @@ protected:
     bool isUserSubComponentLoadableUsingAPI(const std::string& slot_name) {
         // Get list of ComponentInfo objects and make sure that there is
         // only one SubComponent put into this slot
-        // const std::vector<ComponentInfo>& subcomps = my_info->getSubComponents();
-        const std::map<ComponentId_t,ComponentInfo>& subcomps = my_info->getSubComponents();
+        const ComponentInfo::subComponentList_t& subcomps = my_info->getSubComponents();
         int sub_count = 0;
         int index = -1;
-        for ( auto &ci : subcomps ) {
-            if ( ci.second.getSlotName() == slot_name ) {
-                index = ci.second.getSlotNum();
+        for ( auto ci : subcomps ) {
+            if ( ci->getSlotName() == slot_name ) {
+                index = ci->getSlotNum();
                 sub_count++;
             }
         }
@@ -507,13 +522,12 @@ protected:
 
         // Get list of ComponentInfo objects and make sure that there is
         // only one SubComponent put into this slot
-        // const std::vector<ComponentInfo>& subcomps = my_info->getSubComponents();
-        const std::map<ComponentId_t,ComponentInfo>& subcomps = my_info->getSubComponents();
+        const ComponentInfo::subComponentList_t& subcomps = my_info->getSubComponents();
         int sub_count = 0;
         int index = -1;
-        for ( auto &ci : subcomps ) {
-            if ( ci.second.getSlotName() == slot_name ) {
-                index = ci.second.getSlotNum();
+        for ( auto ci : subcomps ) {
+            if ( ci->getSlotName() == slot_name ) {
+                index = ci->getSlotNum();
                 sub_count++;
             }
         }
@@ -599,6 +613,13 @@ private:
         sub_info->share_flags = share_flags;
         sub_info->parent_info = my_info;
 
+        // Once the component is built, only the SubComponents that were
+        // not loaded yet keep their params (see releaseConfigGraph())
+        if ( sub_info->isUser() && sub_info->getParams() == nullptr ) {
+            fatal(CALL_INFO, 1, "Error: SubComponent in slot \"%s\" of component \"%s\" was already loaded during construction "
+                  "and cannot be loaded again.\n", slot_name.c_str(), my_info->getType().c_str());
+        }
+
         // Check to see if this is documented, and if so, try to load it through the ElementBuilder
         Params myParams;
         if ( sub_info->getParams() != nullptr ) {
@@ -685,6 +706,7 @@ private:
 
     void addSelfLink(const std::string& name);
     Link* getLinkFromParentSharedPort(const std::string& port);
+    void profileClockHandler(Clock::HandlerBase* handler);
 
     using CreateFxn = std::function<StatisticBase*(const std::string&,
                             BaseComponent*,const std::string&, const std::string&, SST::Params&)>;
@@ -716,14 +738,14 @@ public:
         comp(comp),
         slot_name(slot_name)
     {
-        const std::map<ComponentId_t,ComponentInfo>& subcomps = comp->my_info->getSubComponents();
+        const ComponentInfo::subComponentList_t& subcomps = comp->my_info->getSubComponents();
 
         // Look for all subcomponents with the right slot name
         max_slot_index = -1;
-        for ( auto &ci : subcomps ) {
-            if ( ci.second.getSlotName() == slot_name ) {
-                if ( ci.second.getSlotNum() > static_cast<int>(max_slot_index) ) {
-                    max_slot_index = ci.second.getSlotNum();
+        for ( auto ci : subcomps ) {
+            if ( ci->getSlotName() == slot_name ) {
+                if ( ci->getSlotNum() > static_cast<int>(max_slot_index) ) {
+                    max_slot_index = ci->getSlotNum();
                 }
             }
         }
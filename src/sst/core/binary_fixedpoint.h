@@ -0,0 +1,839 @@
+// -*- c++ -*-
+
+// Copyright 2009-2020 NTESS. Under the terms
+// of Contract DE-NA0003525 with NTESS, the U.S.
+// Government retains certain rights in this software.
+//
+// Copyright (c) 2009-2020, NTESS
+// All rights reserved.
+//
+// This file is part of the SST software package. For license
+// information, see the LICENSE file in the top level directory of the
+// distribution.
+
+#ifndef SST_CORE_BINARY_FIXEDPOINT_H
+#define SST_CORE_BINARY_FIXEDPOINT_H
+
+#include <cmath>
+#include <cstdint>
+#include <cstdlib>
+#include <stdexcept>
+#include <string>
+#include <type_traits>
+
+#include "sst/core/decimal_fixedpoint.h"
+
+namespace SST {
+/**
+   Class that implements a decimal fixed-point number with binary
+   storage.
+
+   Holds the same values as decimal_fixedpoint<whole_words,
+   fraction_words> (the number is an integer count of
+   10^-(8*fraction_words)), but the count is kept as a binary integer
+   in 64-bit words instead of radix 10^8 digits.  Adds and compares are
+   plain multi-word integer operations, multiplies use the native
+   64x64->128 bit multiply, and divides are exact long division rather
+   than a Newton iteration.
+
+   Parsing and printing are exact, so values round-trip through
+   toString() the same as with decimal_fixedpoint, and toString()
+   prints exactly what decimal_fixedpoint would for the same value.
+   Comparisons, rounding and truncation also follow decimal_fixedpoint.
+
+   @tparam whole_words Number of 8 decimal digit words to the left of
+   the decimal point.
+
+   @tparam fraction_words Number of 8 decimal digit words to the right
+   of the decimal point.
+*/
+template <int whole_words, int fraction_words>
+class binary_fixedpoint {
+
+    __extension__ typedef unsigned __int128 uint128_t;
+
+public:
+    static constexpr int32_t digits_per_word = 8;
+
+    /**
+       Get the value of whole_words template parameter.
+     */
+    constexpr int getWholeWords() const {
+        return whole_words;
+    }
+
+    /**
+       Get the value of fraction_words template parameter.
+     */
+    constexpr int getFractionWords() const {
+        return fraction_words;
+    }
+
+private:
+
+    static constexpr int fraction_digits = fraction_words * digits_per_word;
+    static constexpr int total_digits = (whole_words + fraction_words) * digits_per_word;
+    // Enough 64-bit words to hold 10^total_digits (log2(10) < 3.322)
+    static constexpr int num_limbs = (total_digits * 3322 / 1000 + 64) / 64;
+    // Words needed to hold 10^fraction_digits
+    static constexpr int scale_limbs = (fraction_digits * 3322 / 1000 + 64) / 64;
+    // Scratch space for products and dividends
+    static constexpr int max_limbs = 2 * num_limbs + 1;
+
+    /**
+       The value times 10^fraction_digits, least significant word
+       first.
+    */
+    uint64_t data[num_limbs];
+
+    /**
+       Represents if the number is negative or not.
+     */
+    bool negative;
+
+
+    static uint64_t pow10(int n) {
+        static const uint64_t table[20] = {
+            1ull, 10ull, 100ull, 1000ull, 10000ull, 100000ull, 1000000ull, 10000000ull,
+            100000000ull, 1000000000ull, 10000000000ull, 100000000000ull, 1000000000000ull,
+            10000000000000ull, 100000000000000ull, 1000000000000000ull, 10000000000000000ull,
+            100000000000000000ull, 1000000000000000000ull, 10000000000000000000ull
+        };
+        return table[n];
+    }
+
+    // Number of words up to and including the most significant
+    // non-zero one
+    static int length(const uint64_t* a, int n) {
+        while ( n > 0 && a[n-1] == 0 ) --n;
+        return n;
+    }
+
+    // a = a * m + add, returns the carry out of the top word
+    static uint64_t mul_small(uint64_t* a, int n, uint64_t m, uint64_t add = 0) {
+        uint64_t carry = add;
+        for ( int i = 0; i < n; ++i ) {
+            uint128_t p = static_cast<uint128_t>(a[i]) * m + carry;
+            a[i] = static_cast<uint64_t>(p);
+            carry = static_cast<uint64_t>(p >> 64);
+        }
+        return carry;
+    }
+
+    // a = a / d, returns the remainder
+    static uint64_t div_small(uint64_t* a, int n, uint64_t d) {
+        uint64_t rem = 0;
+        for ( int i = length(a, n) - 1; i >= 0; --i ) {
+            uint128_t num = (static_cast<uint128_t>(rem) << 64) | a[i];
+            a[i] = static_cast<uint64_t>(num / d);
+            rem = static_cast<uint64_t>(num % d);
+        }
+        return rem;
+    }
+
+    static uint64_t pow5(int n) {
+        static const uint64_t table[28] = {
+            1ull, 5ull, 25ull, 125ull, 625ull, 3125ull, 15625ull, 78125ull, 390625ull,
+            1953125ull, 9765625ull, 48828125ull, 244140625ull, 1220703125ull, 6103515625ull,
+            30517578125ull, 152587890625ull, 762939453125ull, 3814697265625ull,
+            19073486328125ull, 95367431640625ull, 476837158203125ull, 2384185791015625ull,
+            11920928955078125ull, 59604644775390625ull, 298023223876953125ull,
+            1490116119384765625ull, 7450580596923828125ull
+        };
+        return table[n];
+    }
+
+    // a = a << bits, 0 < bits < 64
+    static void shift_left(uint64_t* a, int n, int bits) {
+        for ( int i = n - 1; i > 0; --i ) {
+            a[i] = (a[i] << bits) | (a[i-1] >> (64 - bits));
+        }
+        a[0] <<= bits;
+    }
+
+    // a = a >> bits, 0 < bits < 64, returns the bits shifted out
+    static uint64_t shift_right(uint64_t* a, int n, int bits) {
+        uint64_t out = a[0] & ((1ull << bits) - 1);
+        for ( int i = 0; i < n - 1; ++i ) {
+            a[i] = (a[i] >> bits) | (a[i+1] << (64 - bits));
+        }
+        a[n-1] >>= bits;
+        return out;
+    }
+
+    // a = a * 10^digits
+    static void mul_pow10(uint64_t* a, int n, int digits) {
+        if ( digits > 0 && digits <= 27 ) {
+            // 10^digits = 5^digits * 2^digits, and 5^digits fits in a word
+            mul_small(a, n, pow5(digits));
+            shift_left(a, n, digits);
+            return;
+        }
+        for ( ; digits > 0; digits -= 19 ) {
+            mul_small(a, n, pow10(digits < 19 ? digits : 19));
+        }
+    }
+
+    // a = a / 10^digits, truncating.  Returns the remainder, which is
+    // only complete if 10^digits fits in 128 bits.
+    static uint128_t div_pow10(uint64_t* a, int n, int digits) {
+        if ( digits > 0 && digits <= 27 ) {
+            uint64_t low = shift_right(a, n, digits);
+            uint64_t rem = div_small(a, n, pow5(digits));
+            return (static_cast<uint128_t>(rem) << digits) | low;
+        }
+        uint128_t rem = 0;
+        uint128_t scale = 1;
+        for ( ; digits > 0; digits -= 19 ) {
+            int d = digits < 19 ? digits : 19;
+            rem += scale * div_small(a, n, pow10(d));
+            scale *= pow10(d);
+        }
+        return rem;
+    }
+
+    static int compare(const uint64_t* a, const uint64_t* b, int n) {
+        for ( int i = n - 1; i >= 0; --i ) {
+            if ( a[i] != b[i] ) return a[i] > b[i] ? 1 : -1;
+        }
+        return 0;
+    }
+
+    // a = a + b
+    static void add(uint64_t* a, const uint64_t* b, int n) {
+        uint64_t carry = 0;
+        for ( int i = 0; i < n; ++i ) {
+            uint128_t s = static_cast<uint128_t>(a[i]) + b[i] + carry;
+            a[i] = static_cast<uint64_t>(s);
+            carry = static_cast<uint64_t>(s >> 64);
+        }
+    }
+
+    // a = b - a, requires b >= a
+    static void reverse_sub(uint64_t* a, const uint64_t* b, int n) {
+        uint64_t borrow = 0;
+        for ( int i = 0; i < n; ++i ) {
+            uint64_t t = b[i] - a[i];
+            uint64_t next = (b[i] < a[i]) | (t < borrow);
+            a[i] = t - borrow;
+            borrow = next;
+        }
+    }
+
+    // a = a - b, requires a >= b
+    static void sub(uint64_t* a, const uint64_t* b, int n) {
+        uint64_t borrow = 0;
+        for ( int i = 0; i < n; ++i ) {
+            uint64_t t = a[i] - b[i];
+            uint64_t next = (a[i] < b[i]) | (t < borrow);
+            a[i] = t - borrow;
+            borrow = next;
+        }
+    }
+
+    /*
+      q = floor(u / v) (Knuth, TAOCP vol. 2, 4.3.1, algorithm D).  u
+      has m words, v has n words with v[n-1] != 0, and q gets m-n+1
+      words.  u is used as scratch space and must have room for m+1
+      words.
+    */
+    static void divide(uint64_t* u, int m, const uint64_t* v, int n, uint64_t* q) {
+        if ( n == 1 ) {
+            div_small(u, m, v[0]);
+            for ( int i = 0; i <= m - n; ++i ) q[i] = u[i];
+            return;
+        }
+
+        // Normalize so the top bit of the divisor is set
+        int s = __builtin_clzll(v[n-1]);
+        uint64_t vn[max_limbs];
+        for ( int i = n - 1; i > 0; --i ) {
+            vn[i] = s ? (v[i] << s) | (v[i-1] >> (64 - s)) : v[i];
+        }
+        vn[0] = v[0] << s;
+        u[m] = s ? u[m-1] >> (64 - s) : 0;
+        for ( int i = m - 1; i > 0; --i ) {
+            u[i] = s ? (u[i] << s) | (u[i-1] >> (64 - s)) : u[i];
+        }
+        u[0] = u[0] << s;
+
+        for ( int j = m - n; j >= 0; --j ) {
+            // Estimate the quotient word from the top two words
+            uint128_t num = (static_cast<uint128_t>(u[j+n]) << 64) | u[j+n-1];
+            uint128_t qhat = num / vn[n-1];
+            uint128_t rhat = num - qhat * vn[n-1];
+            while ( (qhat >> 64) != 0 ||
+                    qhat * vn[n-2] > ((rhat << 64) | u[j+n-2]) ) {
+                --qhat;
+                rhat += vn[n-1];
+                if ( (rhat >> 64) != 0 ) break;
+            }
+
+            // Multiply and subtract
+            uint64_t borrow = 0;
+            uint64_t carry = 0;
+            for ( int i = 0; i < n; ++i ) {
+                uint128_t p = qhat * vn[i] + carry;
+                carry = static_cast<uint64_t>(p >> 64);
+                uint64_t lo = static_cast<uint64_t>(p);
+                uint64_t t = u[i+j] - lo;
+                uint64_t next = (u[i+j] < lo) | (t < borrow);
+                u[i+j] = t - borrow;
+                borrow = next;
+            }
+            uint64_t t = u[j+n] - carry;
+            bool under = (u[j+n] < carry) | (t < borrow);
+            u[j+n] = t - borrow;
+
+            q[j] = static_cast<uint64_t>(qhat);
+            if ( under ) {
+                // The estimate was one too large; add back
+                --q[j];
+                uint64_t c = 0;
+                for ( int i = 0; i < n; ++i ) {
+                    uint128_t sum = static_cast<uint128_t>(u[i+j]) + vn[i] + c;
+                    u[i+j] = static_cast<uint64_t>(sum);
+                    c = static_cast<uint64_t>(sum >> 64);
+                }
+                u[j+n] += c;
+            }
+        }
+    }
+
+    void clear() {
+        negative = false;
+        for ( int i = 0; i < num_limbs; ++i ) {
+            data[i] = 0;
+        }
+    }
+
+    /**
+       initialize a binary_fixedpoint using a string initializer
+
+       @param init Initialization string.  The format is similar to
+       the c++ double precision strings.  For example 1.234, -1.234,
+       0.234, 1.234e14, 1.234e14, etc.
+     */
+    void from_string(const std::string& init) {
+        clear();
+        const char* str = init.c_str();
+        size_t len = init.length();
+        size_t pos = 0;
+
+        // Look for a negative sign
+        if ( len > 0 && str[0] == '-' ) {
+            negative = true;
+            pos = 1;
+        }
+
+        // See if we have an exponent
+        int32_t exponent = 0;
+        size_t exponent_pos = init.find_last_of("eE");
+        if ( exponent_pos != std::string::npos ) {
+            exponent = static_cast<int32_t>(SST::Core::from_string<double>(init.substr(exponent_pos+1)));
+            len = exponent_pos;
+        }
+
+        // Collect the digits as an integer, up to 19 at a time
+        uint64_t value[max_limbs + 1] = { 0 };
+        int fraction = 0;
+        bool seen_point = false;
+        uint64_t chunk = 0;
+        int chunk_digits = 0;
+        for ( ; pos < len; ++pos ) {
+            char c = str[pos];
+            if ( c == '.' && !seen_point ) {
+                seen_point = true;
+                continue;
+            }
+            if ( c < '0' || c > '9' ) {
+                throw std::invalid_argument("binary_fixedpoint: invalid number string");
+            }
+            if ( seen_point ) ++fraction;
+            chunk = chunk * 10 + (c - '0');
+            if ( ++chunk_digits == 19 ) {
+                mul_small(value, max_limbs, pow10(19), chunk);
+                chunk = 0;
+                chunk_digits = 0;
+            }
+        }
+        mul_small(value, max_limbs, pow10(chunk_digits), chunk);
+
+        // Scale to the fixed point
+        int shift = fraction_digits + exponent - fraction;
+        if ( shift > 0 ) mul_pow10(value, max_limbs, shift);
+        else div_pow10(value, max_limbs, -shift);
+
+        for ( int i = 0; i < num_limbs; ++i ) {
+            data[i] = value[i];
+        }
+    }
+
+    /**
+       Initialize a binary_fixedpoint using a 64-bit unsigned number.
+
+       @param init Initialization value.
+     */
+    void from_uint64(uint64_t init) {
+        clear();
+        data[0] = init;
+        mul_pow10(data, num_limbs, fraction_digits);
+    }
+
+    /**
+       Initialize a binary_fixedpoint using a double.
+
+       @param init Initialization value.
+     */
+    void from_double(double init) {
+        clear();
+        if ( init < 0 ) {
+            negative = true;
+            init = -init;
+        }
+        if ( init == 0 ) return;
+
+        // init = mantissa * 2^exponent exactly
+        int exponent;
+        double frac = std::frexp(init, &exponent);
+        uint64_t mantissa = static_cast<uint64_t>(std::ldexp(frac, 53));
+        exponent -= 53;
+
+        uint64_t value[max_limbs] = { mantissa };
+        mul_pow10(value, max_limbs, fraction_digits);
+        if ( exponent > 0 ) {
+            for ( ; exponent > 0; exponent -= 32 ) {
+                mul_small(value, max_limbs, 1ull << (exponent < 32 ? exponent : 32));
+            }
+        }
+        else {
+            for ( ; exponent < 0; exponent += 32 ) {
+                div_small(value, max_limbs, 1ull << (-exponent < 32 ? -exponent : 32));
+            }
+        }
+        for ( int i = 0; i < num_limbs; ++i ) {
+            data[i] = value[i];
+        }
+    }
+
+    // Returns the whole part and sets remainder to the fraction part,
+    // both as integers
+    uint64_t split(uint128_t& remainder) const {
+        uint64_t whole[num_limbs];
+        for ( int i = 0; i < num_limbs; ++i ) whole[i] = data[i];
+        remainder = div_pow10(whole, num_limbs, fraction_digits);
+        return whole[0];
+    }
+
+public:
+
+    /**
+       Default constructor.
+
+       Builds a binary_fixedpoint with the value 0;
+     */
+    binary_fixedpoint() {
+        clear();
+    }
+
+    /**
+       Build a binary_fixedpoint using a string initializer.
+
+       @param init Initialization string.  The format is similar to
+       the c++ double precision strings.  For example 1.234, -1.234,
+       0.234, 1.234e14, 1.234e14, etc.
+     */
+    binary_fixedpoint(const std::string& init) {
+        from_string(init);
+    }
+
+
+    /**
+       Build a binary_fixedpoint using a 64-bit unsigned number.
+
+       @param init Initialization value.
+     */
+    template <class T>
+    binary_fixedpoint(T init, typename std::enable_if<std::is_unsigned<T>::value >::type* = nullptr) {
+        from_uint64(init);
+    }
+
+
+    /**
+       Build a binary_fixedpoint using a 64-bit signed number.
+
+       @param init Initialization value.
+     */
+    template <class T>
+    binary_fixedpoint(T init, typename std::enable_if<std::is_signed<T>::value &&
+                      std::is_integral<T>::value >::type* = nullptr) {
+        if ( init < 0 ) {
+            from_uint64(-init);
+            negative = true;
+        }
+        else {
+            from_uint64(init);
+        }
+    }
+
+    /**
+       Build a binary_fixedpoint using a double.
+
+       @param init Initialization value.
+     */
+    template <class T>
+    binary_fixedpoint(const T init, typename std::enable_if<std::is_floating_point<T>::value >::type* = nullptr) {
+        from_double(init);
+    }
+
+    binary_fixedpoint(const binary_fixedpoint& init) = default;
+    binary_fixedpoint& operator=(const binary_fixedpoint& v) = default;
+
+    /**
+       Equal operator for 64-bit unsigned int.
+     */
+    binary_fixedpoint& operator=(uint64_t v) {
+        from_uint64(v);
+        return *this;
+    }
+
+    /**
+       Equal operator for 64-bit signed int.
+     */
+    binary_fixedpoint& operator=(int64_t v) {
+        if ( v < 0 ) {
+            from_uint64(-v);
+            negative = true;
+        }
+        else {
+            from_uint64(v);
+        }
+        return *this;
+    }
+
+    /**
+       Equal operator for double.
+     */
+    binary_fixedpoint& operator=(double v) {
+        from_double(v);
+        return *this;
+    }
+
+    /**
+       Equal operator for string.
+     */
+    binary_fixedpoint& operator=(const std::string& v) {
+        from_string(v);
+        return *this;
+    }
+
+
+    /**
+       Negate the value (change the sign bit).
+     */
+    void negate() {
+        negative = negative ^ 0x1;
+    }
+
+    /**
+       Return a double precision version of the binary_fixedpoint.
+       There is possible precision loss in this conversion.
+     */
+    double toDouble() const {
+        long double ret = 0;
+        for ( int i = num_limbs - 1; i >= 0; --i ) {
+            ret = ret * 18446744073709551616.0L + data[i];
+        }
+        for ( int digits = fraction_digits; digits > 0; digits -= 19 ) {
+            ret /= pow10(digits < 19 ? digits : 19);
+        }
+        return static_cast<double>(negative ? -ret : ret);
+    }
+
+    /**
+       Return a int64_t version of the binary_fixedpoint.  Rounds to
+       nearest, with ties to even.
+     */
+    int64_t toLong() const {
+        uint128_t remainder;
+        int64_t ret = static_cast<int64_t>(split(remainder));
+
+        uint128_t half = 5;
+        for ( int digits = fraction_digits - 1; digits > 0; digits -= 19 ) {
+            half *= pow10(digits < 19 ? digits : 19);
+        }
+        if ( remainder > half || ( remainder == half && ret % 2 == 1 ) ) ++ret;
+        if ( negative ) ret = -ret;
+        return ret;
+    }
+
+    /**
+       Return a uint64_t version of the binary_fixedpoint.  The
+       fraction is truncated.
+     */
+    uint64_t toUnsignedLong() const {
+        uint128_t remainder;
+        return split(remainder);
+    }
+
+    /**
+       Return true if value is zero, otherwise return false.
+     */
+    bool isZero() const {
+        for ( int i = num_limbs - 1; i >= 0; --i ) {
+            if ( data[i] != 0 ) return false;
+        }
+        return true;
+    }
+
+    /**
+       Templated conversion function for unsigned types.
+     */
+    template<typename T>
+    T convert_to(typename std::enable_if<std::is_unsigned<T>::value>::type* = 0) const {
+        return static_cast<T>(toUnsignedLong());
+    }
+
+    /**
+       Templated conversion function for signed integral types.
+     */
+    template<typename T>
+    T convert_to(typename std::enable_if<std::is_signed<T>::value &&
+                 std::is_integral<T>::value >::type* = 0)  const {
+        return static_cast<T>(toLong());
+    }
+
+    /**
+       Templated conversion function for floating point types.
+     */
+    template<typename T>
+    T convert_to(typename std::enable_if<std::is_floating_point<T>::value >::type* = 0) const {
+        return static_cast<T>(toDouble());
+    }
+
+    /**
+       Return the same value as a decimal_fixedpoint.
+     */
+    decimal_fixedpoint<whole_words,fraction_words> toDecimal() const {
+        decimal_fixedpoint<whole_words,fraction_words> ret;
+        uint64_t value[num_limbs];
+        for ( int i = 0; i < num_limbs; ++i ) value[i] = data[i];
+        for ( int i = 0; i < whole_words + fraction_words; ++i ) {
+            ret.data[i] = static_cast<uint32_t>(div_small(value, num_limbs, decimal_fixedpoint<whole_words,fraction_words>::storage_radix));
+        }
+        ret.negative = negative;
+        return ret;
+    }
+
+    /**
+       Create a string representation of this binary_fixedpoint.  The
+       output is identical to decimal_fixedpoint::toString().
+
+       @param precision Precision to use when printing number
+    */
+    std::string toString(int32_t precision = 6) const {
+        return toDecimal().toString(precision);
+    }
+
+    /**
+       Adds another number to this one and sets it equal to the
+       result.
+
+       @param v Number to add to this one
+    */
+    binary_fixedpoint& operator+= (const binary_fixedpoint& v) {
+        // Depending on the signs, this may be a subtract
+        if ( (negative ^ v.negative) == 0 ) {
+            add(data, v.data, num_limbs);
+        }
+        else if ( compare(data, v.data, num_limbs) >= 0 ) {
+            sub(data, v.data, num_limbs);
+        }
+        else {
+            reverse_sub(data, v.data, num_limbs);
+            // Since the other one is bigger, I take his sign
+            negative = v.negative;
+        }
+        return *this;
+    }
+
+    /**
+       Subtracts another number from this one and sets it equal to the
+       result.
+
+       @param v Number to subtract from this one
+     */
+    binary_fixedpoint& operator-= (const binary_fixedpoint& v) {
+        binary_fixedpoint ret(v);
+        ret.negate();
+        return operator+=(ret);
+    }
+
+    /**
+       Multiplies another number to this one and sets it equal to the
+       result.
+
+       @param v Number to multiply to this one
+     */
+    binary_fixedpoint& operator*= (const binary_fixedpoint& v) {
+        uint64_t prod[max_limbs] = { 0 };
+        int na = length(data, num_limbs);
+        int nb = length(v.data, num_limbs);
+        for ( int i = 0; i < na; ++i ) {
+            uint64_t carry = 0;
+            for ( int j = 0; j < nb; ++j ) {
+                uint128_t p = static_cast<uint128_t>(data[i]) * v.data[j] + prod[i+j] + carry;
+                prod[i+j] = static_cast<uint64_t>(p);
+                carry = static_cast<uint64_t>(p >> 64);
+            }
+            prod[i+nb] = carry;
+        }
+        div_pow10(prod, na + nb, fraction_digits);
+        for ( int i = 0; i < num_limbs; ++i ) {
+            data[i] = prod[i];
+        }
+        // Get the sign
+        negative = negative ^ v.negative;
+        return *this;
+    }
+
+    /**
+       Divides another number from this one and sets it equal to the
+       result.
+
+       @param v Number to divide from this one
+     */
+    binary_fixedpoint& operator/= (const binary_fixedpoint& v) {
+        int nv = length(v.data, num_limbs);
+        if ( nv == 0 ) {
+            throw std::domain_error("binary_fixedpoint: division by zero");
+        }
+
+        // (this * 10^fraction_digits) / v
+        uint64_t num[max_limbs + 1] = { 0 };
+        int nu = length(data, num_limbs);
+        for ( int i = 0; i < nu; ++i ) num[i] = data[i];
+        nu += scale_limbs;
+        mul_pow10(num, nu, fraction_digits);
+        nu = length(num, nu);
+
+        uint64_t quot[max_limbs] = { 0 };
+        if ( nu >= nv ) divide(num, nu, v.data, nv, quot);
+        for ( int i = 0; i < num_limbs; ++i ) {
+            data[i] = quot[i];
+        }
+        negative = negative ^ v.negative;
+        return *this;
+    }
+
+    /**
+       Inverts the number (1 divided by this number)
+     */
+    binary_fixedpoint& inverse() {
+        binary_fixedpoint one(1ul);
+        one /= *this;
+        *this = one;
+        return *this;
+    }
+
+    /**
+       Checks to see if two numbers are equal
+
+       @param v Number to check equality against
+     */
+    bool operator== (const binary_fixedpoint& v) const {
+        return compare(data, v.data, num_limbs) == 0;
+    }
+
+    /**
+       Checks to see if two numbers are not equal
+
+       @param v Number to check equality against
+     */
+    bool operator!= (const binary_fixedpoint& v) const {
+        return compare(data, v.data, num_limbs) != 0;
+    }
+
+    /**
+       Checks to see if this number is greater than another number
+
+       @param v Number to compare to
+     */
+    bool operator> (const binary_fixedpoint& v) const {
+        return compare(data, v.data, num_limbs) > 0;
+    }
+
+    /**
+       Checks to see if this number is greater than or equal to
+       another number
+
+       @param v Number to compare to
+     */
+    bool operator>= (const binary_fixedpoint& v) const {
+        return compare(data, v.data, num_limbs) >= 0;
+    }
+
+    /**
+       Checks to see if this number is less than another number
+
+       @param v Number to compare to
+     */
+    bool operator< (const binary_fixedpoint& v) const {
+        return compare(data, v.data, num_limbs) < 0;
+    }
+
+    /**
+       Checks to see if this number is less than or equal to another
+       number
+
+       @param v Number to compare to
+     */
+    bool operator<= (const binary_fixedpoint& v) const {
+        return compare(data, v.data, num_limbs) <= 0;
+    }
+
+};
+
+template <int whole_words, int fraction_words>
+binary_fixedpoint<whole_words,fraction_words> operator+(binary_fixedpoint<whole_words,fraction_words> lhs,
+                                                   binary_fixedpoint<whole_words,fraction_words> rhs) {
+    return lhs += rhs;
+}
+
+template <int whole_words, int fraction_words>
+binary_fixedpoint<whole_words,fraction_words> operator-(binary_fixedpoint<whole_words,fraction_words> lhs,
+                                                   binary_fixedpoint<whole_words,fraction_words> rhs) {
+    return lhs -= rhs;
+}
+
+template <int whole_words, int fraction_words>
+binary_fixedpoint<whole_words,fraction_words> operator*(binary_fixedpoint<whole_words,fraction_words> lhs,
+                                                   binary_fixedpoint<whole_words,fraction_words> rhs) {
+    return lhs *= rhs;
+}
+
+template <int whole_words, int fraction_words>
+binary_fixedpoint<whole_words,fraction_words> operator/(binary_fixedpoint<whole_words,fraction_words> lhs,
+                                                   binary_fixedpoint<whole_words,fraction_words> rhs) {
+    return lhs /= rhs;
+}
+
+template <int whole_words, int fraction_words, typename T>
+bool operator==(const T& lhs, const binary_fixedpoint<whole_words,fraction_words>& rhs) {
+    return rhs == binary_fixedpoint<whole_words,fraction_words>(lhs);
+}
+
+template <int whole_words, int fraction_words, typename T>
+bool operator!=(const T& lhs, const binary_fixedpoint<whole_words,fraction_words>& rhs) {
+    return rhs != binary_fixedpoint<whole_words,fraction_words>(lhs);
+}
+
+template <int whole_words, int fraction_words>
+std::ostream& operator <<(std::ostream& os, const binary_fixedpoint<whole_words,fraction_words>& rhs) {
+    os << rhs.toString(os.precision());
+    return os;
+}
+
+} // namespace SST
+
+#endif
@@ -71,12 +71,23 @@ const std::string& PythonConfigGraphOutput::getLinkObject(LinkId_t id) {
 
 void PythonConfigGraphOutput::generateCommonComponent( const char* objName, const ConfigComponent &comp)
 {
-    if ( !comp.params.empty() ) {
+    // Values that come from shared sets are written with the sets
+    Params localParams;
+    for ( auto & key : comp.params.getLocalKeys() ) {
+        localParams.insert(key, comp.params.find<std::string>(key));
+    }
+    if ( !localParams.empty() ) {
         fprintf(outputFile, "%s.addParams(", objName);
-        generateParams(comp.params);
+        generateParams(localParams);
         fprintf(outputFile, ")\n");
     }
 
+    for ( auto & set : comp.params.getSubscribedSharedParamSets() ) {
+        char* esSetName = makeEscapeSafe(set.c_str());
+        fprintf(outputFile, "%s.addSharedParamSet(\"%s\")\n", objName, esSetName);
+        free(esSetName);
+    }
+
     fprintf(outputFile, "%s.setCoordinates(", objName);
     bool first = true;
     for ( double d : comp.coords ) {
@@ -225,6 +236,25 @@ void PythonConfigGraphOutput::generate(const Config* cfg,
     fprintf(outputFile, "sst.setProgramOption(\"stopAtCycle\", \"%s\")\n\n",
         cfg->stopAtCycle.c_str());
 
+    // Output the shared parameter sets
+    std::vector<std::string> sharedSets = Params::getSharedParamSetNames();
+    if ( !sharedSets.empty() ) {
+        fprintf(outputFile, "# Define SST Shared Parameter Sets:\n");
+        for ( auto & set : sharedSets ) {
+            Params setParams;
+            for ( auto & kv : Params::getSharedParamSet(set) ) {
+                setParams.insert(kv.first, kv.second);
+            }
+            char* esSetName = makeEscapeSafe(set.c_str());
+            fprintf(outputFile, "sst.addSharedParams(\"%s\", ", esSetName);
+            if ( setParams.empty() ) fprintf(outputFile, "{}");
+            generateParams(setParams);
+            fprintf(outputFile, ")\n");
+            free(esSetName);
+        }
+        fprintf(outputFile, "\n");
+    }
+
     // Output the graph
     fprintf(outputFile, "# Define the SST Components:\n");
 
@@ -12,6 +12,7 @@
 #include "sst_config.h"
 #include "sst/core/clock.h"
 
+#include "sst/core/runtimeProfile.h"
 #include "sst/core/simulation.h"
 #include "sst/core/timeConverter.h"
 
@@ -21,7 +22,9 @@ Clock::Clock( TimeConverter* period, int priority ) :
     Action(),
     currentCycle( 0 ),
     period( period ),
-    scheduled( false )
+    scheduled( false ),
+    profileHandlers( false ),
+    profileCounter( nullptr )
 {
     setPriority(priority);
 }
@@ -72,6 +75,18 @@ Clock::getNextCycle()
 }
 
 void Clock::execute( void ) {
+    if ( UNLIKELY( profileHandlers ) ) {
+        Core::Profile::Scope tick(profileCounter);
+        executeHandlers<true>();
+        return;
+    }
+    executeHandlers<false>();
+}
+
+// When profile is set, each handler call is charged to the counters
+// registered for it in handlerCounters
+template <bool profile>
+void Clock::executeHandlers( void ) {
     Simulation *sim = Simulation::getSimulation();
 
     if ( staticHandlerMap.empty() ) {
@@ -87,16 +102,22 @@ void Clock::execute( void ) {
     StaticHandlerMap_t::iterator sop_iter;
     for ( sop_iter = staticHandlerMap.begin(); sop_iter != staticHandlerMap.end();  ) {
         Clock::HandlerBase* handler = *sop_iter;
-        if ( (*handler)(currentCycle) ) sop_iter = staticHandlerMap.erase(sop_iter);
+        bool done;
+        if ( profile ) {
+            uint64_t start = Core::Profile::getTicks();
+            done = (*handler)(currentCycle);
+            uint64_t ticks = Core::Profile::getTicks() - start;
+            for ( auto* counters : handlerCounters ) counters->charge(handler, ticks);
+        }
+        else {
+            done = (*handler)(currentCycle);
+        }
+        if ( done ) sop_iter = staticHandlerMap.erase(sop_iter);
         else ++sop_iter;
-        // (*handler)(currentCycle);
-        // ++sop_iter;
     }
 
     next = sim->getCurrentSimCycle() + period->getFactor();
     sim->insertActivity( next, this );
-
-    return;
 }
 
 void
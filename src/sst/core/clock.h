@@ -23,6 +23,12 @@
 namespace SST {
 
 class TimeConverter;
+namespace Core {
+namespace Profile {
+    struct Counter;
+    class ClockHandlerCounters;
+}
+}
 
 /**
  * A Clock class.
@@ -116,20 +122,37 @@ public:
 
     void print(const std::string& header, Output &out) const override;
 
+    /** Time each tick for the runtime profile */
+    void setProfileCounter(Core::Profile::Counter* counter) {
+        profileCounter = counter;
+        profileHandlers = true;
+    }
+
+    /** Time each handler and charge it to the counters registered
+     * for it in counters */
+    void addHandlerCounters(const Core::Profile::ClockHandlerCounters* counters) {
+        handlerCounters.push_back(counters);
+        profileHandlers = true;
+    }
+
 private:
 /*     typedef std::list<Clock::HandlerBase*> HandlerMap_t; */
     typedef std::vector<Clock::HandlerBase*> StaticHandlerMap_t;
 
 
-    Clock() { }
+    Clock() : profileHandlers(false), profileCounter(nullptr) { }
 
     void execute( void ) override;
+    template <bool profile> void executeHandlers( void );
 
     Cycle_t            currentCycle;
     TimeConverter*     period;
     StaticHandlerMap_t staticHandlerMap;
     SimTime_t          next;
     bool               scheduled;
+    bool               profileHandlers;
+    Core::Profile::Counter* profileCounter;
+    std::vector<const Core::Profile::ClockHandlerCounters*> handlerCounters;
 
 };
 
@@ -16,6 +16,9 @@
 #include "sst/core/componentInfo.h"
 #include "sst/core/configGraph.h"
 #include "sst/core/linkMap.h"
+#include "sst/core/simulation.h"
+
+#include <algorithm>
 
 namespace SST {
 
@@ -114,7 +117,7 @@ ComponentInfo::ComponentInfo(ConfigComponent *ccomp, const std::string& name, Co
             sub_name += std::to_string(sc.slot_num);
             sub_name += "]";
         }
-        subComponents.emplace_hint(subComponents.end(), std::piecewise_construct, std::make_tuple(sc.id), std::forward_as_tuple(&sc, sub_name, this, new LinkMap()));
+        insertSubComponent(new ComponentInfo(&sc, sub_name, this, createLinkMap(sc.type)));
     }
 }
 
@@ -127,6 +130,7 @@ ComponentInfo::ComponentInfo(ComponentInfo &&o) :
     component(o.component),
     subComponents(std::move(o.subComponents)),
     params(o.params),
+    ownedParams(std::move(o.ownedParams)),
     defaultTimeBase(o.defaultTimeBase),
     enabledStats(o.enabledStats),
     statLoadLevel(o.statLoadLevel),
@@ -149,15 +153,80 @@ ComponentInfo::~ComponentInfo() {
         component->my_info = nullptr;
         delete component;
     }
+    clearSubComponents();
+}
+
+LinkMap*
+ComponentInfo::createLinkMap(const std::string& type)
+{
+    return new LinkMap(Simulation::getSimulation()->getPortTable(type));
 }
 
 LinkMap*
 ComponentInfo::getLinkMap() {
-    if ( link_map == nullptr ) link_map = new LinkMap();
+    if ( link_map == nullptr ) link_map = createLinkMap(type);
     return link_map;
 }
 
 
+void
+ComponentInfo::insertSubComponent(ComponentInfo* info)
+{
+    // IDs are handed out in increasing order, so this is almost
+    // always an append
+    if ( subComponents.empty() || subComponents.back()->id < info->id ) {
+        subComponents.push_back(info);
+        return;
+    }
+    auto it = std::lower_bound(subComponents.begin(), subComponents.end(), info->id,
+                               [](const ComponentInfo* ci, ComponentId_t id) { return ci->id < id; });
+    subComponents.insert(it, info);
+}
+
+size_t
+ComponentInfo::deleteSubComponent(ComponentId_t id)
+{
+    auto it = std::lower_bound(subComponents.begin(), subComponents.end(), id,
+                               [](const ComponentInfo* ci, ComponentId_t id) { return ci->id < id; });
+    if ( it == subComponents.end() || (*it)->id != id ) return 0;
+    ComponentInfo* info = *it;
+    subComponents.erase(it);
+    delete info;
+    return 1;
+}
+
+void
+ComponentInfo::clearSubComponents()
+{
+    for ( ComponentInfo* info : subComponents ) {
+        delete info;
+    }
+    subComponents.clear();
+}
+
+
+void
+ComponentInfo::releaseConfigGraph()
+{
+    // Statistics are only registered during wire-up
+    static statEnableList_t emptyStatEnableList;
+    if ( enabledStats != nullptr ) enabledStats = &emptyStatEnableList;
+
+    // Only a SubComponent that is still in its slot can be loaded later
+    if ( params != nullptr && params != ownedParams.get() ) {
+        if ( component == nullptr && isUser() && parent_info != nullptr ) {
+            ownedParams.reset(new Params(*params));
+            params = ownedParams.get();
+        }
+        else {
+            params = nullptr;
+        }
+    }
+    for ( ComponentInfo* info : subComponents ) {
+        info->releaseConfigGraph();
+    }
+}
+
 ComponentId_t
 ComponentInfo::addAnonymousSubComponent(ComponentInfo* parent_info, const std::string& type, const std::string& slot_name,
                                         int slot_num, uint64_t share_flags)
@@ -172,7 +241,7 @@ ComponentInfo::addAnonymousSubComponent(ComponentInfo* parent_info, const std::s
 
     ComponentId_t cid = COMPDEFINED_SUBCOMPONENT_ID_CREATE(COMPONENT_ID_MASK(id), sub_id);
 
-    subComponents.emplace_hint(subComponents.end(), std::piecewise_construct, std::make_tuple(cid), std::forward_as_tuple(cid, parent_info, type, slot_name, slot_num, share_flags));
+    insertSubComponent(new ComponentInfo(cid, parent_info, type, slot_name, slot_num, share_flags));
 
     return cid;
 
@@ -181,23 +250,23 @@ ComponentInfo::addAnonymousSubComponent(ComponentInfo* parent_info, const std::s
 
 void ComponentInfo::finalizeLinkConfiguration() const {
     if ( nullptr != link_map ) {
-        for ( auto & i : link_map->getLinkMap() ) {
+        for ( auto i : *link_map ) {
             i.second->finalizeConfiguration();
         }
     }
-    for ( auto &s : subComponents ) {
-        s.second.finalizeLinkConfiguration();
+    for ( auto s : subComponents ) {
+        s->finalizeLinkConfiguration();
     }
 }
 
 void ComponentInfo::prepareForComplete() const {
     if ( nullptr != link_map ) {
-        for ( auto & i : link_map->getLinkMap() ) {
+        for ( auto i : *link_map ) {
             i.second->prepareForComplete();
         }
     }
-    for ( auto &s : subComponents ) {
-        s.second.prepareForComplete();
+    for ( auto s : subComponents ) {
+        s->prepareForComplete();
     }
 }
 
@@ -212,8 +281,14 @@ ComponentInfo* ComponentInfo::findSubComponent(ComponentId_t id)
     if ( COMPONENT_ID_MASK(id) != COMPONENT_ID_MASK(this->id) )
         return nullptr;
 
-    for ( auto &s : subComponents ) {
-        ComponentInfo* found = s.second.findSubComponent(id);
+    /* Direct children can be found with a binary search */
+    auto it = std::lower_bound(subComponents.begin(), subComponents.end(), id,
+                               [](const ComponentInfo* ci, ComponentId_t id) { return ci->id < id; });
+    if ( it != subComponents.end() && (*it)->id == id )
+        return *it;
+
+    for ( auto s : subComponents ) {
+        ComponentInfo* found = s->findSubComponent(id);
         if ( found != nullptr )
             return found;
     }
@@ -223,8 +298,8 @@ ComponentInfo* ComponentInfo::findSubComponent(ComponentId_t id)
 ComponentInfo* ComponentInfo::findSubComponent(const std::string& slot, int slot_num)
 {
     // Non-recursive, only look in current component
-    for ( auto &sc : subComponents ) {
-        if ( sc.second.slot_name == slot && sc.second.slot_num == slot_num ) return &sc.second;
+    for ( auto sc : subComponents ) {
+        if ( sc->slot_name == slot && sc->slot_num == slot_num ) return sc;
     }
     return nullptr;
 }
@@ -234,12 +309,12 @@ std::vector<LinkId_t> ComponentInfo::getAllLinkIds() const
 {
     std::vector<LinkId_t> res;
     if ( nullptr != link_map ) {
-        for ( auto & l : link_map->getLinkMap() ) {
+        for ( auto l : *link_map ) {
             res.push_back(l.second->id);
         }
     }
-    for ( auto& sc : subComponents ) {
-        std::vector<LinkId_t> s = sc.second.getAllLinkIds();
+    for ( auto sc : subComponents ) {
+        std::vector<LinkId_t> s = sc->getAllLinkIds();
         res.insert(res.end(), s.begin(), s.end());
     }
     return res;
@@ -15,10 +15,11 @@
 #include "sst/core/sst_types.h"
 #include "sst/core/params.h"
 
-#include <unordered_set>
-#include <map>
+#include <unordered_map>
+#include <vector>
 #include <string>
 #include <functional>
+#include <memory>
 
 namespace SST {
 
@@ -37,6 +38,7 @@ class ComponentInfo {
 
 public:
     typedef std::vector<Statistics::StatisticInfo>      statEnableList_t;        /*!< List of Enabled Statistics */
+    typedef std::vector<ComponentInfo*>                 subComponentList_t;      /*!< SubComponents, sorted by ID */
 
 
     // Share Flags for SubComponent loading
@@ -95,9 +97,11 @@ private:
     BaseComponent* component;
 
     /**
-       SubComponents loaded into the Component/SubComponent.
+       SubComponents loaded into the Component/SubComponent, owned by
+       this ComponentInfo and kept sorted by ID.  IDs are handed out
+       in increasing order, so entries are almost always appended.
      */
-    std::map<ComponentId_t,ComponentInfo> subComponents;
+    subComponentList_t subComponents;
 
     /**
        Parameters defined in the python file for the (Sub)Component.
@@ -109,6 +113,13 @@ private:
     */
     const Params *params;
 
+    /**
+       Copy of the params of a python defined SubComponent that had not
+       been loaded when releaseConfigGraph() was called, so that it can
+       still be loaded once the ConfigGraph is gone.
+     */
+    std::unique_ptr<Params> ownedParams;
+
     TimeConverter* defaultTimeBase;
 
     statEnableList_t * enabledStats;
@@ -166,6 +177,28 @@ private:
                                            const std::string& slot_name, int slot_num,
                                            uint64_t share_flags);
 
+    /** Takes ownership of info and adds it to the subcomponent list */
+    void insertSubComponent(ComponentInfo* info);
+
+    /** Deletes the direct subcomponent with the given ID.  Returns the
+        number of entries removed (0 or 1). */
+    size_t deleteSubComponent(ComponentId_t id);
+
+    /** Deletes all direct subcomponents */
+    void clearSubComponents();
+
+    /** Drops the pointers into the ConfigGraph, for this and all
+        subcomponents, so the graph can be freed.  Called once the
+        component is built.  Statistics can no longer be registered, so
+        the enabled statistics are dropped.  The params are dropped too,
+        except for python defined SubComponents that have not been
+        loaded yet, which keep a copy. */
+    void releaseConfigGraph();
+
+    /** Creates a LinkMap using the port table shared by all
+        components of the given type */
+    static LinkMap* createLinkMap(const std::string& type);
+
 
 public:
     /* Old ELI Style subcomponent constructor */
@@ -207,8 +240,7 @@ public:
 
     inline const Params* getParams() const { return params; }
 
-    // inline std::map<std::string, ComponentInfo>& getSubComponents() { return subComponents; }
-    inline std::map<ComponentId_t,ComponentInfo>& getSubComponents() { return subComponents; }
+    inline subComponentList_t& getSubComponents() { return subComponents; }
 
     ComponentInfo* findSubComponent(const std::string& slot, int slot_num);
     ComponentInfo* findSubComponent(ComponentId_t id);
@@ -249,34 +281,44 @@ public:
 
 class ComponentInfoMap {
 private:
-    std::unordered_set<ComponentInfo*, ComponentInfo::HashID, ComponentInfo::EqualsID> dataByID;
+    typedef std::unordered_map<ComponentId_t, ComponentInfo*> map_t;
+    map_t dataByID;
 
 public:
-    typedef std::unordered_set<ComponentInfo*, ComponentInfo::HashID, ComponentInfo::EqualsID>::const_iterator const_iterator;
+    /** Iterates over the ComponentInfo pointers, like a set */
+    class const_iterator {
+    public:
+        const_iterator(map_t::const_iterator it) : it(it) {}
+        ComponentInfo* const& operator*() const { return it->second; }
+        const_iterator& operator++() { ++it; return *this; }
+        bool operator==(const const_iterator& o) const { return it == o.it; }
+        bool operator!=(const const_iterator& o) const { return it != o.it; }
+    private:
+        map_t::const_iterator it;
+    };
 
     const_iterator begin() const {
-        return dataByID.begin();
+        return const_iterator(dataByID.begin());
     }
 
     const_iterator end() const {
-        return dataByID.end();
+        return const_iterator(dataByID.end());
     }
 
     ComponentInfoMap() {}
 
     void insert(ComponentInfo* info) {
-        dataByID.insert(info);
+        dataByID.emplace(info->getID(), info);
     }
 
     ComponentInfo* getByID(const ComponentId_t key) const {
-        ComponentInfo infoKey(COMPONENT_ID_MASK(key), "");
-        auto value = dataByID.find(&infoKey);
+        auto value = dataByID.find(COMPONENT_ID_MASK(key));
         if ( value == dataByID.end() ) return nullptr;
         if ( SUBCOMPONENT_ID_MASK(key) != 0 ) {
             // Looking for a subcomponent
-            return (*value)->findSubComponent(key);
+            return value->second->findSubComponent(key);
         }
-        return *value;
+        return value->second;
     }
 
     bool empty() {
@@ -285,7 +327,7 @@ public:
 
     void clear() {
         for ( auto i : dataByID ) {
-            delete i;
+            delete i.second;
         }
         dataByID.clear();
     }
@@ -57,6 +57,7 @@ Config::Config(RankInfo rankInfo)
     heartbeatPeriod = "N";
     partitioner = "sst.linear";
     timeVortex  = "sst.timevortex.priority_queue";
+    rank_sync   = "auto";
     dump_component_graph_file = "";
 
     char* wd_buf = (char*) malloc( sizeof(char) * PATH_MAX );
@@ -77,6 +78,11 @@ Config::Config(RankInfo rankInfo)
     output_core_prefix = "@x SST Core: ";
     print_timing = false;
     print_env = false;
+    enable_profiling = false;
+    profiling_output = "";
+    output_partition_weights = "";
+    partition_weights = "";
+    synthetic_model = "";
 
 #ifdef __SST_DEBUG_EVENT_TRACKING__
     event_dump_file = "";
@@ -120,6 +126,7 @@ static const struct sstLongOpts_s sstOptions[] = {
     DEF_FLAGOPT("no-env-config",            0,      "disable SST environment configuration", &Config::disableEnvConfig),
     DEF_FLAGOPT("print-timing-info",        0,      "print SST timing information", &Config::enablePrintTiming),
     DEF_FLAGOPT("print-env",                0,      "print SST environment vairable", &Config::enablePrintEnv),
+    DEF_FLAGOPT("enable-profiling",         0,      "report wall time and event counts per component, handler type, clock and sync", &Config::enableProfiling),
     /* HiddenNoConfigDesc */
     DEF_ARGOPT("sdl-file",          "FILE",         "SST Configuration file", &Config::setConfigFile),
     DEF_ARGOPT("stopAtCycle",       "TIME",         "set time at which simulation will end execution", &Config::setStopAt),
@@ -134,6 +141,7 @@ static const struct sstLongOpts_s sstOptions[] = {
     DEF_ARGOPT("timebase",          "TIMEBASE",     "sets the base time step of the simulation (default: 1ps)", &Config::setTimebase),
     DEF_ARGOPT("partitioner",       "PARTITIONER",  "select the partitioner to be used. <lib.partitionerName>", &Config::setPartitioner),
     DEF_ARGOPT("timeVortex ",       "MODULE",       "select TimeVortex implementation <lib.timevortex>", &Config::setTimeVortex),
+    DEF_ARGOPT("rank-sync",         "TYPE",         "select the rank sync: serial, parallel or segmented (default: serial with one thread per rank, parallel otherwise)", &Config::setRankSync),
     DEF_ARGOPT("output-directory",  "DIR",          "directory into which all SST output files should reside", &Config::setOutputDir),
     DEF_ARGOPT("output-config",     "FILE",         "file to write SST configuration (in Python format)", &Config::setWriteConfig),
     DEF_ARGOPT("output-dot",        "FILE",         "file to write SST configuration graph (in GraphViz format)", &Config::setWriteDot),
@@ -141,10 +149,14 @@ static const struct sstLongOpts_s sstOptions[] = {
     DEF_ARGOPT("output-json",       "FILE",         "file to write SST configuration graph (in JSON format)", &Config::setWriteJSON),
     DEF_ARGOPT("output-partition",  "FILE",         "file to write SST component partitioning information", &Config::setWritePartition),
     DEF_ARGOPT("output-prefix-core","STR",          "set the SST::Output prefix for the core", &Config::setOutputPrefix),
+    DEF_ARGOPT("output-profile",    "FILE",         "file to write the runtime profile to (implies --enable-profiling)", &Config::setProfilingOutput),
+    DEF_ARGOPT("output-partition-weights", "FILE",  "count events and bytes sent on each link and write them to FILE for use with --partition-weights", &Config::setWritePartitionWeights),
+    DEF_ARGOPT("partition-weights", "FILE",         "set link and component weights from a file written by --output-partition-weights before partitioning", &Config::setPartitionWeights),
 #ifdef USE_MEMPOOL
     DEF_ARGOPT("output-undeleted-events",   "FILE", "file to write information about all undeleted events at the end of simulation (STDOUT and STDERR can be used to output to console)", &Config::setWriteUndeleted),
 #endif
     DEF_ARGOPT("model-options",     "STR",          "provide options to the python configuration script", &Config::setModelOptions),
+    DEF_ARGOPT("synthetic-model",   "STR",          "build a synthetic graph natively instead of reading an sdl-file, e.g. \"components=1000000,degree=4,depth=1\"", &Config::setSyntheticModel),
     DEF_ARGOPT_SHORT("num_threads", 'n',   "NUM",   "number of parallel threads to use per rank", &Config::setNumThreads),
     {{nullptr, 0, nullptr, 0}, nullptr, nullptr, nullptr, nullptr}
 };
@@ -284,7 +296,7 @@ Config::parseCmdLine(int argc, char* argv[]) {
     /* Sanity check, and other duties */
     Output::setFileName( debugFile != "/dev/null" ? debugFile : "sst_output" );
 
-    if ( configFile == "NONE" ) {
+    if ( configFile == "NONE" && synthetic_model.empty() ) {
         cout << "ERROR: no sdl-file specified" << endl;
         cout << "  Usage: " << run_name << " sdl-file [options]" << endl;
         return -1;
@@ -453,12 +465,25 @@ bool Config::setTimeVortex(const std::string& arg) {
     return true;
 }
 
+bool Config::setRankSync(const std::string& arg) {
+    if ( arg == "auto" || arg == "serial" || arg == "parallel" || arg == "segmented" ) {
+        rank_sync = arg;
+        return true;
+    }
+    fprintf(stderr, "Unknown rank sync [%s]; expected serial, parallel or segmented\n", arg.c_str());
+    return false;
+}
+
 bool Config::setOutputDir(const std::string& arg) { output_directory = arg ;  return true; }
 bool Config::setWriteConfig(const std::string& arg) { output_config_graph = arg;  return true; }
 bool Config::setWriteDot(const std::string& arg) { output_dot = arg; return true; }
 bool Config::setWriteXML(const std::string& arg){ output_xml = arg; return true; }
 bool Config::setWriteJSON(const std::string& arg) { output_json = arg; return true; }
 bool Config::setWritePartition(const std::string& arg) { dump_component_graph_file = arg; return true; }
+bool Config::setProfilingOutput(const std::string& arg) { profiling_output = arg; enable_profiling = true; return true; }
+bool Config::setWritePartitionWeights(const std::string& arg) { output_partition_weights = arg; return true; }
+bool Config::setPartitionWeights(const std::string& arg) { partition_weights = arg; return true; }
+bool Config::setSyntheticModel(const std::string& arg) { synthetic_model = arg; return true; }
 bool Config::setOutputPrefix(const std::string& arg) { output_core_prefix = arg; return true; }
 #ifdef USE_MEMPOOL
 bool Config::setWriteUndeleted(const std::string& arg) { event_dump_file = arg; return true; }
@@ -49,6 +49,9 @@ public:
     /** Print the SST core timing information */
     bool printTimingInfo();
 
+    /** Collect and report the runtime profile */
+    bool profilingEnabled() const { return enable_profiling; }
+
     /** Print the current configuration to stdout */
     void Print();
 
@@ -61,14 +64,19 @@ public:
     std::string     timeBase;           /*!< Timebase of simulation */
     std::string     partitioner;        /*!< Partitioner to use */
     std::string     timeVortex;         /*!< TimeVortex implementation to use */
+    std::string     rank_sync;          /*!< Rank sync to use (auto, serial, parallel or segmented) */
     std::string     output_config_graph;  /*!< File to dump configuration graph */
     std::string     output_dot;         /*!< File to dump dot output */
     std::string     output_xml;         /*!< File to dump XML output */
     std::string     output_json;        /*!< File to dump JSON output */
     std::string     output_directory;   /*!< Output directory to dump all files to */
     std::string     model_options;      /*!< Options to pass to Python Model generator */
+    std::string     synthetic_model;    /*!< Options for the native synthetic graph generator */
     std::string     dump_component_graph_file; /*!< File to dump component graph */
     std::string     output_core_prefix;  /*!< Set the SST::Output prefix for the core */
+    std::string     profiling_output;   /*!< File to write the runtime profile to */
+    std::string     output_partition_weights; /*!< File to write per-link traffic telemetry to */
+    std::string     partition_weights;  /*!< Weights file from a previous run to apply before partitioning */
 
     RankInfo        world_size;         /*!< Number of ranks, threads which should be invoked per rank */
     uint32_t        verbose;            /*!< Verbosity */
@@ -76,6 +84,7 @@ public:
     bool            enable_sig_handling; /*!< Enable signal handling */
     bool            print_timing;       /*!< Print SST timing information */
     bool            print_env;          /*!< Print SST environment */
+    bool            enable_profiling;   /*!< Collect the runtime profile */
 
 #ifdef USE_MEMPOOL
     std::string     event_dump_file;    /*!< File to dump undeleted events to */
@@ -93,6 +102,7 @@ public:
     bool disableEnvConfig()     { no_env_config = true; return true;}
     bool enablePrintTiming()    { print_timing = true; return true;}
     bool enablePrintEnv()       { print_env = true; return true; }
+    bool enableProfiling()      { enable_profiling = true; return true; }
 
     bool setConfigFile(const std::string& arg);
     bool setDebugFile(const std::string& arg);
@@ -105,6 +115,7 @@ public:
     bool setTimebase(const std::string& arg);
     bool setPartitioner(const std::string& arg);
     bool setTimeVortex(const std::string& arg);
+    bool setRankSync(const std::string& arg);
     bool setOutputDir(const std::string& arg);
     bool setWriteConfig(const std::string& arg);
     bool setWriteDot(const std::string& arg);
@@ -112,10 +123,14 @@ public:
     bool setWriteJSON(const std::string& arg);
     bool setWritePartition(const std::string& arg);
     bool setOutputPrefix(const std::string& arg);
+    bool setProfilingOutput(const std::string& arg);
+    bool setWritePartitionWeights(const std::string& arg);
+    bool setPartitionWeights(const std::string& arg);
 #ifdef USE_MEMPOOL
     bool setWriteUndeleted(const std::string& arg);
 #endif
     bool setModelOptions(const std::string& arg);
+    bool setSyntheticModel(const std::string& arg);
     bool setNumThreads(const std::string& arg);
 
 
@@ -142,6 +157,12 @@ public:
         std::cout << "output_core_prefix = " << output_core_prefix << std::endl;
         std::cout << "print_timing=" << print_timing << std::endl;
     std::cout << "print_env" << print_env << std::endl;
+        std::cout << "enable_profiling=" << enable_profiling << std::endl;
+        std::cout << "profiling_output=" << profiling_output << std::endl;
+        std::cout << "output_partition_weights=" << output_partition_weights << std::endl;
+        std::cout << "partition_weights=" << partition_weights << std::endl;
+        std::cout << "synthetic_model=" << synthetic_model << std::endl;
+        std::cout << "rank_sync=" << rank_sync << std::endl;
     }
 
 
@@ -177,6 +198,12 @@ public:
         ser & enable_sig_handling;
         ser & output_core_prefix;
         ser & print_timing;
+        ser & enable_profiling;
+        ser & profiling_output;
+        ser & output_partition_weights;
+        ser & partition_weights;
+        ser & synthetic_model;
+        ser & rank_sync;
     }
 
 private:
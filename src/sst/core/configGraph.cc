@@ -14,6 +14,7 @@
 #include "sst/core/configGraph.h"
 
 #include <fstream>
+#include <sstream>
 #include <algorithm>
 
 #include "sst/core/component.h"
@@ -31,6 +32,15 @@ namespace SST {
 
 // static bool zero_latency_warning = false;
 
+void ConfigLink::releaseNames()
+{
+    std::string().swap(name);
+    for ( int i = 0; i < 2; i++ ) {
+        std::string().swap(port[i]);
+        std::string().swap(latency_str[i]);
+    }
+}
+
 void ConfigLink::updateLatencies(TimeLord *timeLord)
 {
     // Need to clean up some elements before we can test for zero latency
@@ -184,6 +194,17 @@ ConfigComponent::cloneWithoutLinksOrParams() const
     return ret;
 }
 
+void
+ConfigComponent::releaseConfiguration()
+{
+    std::string().swap(name);
+    std::vector<LinkId_t>().swap(links);
+    params.clear();
+    std::vector<Statistics::StatisticInfo>().swap(enabledStatistics);
+    std::vector<ConfigComponent>().swap(subComponents);
+    std::vector<double>().swap(coords);
+}
+
 ComponentId_t ConfigComponent::getNextSubComponentID()
 {
     // If we are the ultimate component, get nextSubID and increment
@@ -727,12 +748,13 @@ ConfigGraph::addStatisticParameterForComponentType(const std::string& ComponentT
 void
 ConfigGraph::addLink(ComponentId_t comp_id, const std::string& link_name, const std::string& port, const std::string& latency_str, bool no_cut)
 {
-    if ( link_names.find(link_name) == link_names.end() ) {
+    auto name_it = link_names.find(link_name);
+    if ( name_it == link_names.end() ) {
         LinkId_t id = links.size();
-        link_names[link_name] = id;
+        name_it = link_names.emplace(link_name, id).first;
         links.insert(ConfigLink(id, link_name));
     }
-    ConfigLink &link = links[link_names[link_name]];
+    ConfigLink &link = links[name_it->second];
     if ( link.current_ref >= 2 ) {
         output.fatal(CALL_INFO,1,"ERROR: Parsing SDL file: Link %s referenced more than two times\n",link_name.c_str());
     }
@@ -762,6 +784,107 @@ ConfigGraph::setLinkNoCut(const std::string& link_name)
     link.no_cut = true;
 }
 
+void
+ConfigGraph::loadPartitionWeights(const std::string& filename)
+{
+    std::ifstream file(filename.c_str());
+    if ( !file.is_open() ) {
+        output.fatal(CALL_INFO, 1, "Unable to open partition weights file %s\n", filename.c_str());
+    }
+
+    std::map<LinkId_t, uint64_t> linkEvents;
+    std::map<ComponentId_t, double> compSeconds;
+    size_t unknown = 0;
+    std::string line;
+    while ( std::getline(file, line) ) {
+        std::istringstream in(line);
+        std::string kind;
+        if ( !(in >> kind) || kind[0] == '#' ) continue;
+
+        if ( kind == "link" ) {
+            std::string name;
+            uint64_t events, bytes;
+            if ( !(in >> name >> events >> bytes) ) {
+                output.fatal(CALL_INFO, 1, "Malformed line in partition weights file %s: %s\n",
+                             filename.c_str(), line.c_str());
+            }
+            auto found = link_names.find(name);
+            if ( found == link_names.end() ) {
+                unknown++;
+                continue;
+            }
+            linkEvents[found->second] = events;
+        }
+        else if ( kind == "component" ) {
+            std::string name;
+            double seconds;
+            if ( !(in >> name >> seconds) ) {
+                output.fatal(CALL_INFO, 1, "Malformed line in partition weights file %s: %s\n",
+                             filename.c_str(), line.c_str());
+            }
+            // Subcomponent time belongs to the component that owns it
+            auto found = compsByName.find(name.substr(0, name.find(':')));
+            if ( found == compsByName.end() ) {
+                unknown++;
+                continue;
+            }
+            compSeconds[found->second] += seconds;
+        }
+        else {
+            output.fatal(CALL_INFO, 1, "Unknown record '%s' in partition weights file %s\n",
+                         kind.c_str(), filename.c_str());
+        }
+    }
+
+    if ( unknown ) {
+        output.verbose(CALL_INFO, 1, 0, "# %zu links or components in %s are not in this graph\n", unknown, filename.c_str());
+    }
+
+    for ( auto& le : linkEvents ) {
+        links[le.first].weight = le.second;
+    }
+    output.verbose(CALL_INFO, 1, 0, "# Loaded weights for %zu links and %zu components from %s\n",
+                   linkEvents.size(), compSeconds.size(), filename.c_str());
+
+    if ( !compSeconds.empty() ) {
+        double total = 0.0;
+        for ( auto& cs : compSeconds ) total += cs.second;
+        if ( total <= 0.0 ) return;
+
+        // Components that never ran a handler still cost something to
+        // hold, so don't let their weight drop to zero
+        double average = total / comps.size();
+        for ( auto& comp : comps ) {
+            auto found = compSeconds.find(comp.id);
+            double seconds = found == compSeconds.end() ? 0.0 : found->second;
+            comp.setWeight(std::max(seconds / average, 0.01));
+        }
+        return;
+    }
+
+    // A component does work for the events on its links, so weight
+    // each component by its share of the traffic
+    std::vector<uint64_t> compEvents;
+    compEvents.reserve(comps.size());
+    uint64_t totalEvents = 0;
+    for ( auto& comp : comps ) {
+        uint64_t events = 0;
+        for ( LinkId_t id : comp.allLinks() ) {
+            auto found = linkEvents.find(id);
+            if ( found != linkEvents.end() ) events += found->second;
+        }
+        compEvents.push_back(events);
+        totalEvents += events;
+    }
+    if ( totalEvents == 0 ) return;
+
+    double average = (double)totalEvents / compEvents.size();
+    size_t index = 0;
+    for ( auto& comp : comps ) {
+        comp.setWeight(1.0 + compEvents[index++] / average);
+    }
+}
+
 
 
 bool ConfigGraph::containsComponent(ComponentId_t id) const {
@@ -56,6 +56,7 @@ public:
     std::string      latency_str[2];/*!< Temp string holding latency */
     int              current_ref;   /*!< Number of components currently referring to this Link */
     bool             no_cut;        /*!< If set to true, partitioner will not make a cut through this Link */
+    float            weight;        /*!< Partitioning weight for this link (cost of cutting it) */
 
     // inline const std::string& key() const { return name; }
     inline LinkId_t key() const { return id; }
@@ -77,6 +78,10 @@ public:
         os << "  latency[1] = " << latency[1] << std::endl;
     }
 
+    /** Free the names, which are only needed to wire the link up.  The
+     * IDs and latencies are kept. */
+    void releaseNames();
+
     /* Do not use.  For serialization only */
     ConfigLink() {}
 
@@ -90,6 +95,7 @@ public:
         ser & latency[0];
         ser & latency[1];
         ser & current_ref;
+        ser & weight;
     }
 
     ImplementSerializable(SST::ConfigLink)
@@ -98,7 +104,8 @@ private:
     friend class ConfigGraph;
     ConfigLink(LinkId_t id) :
         id(id),
-        no_cut(false)
+        no_cut(false),
+        weight(1.0)
     {
         current_ref = 0;
 
@@ -109,7 +116,8 @@ private:
 
     ConfigLink(LinkId_t id, const std::string& n) :
         id(id),
-        no_cut(false)
+        no_cut(false),
+        weight(1.0)
     {
         current_ref = 0;
         name = n;
@@ -218,6 +226,11 @@ public:
     ConfigComponent cloneWithoutLinks() const;
     ConfigComponent cloneWithoutLinksOrParams() const;
 
+    /** Free everything that is only needed to build the component:
+     * params, statistics, subcomponents, links and coordinates.  The
+     * id, rank and type are kept. */
+    void releaseConfiguration();
+
     ~ConfigComponent() {}
     ConfigComponent() : id(null_id), statLoadLevel(STATISTICLOADLEVELUNINITIALIZED), nextSubID(1), visited(false) { }
 
@@ -231,6 +244,7 @@ public:
     void setWeight(double w);
     void setCoordinates(const std::vector<double> &c);
     void addParameter(const std::string& key, const std::string& value, bool overwrite);
+    void addSharedParamSet(const std::string& set) { params.addSharedParamSet(set); }
     ConfigComponent* addSubComponent(ComponentId_t, const std::string& name, const std::string& type, int slot);
     ConfigComponent* findSubComponent(ComponentId_t);
     const ConfigComponent* findSubComponent(ComponentId_t) const;
@@ -387,6 +401,17 @@ public:
     /** Set a Link to be no-cut */
     void setLinkNoCut(const std::string& link_name);
 
+    /**
+     * Set link and component weights from a file written by
+     * --output-partition-weights on a previous run.  Each link's weight
+     * becomes the number of events it carried.  If the file has
+     * component costs, each component's weight becomes its measured
+     * time (including its subcomponents) relative to the average;
+     * otherwise it becomes 1 plus the traffic on its links relative to
+     * the average.  Names not found in the graph are ignored.
+     */
+    void loadPartitionWeights(const std::string& filename);
+
     /** Perform any post-creation cleanup processes */
     void postCreationCleanup();
 
@@ -493,6 +518,7 @@ public:
     ComponentId_t             component[2];
     SimTime_t                 latency[2];
     bool                      no_cut;
+    float                     weight;
 
     PartitionLink(const ConfigLink& cl) {
         id = cl.id;
@@ -501,6 +527,7 @@ public:
         latency[0] = cl.latency[0];
         latency[1] = cl.latency[1];
         no_cut = cl.no_cut;
+        weight = cl.weight;
     }
 
     inline LinkId_t key() const { return id; }
@@ -15,6 +15,7 @@
 #define SST_CORE_DECIMAL_FIXEDPOINT_H
 
 #include <iomanip>
+#include <limits>
 #include <sstream>
 #include <type_traits>
 
@@ -63,6 +64,10 @@ private:
     template <int A, int B>
     friend class sst_dec_fixed;
 
+    // binary_fixedpoint converts itself to decimal for printing
+    template <int A, int B>
+    friend class binary_fixedpoint;
+
     /**
        Data representing the digits of the number.
 
@@ -21,6 +21,12 @@
 #include "sst/core/sstpart.h"
 
 #include <ltdl.h>
+#include <algorithm>
+#include <atomic>
+#include <fstream>
+#include <set>
+#include <sstream>
+#include <thread>
 #include <vector>
 
 #ifdef HAVE_DLFCN_H
@@ -35,11 +41,21 @@
 #ifdef HAVE_UNISTD_H
 #include <unistd.h>
 #endif
+#include <fcntl.h>
+#include <utime.h>
 
+#include <cerrno>
+#include <cinttypes>
 #include <cstring>
 
 #include <stdio.h>
 
+/* Set by libltdl's configure macros; this is what the loader appends to
+   a library name when it searches */
+#ifndef LT_MODULE_EXT
+#define LT_MODULE_EXT ".so"
+#endif
+
 /* This needs to happen before lt_dlinit() and sets up the preload
    libraries properly.  The macro declares an extern symbol, so if we
    do this in the sst namespace, the symbol is namespaced and then not
@@ -63,9 +79,83 @@ namespace SST {
 struct LoaderData {
     /** Handle from Libtool */
     lt_dladvise advise_handle;
+    /** Library name to path (without extension) from the directory indexes */
+    std::map<std::string, std::string> indexed_libs;
+    /** Directories on the search path without an up to date index */
+    std::vector<std::string> unindexed_dirs;
 };
 
 
+const char* const ElemLoader::indexFileName = "sst-element-index";
+
+
+static std::vector<std::string> splitPath(const std::string& searchPaths)
+{
+    std::vector<std::string> paths;
+    char * pathCopy = new char [searchPaths.length() + 1];
+    std::strcpy(pathCopy, searchPaths.c_str());
+    char *brkb = nullptr;
+    char *p = nullptr;
+    for ( p = strtok_r(pathCopy, ":", &brkb); p ; p = strtok_r(nullptr, ":", &brkb) ) {
+        paths.push_back(p);
+    }
+
+    delete [] pathCopy;
+    return paths;
+}
+
+
+/* Modification time in nanoseconds where the platform records it, so
+   that a file rewritten within the same second is still seen to change */
+static int64_t modTime(const struct stat& s)
+{
+#if defined(__APPLE__)
+    return (int64_t)s.st_mtimespec.tv_sec * 1000000000 + s.st_mtimespec.tv_nsec;
+#elif defined(__linux__)
+    return (int64_t)s.st_mtim.tv_sec * 1000000000 + s.st_mtim.tv_nsec;
+#else
+    return (int64_t)s.st_mtime * 1000000000;
+#endif
+}
+
+
+/* Read the index of a library directory into libs.  Libraries already in
+   libs came from earlier directories on the search path and take
+   precedence, as they would when searching.  Returns false if there is
+   no index, if it is older than the directory, which means libraries
+   have been added or removed since it was written, or if any library
+   has changed size or modification time since. */
+static bool readIndex(const std::string& dir, std::map<std::string, std::string>& libs)
+{
+    std::string index_path = dir + "/" + ElemLoader::indexFileName;
+    struct stat dir_stat, index_stat;
+    if ( stat(dir.c_str(), &dir_stat) != 0 || stat(index_path.c_str(), &index_stat) != 0 ) return false;
+    if ( modTime(index_stat) < modTime(dir_stat) ) return false;
+
+    std::ifstream in(index_path);
+    if ( !in ) return false;
+
+    std::map<std::string, std::string> found;
+    std::string line;
+    while ( std::getline(in, line) ) {
+        if ( line.empty() || line[0] == '#' ) continue;
+        std::istringstream fields(line);
+        std::string name, file;
+        int64_t mtime;
+        off_t size;
+        if ( !(fields >> name >> file >> mtime >> size) ) return false;
+
+        std::string path = dir + "/" + file;
+        struct stat lib_stat;
+        if ( stat((path + LT_MODULE_EXT).c_str(), &lib_stat) != 0 ) return false;
+        if ( modTime(lib_stat) != mtime || lib_stat.st_size != size ) return false;
+        found[name] = path;
+    }
+    libs.insert(found.begin(), found.end());
+    return true;
+}
+
+
 ElemLoader::ElemLoader(const std::string& searchPaths) :
     searchPaths(searchPaths)
 {
@@ -110,6 +200,14 @@ ElemLoader::ElemLoader(const std::string& searchPaths) :
         abort();
     }
 
+    // A library in an unindexed directory shadows one of the same name
+    // further down the search path, so the indexes can only be used up
+    // to the first directory without one
+    for ( auto& dir : splitPath(searchPaths) ) {
+        if ( !loaderData->unindexed_dirs.empty() || !readIndex(dir, loaderData->indexed_libs) ) {
+            loaderData->unindexed_dirs.push_back(dir);
+        }
+    }
 }
 
 
@@ -124,26 +222,10 @@ ElemLoader::~ElemLoader()
 }
 
 
-static std::vector<std::string> splitPath(const std::string& searchPaths)
-{
-    std::vector<std::string> paths;
-    char * pathCopy = new char [searchPaths.length() + 1];
-    std::strcpy(pathCopy, searchPaths.c_str());
-    char *brkb = nullptr;
-    char *p = nullptr;
-    for ( p = strtok_r(pathCopy, ":", &brkb); p ; p = strtok_r(nullptr, ":", &brkb) ) {
-        paths.push_back(p);
-    }
-
-    delete [] pathCopy;
-    return paths;
-}
-
-
 static void followError(const std::string& libname, const std::string& elemlib, const std::string& searchPaths,
                         std::ostream& err_os)
 {
-    std::string so_path = libname + ".so";
+    std::string so_path = libname + LT_MODULE_EXT;
     std::string fullpath;
     void *handle;
 
@@ -175,8 +257,15 @@ void
 ElemLoader::loadLibrary(const std::string& elemlib, std::ostream& err_os)
 {
     std::string libname = "lib" + elemlib;
-    lt_dlhandle lt_handle;
-    lt_handle = lt_dlopenadvise(libname.c_str(), loaderData->advise_handle);
+    lt_dlhandle lt_handle = nullptr;
+    // Libraries in an index are opened by path, without a search
+    auto indexed = loaderData->indexed_libs.find(elemlib);
+    if ( indexed != loaderData->indexed_libs.end() ) {
+        lt_handle = lt_dlopenadvise(indexed->second.c_str(), loaderData->advise_handle);
+    }
+    if (nullptr == lt_handle) {
+        lt_handle = lt_dlopenadvise(libname.c_str(), loaderData->advise_handle);
+    }
     if (nullptr == lt_handle) {
       // The preopen module runs last and if the
         // component was found earlier, but has a missing symbol or
@@ -221,8 +310,93 @@ std::vector<std::string>
 ElemLoader::getPotentialElements()
 {
     std::vector<std::string> res;
-    lt_dlforeachfile(searchPaths.c_str(), elemCB, &res);
+    for ( auto& lib : loaderData->indexed_libs ) {
+        res.push_back(lib.first);
+    }
+    for ( auto& dir : loaderData->unindexed_dirs ) {
+        lt_dlforeachfile(dir.c_str(), elemCB, &res);
+    }
     return res;
 }
 
+
+void
+ElemLoader::prefetchLibraries(const std::vector<std::string>& elemlibs)
+{
+    std::vector<std::string> files;
+    for ( auto& lib : elemlibs ) {
+        auto indexed = loaderData->indexed_libs.find(lib);
+        if ( indexed != loaderData->indexed_libs.end() ) {
+            files.push_back(indexed->second + LT_MODULE_EXT);
+        }
+    }
+    if ( files.size() < 2 ) return;
+
+    // This waits on the filesystem rather than the CPU, so use more
+    // threads than there are likely to be cores
+    const size_t num_threads = std::min<size_t>(files.size(), 8);
+    std::atomic<size_t> next(0);
+    auto prefetch = [&files, &next]() {
+        for ( size_t i = next++; i < files.size(); i = next++ ) {
+            int fd = open(files[i].c_str(), O_RDONLY);
+            if ( fd < 0 ) continue;
+#ifdef POSIX_FADV_WILLNEED
+            posix_fadvise(fd, 0, 0, POSIX_FADV_WILLNEED);
+#endif
+            close(fd);
+        }
+    };
+
+    std::vector<std::thread> threads;
+    for ( size_t i = 1; i < num_threads; i++ ) {
+        threads.emplace_back(prefetch);
+    }
+    prefetch();
+    for ( auto& t : threads ) t.join();
+}
+
+
+bool
+ElemLoader::writeIndexes(std::ostream& err_os)
+{
+    std::vector<std::string> failed;
+    for ( auto& dir : loaderData->unindexed_dirs ) {
+        std::vector<std::string> libs;
+        lt_dlforeachfile(dir.c_str(), elemCB, &libs);
+        std::set<std::string> names(libs.begin(), libs.end());
+
+        // Write under a temporary name so a reader never sees a partial
+        // index, then touch the index after the rename so that it is not
+        // older than the directory the rename just modified
+        std::string index_path = dir + "/" + indexFileName;
+        std::string tmp_path = index_path + "." + std::to_string(getpid());
+        FILE* fp = fopen(tmp_path.c_str(), "w");
+        bool ok = fp != nullptr;
+        if ( ok ) {
+            fprintf(fp, "# SST element library index, written by sst-info\n");
+            fprintf(fp, "# <library> <file without extension> <mtime in ns> <size>\n");
+            for ( auto& name : names ) {
+                // Only libraries with the module extension can be
+                // opened by path
+                std::string file = "lib" + name;
+                struct stat lib_stat;
+                if ( stat((dir + "/" + file + LT_MODULE_EXT).c_str(), &lib_stat) != 0 ) continue;
+                fprintf(fp, "%s %s %" PRId64 " %lld\n", name.c_str(), file.c_str(), modTime(lib_stat),
+                        (long long)lib_stat.st_size);
+            }
+            ok = (fclose(fp) == 0);
+            ok = ok && rename(tmp_path.c_str(), index_path.c_str()) == 0;
+            ok = ok && utime(index_path.c_str(), nullptr) == 0;
+        }
+        if ( !ok ) {
+            int err = errno;
+            unlink(tmp_path.c_str());
+            err_os << "Unable to write element library index " << index_path << ": " << strerror(err) << "\n";
+            failed.push_back(dir);
+        }
+    }
+    loaderData->unindexed_dirs.swap(failed);
+    return loaderData->unindexed_dirs.empty();
+}
+
 }
@@ -21,11 +21,23 @@ namespace SST {
 struct LoaderData;
 struct ElementInfoGenerator;
 
-/** Class to load Element Libraries */
+/** Class to load Element Libraries
+ *
+ * Each directory on the search path may hold an index, written by
+ * sst-info --write-index, listing the element libraries found in it.
+ * When the index is newer than the directory and the libraries are
+ * unchanged, it is used instead of scanning the directory, and
+ * libraries are opened by their full path rather than by probing every
+ * directory on the search path.  Indexes are only used up to the first
+ * directory without one, so the search order is kept.
+ */
 class ElemLoader {
     LoaderData *loaderData;
     std::string searchPaths;
 public:
+    /** Name of the index file in each library directory */
+    static const char* const indexFileName;
+
     /** Create a new ElementLoader with a given searchpath of directories */
     ElemLoader(const std::string& searchPaths);
     ~ElemLoader();
@@ -41,6 +53,22 @@ public:
      * Returns a list of potential element libraries in the search path
      */
     std::vector<std::string> getPotentialElements();
+
+    /**
+     * Read the files of the given libraries into the page cache, using
+     * several threads, so that loading them afterwards does not wait on
+     * the filesystem one library at a time.  Only libraries found in an
+     * index are prefetched.
+     */
+    void prefetchLibraries(const std::vector<std::string>& elemlibs);
+
+    /**
+     * Write an index for every directory on the search path whose index
+     * is missing or out of date, or that comes after one that is
+     * @param err_os - Where to report directories that could not be indexed
+     * @return true if every directory has an up to date index
+     */
+    bool writeIndexes(std::ostream& err_os);
 };
 
 }
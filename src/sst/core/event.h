@@ -181,11 +181,25 @@ public:
 
 #endif
 
+    /**
+     * Events whose own data (beyond the Event fields) is one trivially
+     * copyable block can return it here.  Between ranks the block is
+     * then copied with a memcpy instead of going through
+     * serialize_order().  The block must be the same size for every
+     * event of the class.  The default, nullptr, uses serialize_order().
+     */
+    virtual void* getTrivialSyncData(size_t& UNUSED(size)) {
+        return nullptr;
+    }
+
     void serialize_order(SST::Core::Serialization::serializer &ser) override{
-        Activity::serialize_order(ser);
+        // Between ranks the SyncQueue writes these fields itself
+        if ( !ser.take_skip_event_header() ) {
+            Activity::serialize_order(ser);
 #ifndef SST_ENFORCE_EVENT_ORDERING
-        ser & link_id;
+            ser & link_id;
 #endif
+        }
 #ifdef __SST_DEBUG_EVENT_TRACKING__
         ser & first_comp;
         ser & first_type;
@@ -70,6 +70,17 @@ public:
         return global_count;
     }
 
+    /**
+     * Record the Exit state reduced across ranks by the rank sync: the
+     * number of ranks that still have primary components (or just
+     * whether there are any) and the latest time a rank lost its last
+     * one
+     */
+    void setGlobalState(unsigned int count, SimTime_t end) {
+        global_count = count;
+        if ( count == 0 ) end_time = end;
+    }
+
 private:
     Exit() { } // for serialization only
     Exit(const Exit&);           // Don't implement
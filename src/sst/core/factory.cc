@@ -48,6 +48,7 @@ using namespace SST::Statistics;
 namespace SST {
 
 Factory* Factory::instance = nullptr;
+thread_local std::string Factory::loadingComponentType;
 
 
 Factory::Factory(const std::string& searchPaths) :
@@ -67,6 +68,22 @@ Factory::~Factory()
 }
 
 
+Factory::TypeCache&
+Factory::getTypeCache(TypeCacheMap& caches, const std::type_index& kind)
+{
+    TypeCache* const* cache = caches.find(kind);
+    if ( cache ) return **cache;
+
+    std::lock_guard<std::recursive_mutex> lock(factoryMutex);
+    cache = caches.find(kind);
+    if ( cache ) return **cache;
+
+    typeCacheStore.emplace_back();
+    caches.insert(kind, &typeCacheStore.back());
+    return typeCacheStore.back();
+}
+
+
 
 static bool checkPort(const std::string& def, const std::string& offered)
 {
@@ -163,34 +180,11 @@ Factory::getParamNames(const std::string& type)
     // case.  It is never used.
     static Params::KeySet_t empty_keyset;
 
-    std::string elemlib, elem;
-    std::tie(elemlib, elem) = parseLoadName(type);
-    // ensure library is already loaded...
-    if (loaded_libraries.find(elemlib) == loaded_libraries.end()) {
-        findLibrary(elemlib);
-    }
+    std::stringstream err_os;
+    if ( auto* info = findInfo<Component>(type, err_os) ) return info->getParamNames();
+    if ( auto* info = findInfo<SubComponent>(type, err_os) ) return info->getParamNames();
+    if ( auto* info = findInfo<Module>(type, err_os) ) return info->getParamNames();
 
-    // Check to see if library is loaded into new
-    // ElementLibraryDatabase
-    auto* lib = ELI::InfoDatabase::getLibrary<Component>(elemlib);
-    if (lib) {
-        auto* compInfo = lib->getInfo(elem);
-        if ( compInfo ) return compInfo->getParamNames();
-    }
-    else {
-        auto* lib = ELI::InfoDatabase::getLibrary<SubComponent>(elemlib);
-        if ( lib ) {
-            auto* compInfo = lib->getInfo(elem);
-            if ( compInfo ) return compInfo->getParamNames();
-        }
-        else {
-            auto* lib = ELI::InfoDatabase::getLibrary<Module>(elemlib);
-            if ( lib ) {
-                auto* compInfo = lib->getInfo(elem);
-                if ( compInfo ) return compInfo->getParamNames();
-            }
-        }
-    }
     // If we made it to here we didn't find an element that has params
     // with the given name
     out.fatal(CALL_INFO, 1,"can't find requested element %s.\n ", type.c_str());
@@ -204,35 +198,18 @@ Factory::CreateComponent(ComponentId_t id,
                          const std::string& type,
                          Params& params)
 {
-    std::string elemlib, elem;
-
-    std::tie(elemlib, elem) = parseLoadName(type);
-
-    // ensure library is already loaded...
     std::stringstream sstr;
-    requireLibrary(elemlib, sstr);
-
-    std::lock_guard<std::recursive_mutex> lock(factoryMutex);
-    // Check to see if library is loaded into new
-    // ElementLibraryDatabase
-
-    auto* lib = ELI::InfoDatabase::getLibrary<Component>(elemlib);
-    if (lib){
-      auto* compInfo = lib->getInfo(elem);
-      if (compInfo) {
-        auto* compLib = Component::getBuilderLibrary(elemlib);
-        if (compLib){
-          auto* fact = compLib->getBuilder(elem);
-          if (fact){
+    auto* compInfo = findInfo<Component>(type, sstr);
+    if (compInfo) {
+        auto* fact = findBuilder(type, &Component::getBuilderLibrary);
+        if (fact){
             loadingComponentType = type;
             params.pushAllowedKeys(compInfo->getParamNames());
             Component* ret = fact->create(id,params);
             params.popAllowedKeys();
             loadingComponentType = "";
             return ret;
-          }
         }
-      }
     }
     // If we make it to here, component not found
     out.fatal(CALL_INFO, 1, "can't find requested component '%s'\n%s\n",
@@ -244,38 +221,19 @@ Factory::CreateComponent(ComponentId_t id,
 bool
 Factory::DoesSubComponentSlotExist(const std::string& type, const std::string& slotName)
 {
-    std::string compTypeToLoad = type;
-
-    std::string elemlib, elem;
-    std::tie(elemlib, elem) = parseLoadName(compTypeToLoad);
-
-    // ensure library is already loaded...
     std::stringstream error_os;
-    requireLibrary(elemlib, error_os);
-
-    std::lock_guard<std::recursive_mutex> lock(factoryMutex);
-
-    // Check to see if library is loaded into new ElementLibraryDatabase
-    auto* compLib = ELI::InfoDatabase::getLibrary<Component>(elemlib);
-    if (compLib){
-        auto* info = compLib->getInfo(elem);
-        if (info){
-            for (auto& item : info->getSubComponentSlots()){
-                if (item.name == slotName) return true;
-            }
-            return false;
+    if (auto* info = findInfo<Component>(type, error_os)){
+        for (auto& item : info->getSubComponentSlots()){
+            if (item.name == slotName) return true;
         }
+        return false;
     }
 
-    auto* subLib = ELI::InfoDatabase::getLibrary<SubComponent>(elemlib);
-    if (subLib){
-        auto* info = subLib->getInfo(elem);
-        if (info){
-            for (auto& item : info->getSubComponentSlots()){
-                if (item.name == slotName) return true;
-            }
-            return false;
+    if (auto* info = findInfo<SubComponent>(type, error_os)){
+        for (auto& item : info->getSubComponentSlots()){
+            if (item.name == slotName) return true;
         }
+        return false;
     }
 
     // If we get to here, element doesn't exist
@@ -287,46 +245,25 @@ Factory::DoesSubComponentSlotExist(const std::string& type, const std::string& s
 bool
 Factory::DoesComponentInfoStatisticNameExist(const std::string& type, const std::string& statisticName)
 {
-    std::string compTypeToLoad = type;
-    if (true == type.empty()) {
-        compTypeToLoad = loadingComponentType;
-    }
-
-    std::string elemlib, elem;
-    std::tie(elemlib, elem) = parseLoadName(compTypeToLoad);
+    const std::string& compTypeToLoad = type.empty() ? loadingComponentType : type;
 
-    // ensure library is already loaded...
     std::stringstream error_os;
-    requireLibrary(elemlib, error_os);
-
-    std::lock_guard<std::recursive_mutex> lock(factoryMutex);
-
-    // Check to see if library is loaded into new
-    // ElementLibraryDatabase
-    auto* sublib = ELI::InfoDatabase::getLibrary<SubComponent>(elemlib);
-    if (sublib){
-        auto* info = sublib->getInfo(elem);
-        if (info){
-            for ( auto& item : info->getStatnames() ) {
-                if ( statisticName == item ) {
-                    return true;
-                }
+    if (auto* info = findInfo<SubComponent>(compTypeToLoad, error_os)){
+        for ( auto& item : info->getStatnames() ) {
+            if ( statisticName == item ) {
+                return true;
             }
-            return false;
         }
+        return false;
     }
 
-    auto* complib = ELI::InfoDatabase::getLibrary<Component>(elemlib);
-    if (complib){
-        auto* info = complib->getInfo(elem);
-        if (info){
-            for ( auto& item : info->getStatnames() ) {
-                if ( statisticName == item ) {
-                    return true;
-                }
+    if (auto* info = findInfo<Component>(compTypeToLoad, error_os)){
+        for ( auto& item : info->getStatnames() ) {
+            if ( statisticName == item ) {
+                return true;
             }
-            return false;
         }
+        return false;
     }
 
 
@@ -339,46 +276,34 @@ Factory::DoesComponentInfoStatisticNameExist(const std::string& type, const std:
 uint8_t
 Factory::GetComponentInfoStatisticEnableLevel(const std::string& type, const std::string& statisticName)
 {
-    std::string compTypeToLoad = type;
-    if (true == type.empty()) {
-        compTypeToLoad = loadingComponentType;
-    }
+    const std::string& compTypeToLoad = type.empty() ? loadingComponentType : type;
 
-    std::string elemlib, elem;
-    std::tie(elemlib, elem) = parseLoadName(compTypeToLoad);
-
-    // ensure library is already loaded...
     std::stringstream error_os;
-    requireLibrary(elemlib, error_os);
-
-    std::lock_guard<std::recursive_mutex> lock(factoryMutex);
-
-    // Check to see if library is loaded into new
-    // ElementLibraryDatabase
-    auto* compLib = ELI::InfoDatabase::getLibrary<Component>(elemlib);
-    if (compLib){
-      auto* info = compLib->getInfo(elem);
-      if (info){
+    if (auto* info = findInfo<Component>(compTypeToLoad, error_os)){
         for ( auto& item : info->getValidStats() ) {
             if ( statisticName == item.name ) {
                 return item.enableLevel;
             }
         }
-      }
-      return 0;
+        return 0;
     }
 
-    auto* subLib = ELI::InfoDatabase::getLibrary<SubComponent>(elemlib);
-    if (subLib){
-      auto* info = subLib->getInfo(elem);
-      if (info){
+    {
+        // A library that registers any Components reports level 0 for
+        // everything else in it, as the lookup always has.
+        std::string elemlib, elem;
+        std::tie(elemlib, elem) = parseLoadName(compTypeToLoad);
+        std::lock_guard<std::recursive_mutex> lock(factoryMutex);
+        if ( ELI::InfoDatabase::getLibrary<Component>(elemlib) ) return 0;
+    }
+
+    if (auto* info = findInfo<SubComponent>(compTypeToLoad, error_os)){
         for ( auto& item : info->getValidStats() ) {
             if ( statisticName == item.name ) {
                 return item.enableLevel;
             }
         }
-      }
-      return 0;
+        return 0;
     }
 
     // If we get to here, element doesn't exist
@@ -432,30 +357,16 @@ Factory::CreateModule(const std::string& type, Params& params)
                 1, "Error: Core attempted to load an empty module name, did you miss a module string in your input deck?\n");
     }
 
-    std::string elemlib, elem;
-    std::tie(elemlib, elem) = parseLoadName(type);
-
     std::stringstream error_os;
-    requireLibrary(elemlib, error_os);
-    std::lock_guard<std::recursive_mutex> lock(factoryMutex);
-
-    // Check to see if library is loaded into new
-    // ElementLibraryDatabase
-    auto* lib = ELI::InfoDatabase::getLibrary<Module>(elemlib);
-    if (lib){
-      auto* info = lib->getInfo(elem);
-      if (info){
-        auto* builderLib = Module::getBuilderLibraryTemplate<Params&>(elemlib);
-        if (builderLib){
-          auto* fact = builderLib->getBuilder(elem);
-          if (fact){
+    auto* info = findInfo<Module>(type, error_os);
+    if (info){
+        auto* fact = findBuilder(type, &Module::getBuilderLibraryTemplate<Params&>);
+        if (fact){
             params.pushAllowedKeys(info->getParamNames());
             Module* ret = fact->create(params);
             params.popAllowedKeys();
             return ret;
-          }
         }
-      }
     }
 
     // If we get to here, element doesn't exist
@@ -467,32 +378,16 @@ Factory::CreateModule(const std::string& type, Params& params)
 Module*
 Factory::CreateModuleWithComponent(const std::string& type, Component* comp, Params& params)
 {
-    std::string elemlib, elem;
-    std::tie(elemlib, elem) = parseLoadName(type);
-
-    // ensure library is already loaded...
     std::stringstream error_os;
-    requireLibrary(elemlib, error_os);
-
-    std::lock_guard<std::recursive_mutex> lock(factoryMutex);
-
-    // Check to see if library is loaded into new
-    // ElementLibraryDatabase
-    auto* lib = ELI::InfoDatabase::getLibrary<Module>(elemlib);
-    if (lib){
-      auto* info = lib->getInfo(elem);
-      if (info){
-        auto* builderLib = Module::getBuilderLibraryTemplate<Component*,Params&>(elemlib);
-        if (builderLib){
-          auto* fact = builderLib->getBuilder(elem);
-          if (fact){
+    auto* info = findInfo<Module>(type, error_os);
+    if (info){
+        auto* fact = findBuilder(type, &Module::getBuilderLibraryTemplate<Component*,Params&>);
+        if (fact){
             params.pushAllowedKeys(info->getParamNames());
             Module* ret = fact->create(comp,params);
             params.popAllowedKeys();
             return ret;
-          }
         }
-      }
     }
 
     // If we get to here, element doesn't exist
@@ -505,23 +400,8 @@ Factory::CreateModuleWithComponent(const std::string& type, Component* comp, Par
 bool
 Factory::doesSubComponentExist(const std::string& type)
 {
-    std::string elemlib, elem;
-    std::tie(elemlib, elem) = parseLoadName(type);
-
-    // ensure library is already loaded...
-    requireLibrary(elemlib);
-
-    std::lock_guard<std::recursive_mutex> lock(factoryMutex);
-    // Check to see if library is loaded into new
-    // ElementLibraryDatabase
-    auto* lib = ELI::InfoDatabase::getLibrary<SubComponent>(elemlib);
-    if (lib){
-      auto* info = lib->getInfo(elem);
-      if ( info ) return true;
-    }
-
-    // If we get to here, element doesn't exist
-    return false;
+    std::stringstream error_os;
+    return findInfo<SubComponent>(type, error_os) != nullptr;
 }
 
 void
@@ -632,13 +512,20 @@ void Factory::getLoadedLibraryNames(std::set<std::string>& lib_names)
 
 }
 
-void Factory::loadUnloadedLibraries(const std::set<std::string>& lib_names)
+void Factory::loadUnloadedLibraries(const std::set<std::string>& lib_names, std::ostream& err_os)
 {
-    for ( std::set<std::string>::const_iterator i = lib_names.begin();
-          i != lib_names.end(); ++i )
-        {
-            findLibrary(*i);
-        }
+    std::lock_guard<std::recursive_mutex> lock(factoryMutex);
+    std::vector<std::string> unloaded;
+    for ( auto& lib : lib_names ) {
+        if ( loaded_libraries.count(lib) == 0 ) unloaded.push_back(lib);
+    }
+
+    // dlopen() is serialized by the dynamic linker, but reading the
+    // files need not be
+    loader->prefetchLibraries(unloaded);
+    for ( auto& lib : unloaded ) {
+        loadLibrary(lib, err_os);
+    }
 }
 
 
@@ -15,9 +15,12 @@
 #include "sst/core/sst_types.h"
 
 #include <stdio.h>
+#include <list>
 #include <mutex>
+#include <typeindex>
 
 #include "sst/core/params.h"
+#include "sst/core/threadsafe.h"
 #include "sst/core/eli/elementinfo.h"
 
 /* Forward declare for Friendship */
@@ -101,27 +104,8 @@ public:
      */
     template <class Base>
     bool isSubComponentLoadableUsingAPI(const std::string& type) {
-        std::string elemlib, elem;
-        std::tie(elemlib, elem) = parseLoadName(type);
-
-        requireLibrary(elemlib);
-        std::lock_guard<std::recursive_mutex> lock(factoryMutex);
-
-        auto* lib = ELI::InfoDatabase::getLibrary<Base>(elemlib);
-        if (lib){
-            auto map = lib->getMap();
-            auto* info = lib->getInfo(elem);
-            if (info){
-                auto* builderLib = Base::getBuilderLibrary(elemlib);
-                if (builderLib){
-                    auto* fact = builderLib->getBuilder(elem);
-                    if (fact){
-                        return true;
-                    }
-                }
-            }
-        }
-        return false;
+        std::stringstream err_os;
+        return findInfo<Base>(type, err_os) && findBuilder(type, &Base::getBuilderLibrary);
     }
 
     /**
@@ -132,28 +116,15 @@ public:
      */
     template <class Base, class... CtorArgs>
     Base* Create(const std::string& type, SST::Params& params, CtorArgs&&... args){
-        std::string elemlib, elem;
-        std::tie(elemlib, elem) = parseLoadName(type);
-
         std::stringstream err_os;
-        requireLibrary(elemlib, err_os);
-        std::lock_guard<std::recursive_mutex> lock(factoryMutex);
-
-        auto* lib = ELI::InfoDatabase::getLibrary<Base>(elemlib);
-        if (lib){
-            auto map = lib->getMap();
-            auto* info = lib->getInfo(elem);
-            if (info){
-                auto* builderLib = Base::getBuilderLibrary(elemlib);
-                if (builderLib){
-                    auto* fact = builderLib->getBuilder(elem);
-                    if (fact){
-                        params.pushAllowedKeys(info->getParamNames());
-                        Base* ret = fact->create(std::forward<CtorArgs>(args)...);
-                        params.popAllowedKeys();
-                        return ret;
-                    }
-                }
+        auto* info = findInfo<Base>(type, err_os);
+        if (info){
+            auto* fact = findBuilder(type, &Base::getBuilderLibrary);
+            if (fact){
+                params.pushAllowedKeys(info->getParamNames());
+                Base* ret = fact->create(std::forward<CtorArgs>(args)...);
+                params.popAllowedKeys();
+                return ret;
             }
         }
         notFound(Base::ELI_baseName(), type, err_os.str());
@@ -213,7 +184,14 @@ public:
     void requireLibrary(const std::string& elemlib);
 
     void getLoadedLibraryNames(std::set<std::string>& lib_names);
-    void loadUnloadedLibraries(const std::set<std::string>& lib_names);
+    /**
+     * @brief loadUnloadedLibraries Loads any of the libraries not already
+     * loaded.  The library files are prefetched in parallel first, so the
+     * loads themselves don't wait on the filesystem.
+     * @param lib_names Libraries to load
+     * @param err_os Stream to print error messages to
+     */
+    void loadUnloadedLibraries(const std::set<std::string>& lib_names, std::ostream& err_os = std::cerr);
 
     /** Determine if a SubComponentSlot is defined in a components ElementInfoStatistic
      * @param type - The name of the component/subcomponent
@@ -276,10 +254,72 @@ private:
     std::string searchPaths;
 
     ElemLoader *loader;
-    std::string loadingComponentType;
+    static thread_local std::string loadingComponentType;
 
     std::pair<std::string, std::string> parseLoadName(const std::string& wholename);
 
+    /* Element types are resolved once, under factoryMutex, and the
+     * result is kept in an insert-only table that is read without
+     * locking, so threads building components don't serialize on the
+     * factory.  Types that don't exist are remembered too once their
+     * library has been loaded.  There is one table per Base (for ELI
+     * info) and per builder Library, found by type_index. */
+    typedef Core::ThreadSafe::InsertOnlyHashMap<std::string, void*> TypeCache;
+    typedef Core::ThreadSafe::InsertOnlyHashMap<std::type_index, TypeCache*, 64> TypeCacheMap;
+
+    TypeCacheMap infoCaches;
+    TypeCacheMap builderCaches;
+    std::list<TypeCache> typeCacheStore;
+
+    /** Get the table for kind from caches, creating it if needed */
+    TypeCache& getTypeCache(TypeCacheMap& caches, const std::type_index& kind);
+
+    /** Find the ELI info of type as a Base, loading its library if needed */
+    template <class Base>
+    typename Base::BuilderInfo* findInfo(const std::string& type, std::ostream& err_os) {
+        using Info = typename Base::BuilderInfo;
+        TypeCache& cache = getTypeCache(infoCaches, typeid(Base));
+        void* const* cached = cache.find(type);
+        if ( cached ) return static_cast<Info*>(*cached);
+
+        std::string elemlib, elem;
+        std::tie(elemlib, elem) = parseLoadName(type);
+        requireLibrary(elemlib, err_os);
+
+        std::lock_guard<std::recursive_mutex> lock(factoryMutex);
+        cached = cache.find(type);
+        if ( cached ) return static_cast<Info*>(*cached);
+
+        Info* info = nullptr;
+        auto* lib = ELI::InfoDatabase::getLibrary<Base>(elemlib);
+        if ( lib ) info = lib->getInfo(elem);
+        if ( info || loaded_libraries.count(elemlib) ) cache.insert(type, info);
+        return info;
+    }
+
+    /** Find the builder for type in the builder libraries returned by getBuilderLibrary */
+    template <class Library>
+    typename Library::BaseBuilder* findBuilder(const std::string& type,
+                                               Library* (*getBuilderLibrary)(const std::string&)) {
+        using Builder = typename Library::BaseBuilder;
+        TypeCache& cache = getTypeCache(builderCaches, typeid(Library));
+        void* const* cached = cache.find(type);
+        if ( cached ) return static_cast<Builder*>(*cached);
+
+        std::string elemlib, elem;
+        std::tie(elemlib, elem) = parseLoadName(type);
+
+        std::lock_guard<std::recursive_mutex> lock(factoryMutex);
+        cached = cache.find(type);
+        if ( cached ) return static_cast<Builder*>(*cached);
+
+        Builder* fact = nullptr;
+        auto* lib = getBuilderLibrary(elemlib);
+        if ( lib ) fact = lib->getBuilder(elem);
+        if ( fact || loaded_libraries.count(elemlib) ) cache.insert(type, fact);
+        return fact;
+    }
+
     std::recursive_mutex factoryMutex;
 
 
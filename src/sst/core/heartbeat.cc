@@ -14,6 +14,7 @@
 #include "sst/core/heartbeat.h"
 
 #include "sst/core/component.h"
+#include "sst/core/memuse.h"
 #include "sst/core/simulation.h"
 #include "sst/core/timeConverter.h"
 
@@ -74,6 +75,10 @@ void SimulatorHeartbeat::execute( void )
 #endif
     uint64_t max_mempool_size, global_mempool_size, global_active_activities;
 
+    // Every rank is built the same way, so all of them skip the reduction
+    Core::MemAccounting::TagBytes global_tag_bytes;
+    if ( Core::MemAccounting::enabled() ) Core::MemAccounting::getGlobalTagBytes(global_tag_bytes);
+
 #ifdef SST_CONFIG_HAVE_MPI
     uint64_t local_sync_data_size = Simulation::getSimulation()->getSyncQueueDataSize();
 
@@ -120,6 +125,13 @@ void SimulatorHeartbeat::execute( void )
                           global_max_sync_data_size_ua.toStringBestSI().c_str());
         sim_output.output("\tGlobal Sync data size:           %s\n",
                           global_sync_data_size_ua.toStringBestSI().c_str());
+        if ( Core::MemAccounting::enabled() ) {
+            for ( int i = 0; i < Core::MemAccounting::NUM_TAGS; i++ ) {
+                std::string label = std::string("Global ") + Core::MemAccounting::tagName((Core::MemAccounting::Tag)i) + " memory:";
+                sim_output.output("\t%-32s %s\n", label.c_str(),
+                                  Core::MemAccounting::formatBytes(global_tag_bytes[i]).c_str());
+            }
+        }
 
     }
 
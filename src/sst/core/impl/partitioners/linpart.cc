@@ -32,6 +32,15 @@ void SSTLinearPartition::performPartition(PartitionGraph* graph) {
 
     uint32_t tot_ranks = rankcount.rank * rankcount.thread;
 
+    // If the weights differ (e.g. they were loaded with
+    // --partition-weights), balance weight rather than count
+    for ( PartitionComponentMap_t::iterator compItr = compMap.begin(); compItr != compMap.end(); compItr++ ) {
+        if ( compItr->weight != compMap.begin()->weight ) {
+            performWeightedPartition(graph);
+            return;
+        }
+    }
+
     // const int componentCount = compMap.size();
     const size_t componentCount = graph->getNumComponents();
     size_t componentRemainder = componentCount % tot_ranks;
@@ -79,3 +88,35 @@ void SSTLinearPartition::performPartition(PartitionGraph* graph) {
 
     partOutput->verbose(CALL_INFO, 1, 0, "Linear partition scheme completed.\n");
 }
+
+void SSTLinearPartition::performWeightedPartition(PartitionGraph* graph) {
+    PartitionComponentMap_t& compMap = graph->getComponentMap();
+
+    uint32_t tot_ranks = rankcount.rank * rankcount.thread;
+
+    double totalWeight = 0.0;
+    for ( PartitionComponentMap_t::iterator compItr = compMap.begin(); compItr != compMap.end(); compItr++ ) {
+        totalWeight += compItr->weight;
+    }
+    const double weightPerRank = totalWeight / tot_ranks;
+
+    partOutput->verbose(CALL_INFO, 1, 0, "Performing a weighted linear partition scheme for simulation model.\n");
+    partOutput->verbose(CALL_INFO, 1, 0, "- Component Count:                  %10zu\n", graph->getNumComponents());
+    partOutput->verbose(CALL_INFO, 1, 0, "- Total Weight:                     %10.2f\n", totalWeight);
+    partOutput->verbose(CALL_INFO, 1, 0, "- Approx. Weight per Rank:          %10.2f\n", weightPerRank);
+
+    // Move to the next part once the midpoint of a component falls
+    // past the current part's share of the cumulative weight.  Only
+    // advance one part per component so no part is left empty.
+    uint32_t part = 0;
+    double cumulative = 0.0;
+    for ( PartitionComponentMap_t::iterator compItr = compMap.begin(); compItr != compMap.end(); compItr++ ) {
+        if ( part + 1 < tot_ranks && cumulative + compItr->weight / 2 > weightPerRank * (part + 1) ) {
+            part++;
+        }
+        compItr->rank = RankInfo(part / rankcount.thread, part % rankcount.thread);
+        cumulative += compItr->weight;
+    }
+
+    partOutput->verbose(CALL_INFO, 1, 0, "Weighted linear partition scheme completed.\n");
+}
@@ -42,7 +42,7 @@ public:
         "sst",
         "linear",
         SST_ELI_ELEMENT_VERSION(1,0,0),
-        "Partitions components by dividing Component ID space into roughly equal portions.  Components with sequential IDs will be placed close together.")
+        "Partitions components by dividing Component ID space into portions of roughly equal weight.  Components with sequential IDs will be placed close together.")
 
 protected:
     /** Number of ranks in the simulation */
@@ -64,6 +64,13 @@ public:
     */
     void performPartition(PartitionGraph* graph) override;
 
+    /**
+       Performs a partition that balances component weight rather than
+       component count.  Used when the weights are not all equal.
+       \param graph The simulation configuration to partition
+    */
+    void performWeightedPartition(PartitionGraph* graph);
+
     void performPartition(ConfigGraph* graph) override {
         SST::Partition::SSTPartitioner::performPartition(graph);
     }
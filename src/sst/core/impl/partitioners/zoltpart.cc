@@ -116,7 +116,7 @@ static void sst_zoltan_get_edge_list(void *data, int UNUSED(sizeGID), int UNUSED
     int num_obj, ZOLTAN_ID_PTR UNUSED(globalID), ZOLTAN_ID_PTR UNUSED(localID),
     int *num_edges,
     ZOLTAN_ID_PTR nborGID, int *nborProc,
-    int UNUSED(wgt_dim), float *UNUSED(ewgts), int *ierr) {
+    int UNUSED(wgt_dim), float *ewgts, int *ierr) {
 
     int rank = 0;
     MPI_Comm_rank(MPI_COMM_WORLD, & rank);
@@ -136,6 +136,7 @@ static void sst_zoltan_get_edge_list(void *data, int UNUSED(sizeGID), int UNUSED
 
         ZOLTAN_ID_PTR next_nbor_entry = nborGID;
         int* next_proc_entry = nborProc;
+        float* next_wgt_entry = ewgts;
 
         for(int i = 0; i < num_obj; ++i) {
             int this_comp_links = num_edges[i];
@@ -152,9 +153,11 @@ static void sst_zoltan_get_edge_list(void *data, int UNUSED(sizeGID), int UNUSED
                 if(map_itr->component[0] == (ComponentId_t) i) {
                     next_nbor_entry[0] = (int) map_itr->component[1];
                     next_proc_entry[0] = (int) 0;
+                    next_wgt_entry[0] = map_itr->weight;
 
                     next_proc_entry++;
                     next_nbor_entry++;
+                    next_wgt_entry++;
                     this_comp_links--;
                 }
             }
@@ -216,6 +219,7 @@ void SSTZoltanPartition::initZoltan() {
     Zoltan_Set_Param(zolt_config, "CHECK_GRAPH", "2");
     Zoltan_Set_Param(zolt_config, "PHG_EDGE_SIZE_THRESHOLD", ".35");
     Zoltan_Set_Param(zolt_config, "OBJ_WEIGHT_DIM", "1");
+    Zoltan_Set_Param(zolt_config, "EDGE_WEIGHT_DIM", "1");
 
     partOutput->verbose(CALL_INFO, 1, 0, "Completed initialization of Zoltan interface.\n");
 }
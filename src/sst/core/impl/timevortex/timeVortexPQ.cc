@@ -17,6 +17,7 @@
 #include "sst/core/output.h"
 
 #include "sst/core/clock.h"
+#include "sst/core/memuse.h"
 #include "sst/core/simulation.h"
 
 namespace SST {
@@ -51,6 +52,7 @@ int TimeVortexPQ::size()
 
 void TimeVortexPQ::insert(Activity* activity)
 {
+    SST_MEM_ACCOUNTING_SCOPE(TIME_VORTEX);
     activity->setQueueOrder(insertOrder++);
     data.push(activity);
     current_depth++;
@@ -36,6 +36,11 @@ public:
         ser & count;
     }
 
+    void* getTrivialSyncData(size_t& size) override {
+        size = sizeof(count);
+        return &count;
+    }
+
     ImplementSerializable(SST::Interfaces::TestEvent);
 };
 
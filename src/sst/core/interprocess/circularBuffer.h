@@ -12,12 +12,46 @@
 #ifndef SST_CORE_INTERPROCESS_CIRCULARBUFFER_H
 #define SST_CORE_INTERPROCESS_CIRCULARBUFFER_H
 
+/*
+ * This may be compiled into both SST and an Intel Pin3 tool (via
+ * tunneldef.h), so it sticks to the same restrictions: no RTTI and no
+ * c++11.  Atomics are done with the GCC __atomic builtins.
+ */
+
+#include <cstdio>
+#include <cstddef>
+#include <inttypes.h>
+
 #include "sstmutex.h"
 
+#if defined(__linux__)
+#include <sys/syscall.h>
+#include <linux/futex.h>
+#include <unistd.h>
+#if defined(SYS_futex)
+#define SST_CORE_INTERPROCESS_HAVE_FUTEX 1
+#endif
+#endif
+
 namespace SST {
 namespace Core {
 namespace Interprocess {
 
+#define SST_CORE_INTERPROCESS_CACHE_LINE 64
+
+/**
+ * Single-producer / single-consumer ring buffer living in shared memory.
+ *
+ * The producer only ever writes writeIndex and the consumer only ever
+ * writes readIndex, so no lock is needed.  The two indices (and the
+ * wake-up words each side uses) are kept on separate cache lines to
+ * avoid false sharing between the two processes.
+ *
+ * By default a blocked reader or writer spins with
+ * SSTMutex::processorPause().  If setBlockingWait(true) has been called,
+ * a side that has spun for a while instead sleeps on a futex until the
+ * other side makes progress (Linux only; elsewhere it keeps spinning).
+ */
 template <typename T>
 class CircularBuffer {
 
@@ -26,6 +60,11 @@ public:
         buffSize = mSize;
         readIndex = 0;
         writeIndex = 0;
+        blockingWait = 0;
+        dataSeq = 0;
+        readerWaiting = 0;
+        spaceSeq = 0;
+        writerWaiting = 0;
     }
 
     bool setBufferSize(const size_t bufferSize) {
@@ -39,58 +78,119 @@ public:
         return true;
     }
 
+    /** Allow a blocked reader/writer to sleep on a futex instead of
+     * spinning forever.  Should be set by the creator of the buffer
+     * before any traffic flows. */
+    void setBlockingWait(bool enable) {
+        __atomic_store_n(&blockingWait, enable ? 1 : 0, __ATOMIC_SEQ_CST);
+    }
+
+    /** Consumer side: blocks until a message is available */
     T read() {
         int loop_counter = 0;
 
         while( true ) {
-            bufferMutex.lock();
-
-            if( readIndex != writeIndex ) {
-                const T result = buffer[readIndex];
-                readIndex = (readIndex + 1) % buffSize;
-
-                bufferMutex.unlock();
+            size_t rIdx = __atomic_load_n(&readIndex, __ATOMIC_RELAXED);
+            if( rIdx != __atomic_load_n(&writeIndex, __ATOMIC_ACQUIRE) ) {
+                const T result = buffer[rIdx];
+                __atomic_store_n(&readIndex, advance(rIdx, 1), __ATOMIC_RELEASE);
+                notifyWriter();
                 return result;
             }
 
-            bufferMutex.unlock();
-            bufferMutex.processorPause(loop_counter++);
+            waitForData(loop_counter++);
         }
     }
 
+    /** Consumer side: non-blocking read of a single message */
     bool readNB(T* result) {
-        if( bufferMutex.try_lock() ) {
-            if( readIndex != writeIndex ) {
-                *result = buffer[readIndex];
-                readIndex = (readIndex + 1) % buffSize;
+        size_t rIdx = __atomic_load_n(&readIndex, __ATOMIC_RELAXED);
+        if( rIdx == __atomic_load_n(&writeIndex, __ATOMIC_ACQUIRE) )
+            return false;
 
-                bufferMutex.unlock();
-                return true;
-            }
+        *result = buffer[rIdx];
+        __atomic_store_n(&readIndex, advance(rIdx, 1), __ATOMIC_RELEASE);
+        notifyWriter();
+        return true;
+    }
+
+    /** Consumer side: non-blocking read of up to maxCount messages
+     * @return number of messages copied into results
+     */
+    size_t readMany(T* results, size_t maxCount) {
+        size_t rIdx = __atomic_load_n(&readIndex, __ATOMIC_RELAXED);
+        const size_t wIdx = __atomic_load_n(&writeIndex, __ATOMIC_ACQUIRE);
 
-            bufferMutex.unlock();
+        size_t count = 0;
+        while ( count < maxCount && rIdx != wIdx ) {
+            /* Copy the contiguous run up to the wrap point or writer */
+            size_t end = (wIdx > rIdx) ? wIdx : buffSize;
+            size_t n = end - rIdx;
+            if ( n > maxCount - count ) n = maxCount - count;
+            for ( size_t i = 0 ; i < n ; i++ )
+                results[count + i] = buffer[rIdx + i];
+            count += n;
+            rIdx = advance(rIdx, n);
         }
 
-        return false;
+        if ( count > 0 ) {
+            __atomic_store_n(&readIndex, rIdx, __ATOMIC_RELEASE);
+            notifyWriter();
+        }
+        return count;
     }
 
+    /** Producer side: blocks until space is available */
     void write(const T& v) {
         int loop_counter = 0;
 
         while( true ) {
-            bufferMutex.lock();
+            size_t wIdx = __atomic_load_n(&writeIndex, __ATOMIC_RELAXED);
+            size_t next = advance(wIdx, 1);
+            if( next != __atomic_load_n(&readIndex, __ATOMIC_ACQUIRE) ) {
+                buffer[wIdx] = v;
+                __atomic_store_n(&writeIndex, next, __ATOMIC_RELEASE);
+                notifyReader();
+                return;
+            }
 
-            if( ((writeIndex + 1) % buffSize) != readIndex ) {
-                buffer[writeIndex] = v;
-                writeIndex = (writeIndex + 1) % buffSize;
+            waitForSpace(loop_counter++);
+        }
+    }
 
-                __sync_synchronize();
-                bufferMutex.unlock();
-                return;
+    /** Producer side: writes count messages, publishing them to the
+     * reader in as few batches as the free space allows.  Blocks until
+     * all messages have been placed in the buffer. */
+    void writeMany(const T* values, size_t count) {
+        int loop_counter = 0;
+
+        while ( count > 0 ) {
+            size_t wIdx = __atomic_load_n(&writeIndex, __ATOMIC_RELAXED);
+            const size_t rIdx = __atomic_load_n(&readIndex, __ATOMIC_ACQUIRE);
+
+            /* One slot is always left empty to tell full from empty */
+            size_t space = (rIdx > wIdx) ? (rIdx - wIdx - 1) : (buffSize - wIdx + rIdx - 1);
+            if ( space == 0 ) {
+                waitForSpace(loop_counter++);
+                continue;
+            }
+            loop_counter = 0;
+
+            size_t n = (count < space) ? count : space;
+            size_t written = 0;
+            while ( written < n ) {
+                size_t run = buffSize - wIdx;
+                if ( run > n - written ) run = n - written;
+                for ( size_t i = 0 ; i < run ; i++ )
+                    buffer[wIdx + i] = values[written + i];
+                written += run;
+                wIdx = advance(wIdx, run);
             }
 
-            bufferMutex.unlock();
-            bufferMutex.processorPause(loop_counter++);
+            __atomic_store_n(&writeIndex, wIdx, __ATOMIC_RELEASE);
+            notifyReader();
+            values += n;
+            count -= n;
         }
     }
 
@@ -98,18 +198,123 @@ public:
 
     }
 
+    /** Consumer side: discard all messages currently in the buffer */
     void clearBuffer() {
-        bufferMutex.lock();
-        readIndex = writeIndex;
-        __sync_synchronize();
-        bufferMutex.unlock();
+        __atomic_store_n(&readIndex, __atomic_load_n(&writeIndex, __ATOMIC_ACQUIRE), __ATOMIC_SEQ_CST);
+        notifyWriter();
     }
 
 private:
-    SSTMutex bufferMutex;
+    size_t advance(size_t idx, size_t n) const {
+        idx += n;
+        return (idx >= buffSize) ? idx - buffSize : idx;
+    }
+
+    bool hasData() {
+        return __atomic_load_n(&readIndex, __ATOMIC_SEQ_CST) != __atomic_load_n(&writeIndex, __ATOMIC_SEQ_CST);
+    }
+
+    bool hasSpace() {
+        return advance(__atomic_load_n(&writeIndex, __ATOMIC_SEQ_CST), 1) != __atomic_load_n(&readIndex, __ATOMIC_SEQ_CST);
+    }
+
+    /*
+     * Sleep protocol: the waiter publishes its waiting flag and then
+     * re-checks the indices; the notifier publishes its index and then
+     * checks the flag.  Both sides use sequentially consistent operations
+     * so at least one of them sees the other's store.  The sequence word
+     * is bumped before the wake so a wait that races with it returns
+     * immediately.
+     */
+    void waitForData(int loop_counter) {
+#ifdef SST_CORE_INTERPROCESS_HAVE_FUTEX
+        if ( loop_counter >= 256 && __atomic_load_n(&blockingWait, __ATOMIC_RELAXED) ) {
+            uint32_t seq = __atomic_load_n(&dataSeq, __ATOMIC_SEQ_CST);
+            __atomic_store_n(&readerWaiting, 1, __ATOMIC_SEQ_CST);
+            if ( !hasData() )
+                futexWait(&dataSeq, seq);
+            __atomic_store_n(&readerWaiting, 0, __ATOMIC_RELAXED);
+            return;
+        }
+#endif
+        pauser.processorPause(loop_counter);
+    }
+
+    void waitForSpace(int loop_counter) {
+#ifdef SST_CORE_INTERPROCESS_HAVE_FUTEX
+        if ( loop_counter >= 256 && __atomic_load_n(&blockingWait, __ATOMIC_RELAXED) ) {
+            uint32_t seq = __atomic_load_n(&spaceSeq, __ATOMIC_SEQ_CST);
+            __atomic_store_n(&writerWaiting, 1, __ATOMIC_SEQ_CST);
+            if ( !hasSpace() )
+                futexWait(&spaceSeq, seq);
+            __atomic_store_n(&writerWaiting, 0, __ATOMIC_RELAXED);
+            return;
+        }
+#endif
+        pauser.processorPause(loop_counter);
+    }
+
+    void notifyReader() {
+#ifdef SST_CORE_INTERPROCESS_HAVE_FUTEX
+        if ( !__atomic_load_n(&blockingWait, __ATOMIC_RELAXED) )
+            return;
+        __atomic_thread_fence(__ATOMIC_SEQ_CST);
+        if ( __atomic_load_n(&readerWaiting, __ATOMIC_RELAXED) ) {
+            __atomic_add_fetch(&dataSeq, 1, __ATOMIC_SEQ_CST);
+            futexWake(&dataSeq);
+        }
+#endif
+    }
+
+    void notifyWriter() {
+#ifdef SST_CORE_INTERPROCESS_HAVE_FUTEX
+        if ( !__atomic_load_n(&blockingWait, __ATOMIC_RELAXED) )
+            return;
+        __atomic_thread_fence(__ATOMIC_SEQ_CST);
+        if ( __atomic_load_n(&writerWaiting, __ATOMIC_RELAXED) ) {
+            __atomic_add_fetch(&spaceSeq, 1, __ATOMIC_SEQ_CST);
+            futexWake(&spaceSeq);
+        }
+#endif
+    }
+
+#ifdef SST_CORE_INTERPROCESS_HAVE_FUTEX
+    /* Shared (not FUTEX_PRIVATE) futexes, since the buffer lives in a
+     * region mapped by several processes.  The timeout bounds how long a
+     * waiter sleeps should the peer process go away. */
+    static void futexWait(volatile uint32_t* addr, uint32_t expected) {
+        struct timespec timeout;
+        timeout.tv_sec = 0;
+        timeout.tv_nsec = 1000000;
+        syscall(SYS_futex, addr, FUTEX_WAIT, expected, &timeout, NULL, 0);
+    }
+
+    static void futexWake(volatile uint32_t* addr) {
+        syscall(SYS_futex, addr, FUTEX_WAKE, 1, NULL, NULL, 0);
+    }
+#endif
+
+    /* Read-mostly configuration */
     size_t buffSize;
-    size_t readIndex;
-    size_t writeIndex;
+    volatile uint32_t blockingWait;
+    SSTMutex pauser;  // only used for its backoff policy
+    char pad0[SST_CORE_INTERPROCESS_CACHE_LINE];
+
+    /* Consumer-owned */
+    volatile size_t readIndex;
+    volatile uint32_t spaceSeq;
+    char pad1[SST_CORE_INTERPROCESS_CACHE_LINE];
+
+    /* Producer-owned */
+    volatile size_t writeIndex;
+    volatile uint32_t dataSeq;
+    char pad2[SST_CORE_INTERPROCESS_CACHE_LINE];
+
+    /* Waiting flags: written by the waiter, polled by the notifier */
+    volatile uint32_t readerWaiting;
+    volatile uint32_t writerWaiting;
+    char pad3[SST_CORE_INTERPROCESS_CACHE_LINE];
+
     T buffer[0];
 
 };
@@ -222,6 +222,23 @@ public:
         return circBuffs[buffer]->readNB(result);
     }
 
+    /** Blocks until all count messages have been written **/
+    void writeMessages(size_t core, const MsgType* commands, size_t count) {
+        circBuffs[core]->writeMany(commands, count);
+    }
+
+    /** Non-blocking batch read; returns the number of messages read **/
+    size_t readMessagesNB(size_t buffer, MsgType* results, size_t maxCount) {
+        return circBuffs[buffer]->readMany(results, maxCount);
+    }
+
+    /** Sleep instead of spin when a buffer is empty or full **/
+    void setBlockingWait(bool enable) {
+        for ( CircBuff_t *cb : circBuffs ) {
+            cb->setBlockingWait(enable);
+        }
+    }
+
     /** Empty the messages in the buffer **/
     void clearBuffer(size_t core) {
        circBuffs[core]->clearBuffer();
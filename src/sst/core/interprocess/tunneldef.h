@@ -187,6 +187,34 @@ public:
         return circBuffs[buffer]->readNB(result);
     }
 
+    /** Write a batch of messages to a buffer, blocks until all are written
+     * @param buffer which buffer index to write to
+     * @param commands array of messages to write
+     * @param count number of messages in commands
+     */
+    void writeMessages(size_t buffer, const MsgType* commands, size_t count) {
+        circBuffs[buffer]->writeMany(commands, count);
+    }
+
+    /** Read a batch of messages from a buffer, non-blocking
+     * @param buffer which buffer to read from
+     * @param results array to return read messages in
+     * @param maxCount capacity of results
+     * return number of messages read
+     */
+    size_t readMessagesNB(size_t buffer, MsgType* results, size_t maxCount) {
+        return circBuffs[buffer]->readMany(results, maxCount);
+    }
+
+    /** Let blocked readers and writers sleep instead of spin
+     * @param enable whether to use blocking waits on all buffers
+     */
+    void setBlockingWait(bool enable) {
+        for (size_t i = 0; i < circBuffs.size(); i++) {
+            circBuffs[i]->setBlockingWait(enable);
+        }
+    }
+
     /** Empty the messages in a buffer
      * @param buffer which buffer to empty
      */
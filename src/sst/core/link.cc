@@ -17,6 +17,8 @@
 
 #include "sst/core/event.h"
 #include "sst/core/initQueue.h"
+#include "sst/core/linkTelemetry.h"
+#include "sst/core/memuse.h"
 #include "sst/core/pollingLinkQueue.h"
 #include "sst/core/simulation.h"
 #include "sst/core/timeConverter.h"
@@ -39,7 +41,8 @@ Link::Link(LinkId_t id) :
     latency(1),
     type(HANDLER),
     id(id),
-    configured(false)
+    configured(false),
+    telemetry(nullptr)
 {
     recvQueue = uninitQueue;
     untimedQueue = nullptr;
@@ -52,7 +55,8 @@ Link::Link() :
     latency(1),
     type(HANDLER),
     id(-1),
-    configured(false)
+    configured(false),
+    telemetry(nullptr)
 {
     recvQueue = uninitQueue;
     untimedQueue = nullptr;
@@ -133,7 +137,10 @@ void Link::send( SimTime_t delay, TimeConverter* tc, Event* event ) {
     event->addRecvComponent(pair_link->comp, pair_link->ctype, pair_link->port);
 #endif
 
+    if ( UNLIKELY(nullptr != telemetry) ) Core::Profile::LinkTelemetry::record(telemetry);
+
     // trace.getOutput().output(CALL_INFO, "%p\n",pair_link->recvQueue);
+    SST_MEM_ACCOUNTING_SCOPE(LINKS);
     pair_link->recvQueue->insert( event );
 }
 
@@ -161,6 +168,7 @@ Event* Link::recv()
 
 void Link::sendUntimedData(Event* data)
 {
+    SST_MEM_ACCOUNTING_SCOPE(LINKS);
     if ( pair_link->untimedQueue == nullptr ) {
         pair_link->untimedQueue = new InitQueue();
     }
@@ -177,6 +185,7 @@ void Link::sendUntimedData(Event* data)
 
 void Link::sendUntimedData_sync(Event* data)
 {
+    SST_MEM_ACCOUNTING_SCOPE(LINKS);
     if ( pair_link->untimedQueue == nullptr ) {
         pair_link->untimedQueue = new InitQueue();
     }
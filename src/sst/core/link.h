@@ -27,6 +27,11 @@ class ActivityQueue;
 class SyncBase;
 
 class UnitAlgebra;
+namespace Core {
+namespace Profile {
+    struct LinkCounter;
+}
+}
 
   /** Link between two components. Carries events */
 class Link {
@@ -40,6 +45,7 @@ public:
     friend class SyncBase;
     friend class ThreadSync;
     friend class SyncManager;
+    friend class SyncQueue;
     friend class ComponentInfo;
 
     /** Create a new link with a given ID */
@@ -215,6 +221,9 @@ private:
     LinkId_t id;
     bool configured;
 
+    /** Traffic counter; only set with --output-partition-weights */
+    Core::Profile::LinkCounter* telemetry;
+
 #ifdef __SST_DEBUG_EVENT_TRACKING__
     std::string comp;
     std::string ctype;
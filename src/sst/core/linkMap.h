@@ -16,127 +16,129 @@
 
 #include <string>
 #include <map>
+#include <unordered_map>
+#include <vector>
 
 #include "sst/core/component.h"
 #include "sst/core/link.h"
 
 namespace SST {
 
+/**
+ * Interns the port names used by one component type.  Each distinct
+ * name is given a small dense index, so the LinkMap of every component
+ * of that type can store its links in a flat array indexed by port
+ * instead of keeping its own string-keyed tree.
+ *
+ * Tables are owned by the Simulation (one set per thread), so they are
+ * only ever accessed by a single thread and need no locking.
+ */
+class PortTable {
+
+public:
+    static const uint32_t npos = UINT32_MAX;
+
+    PortTable() {}
+
+    /** Returns the index for name, adding it to the table if it is new */
+    uint32_t intern(const std::string& name) {
+        auto res = indices.emplace(name, (uint32_t)names.size());
+        if ( res.second ) names.push_back(&res.first->first);
+        return res.first->second;
+    }
+
+    /** Returns the index for name, or npos if the name is unknown */
+    uint32_t find(const std::string& name) const {
+        auto it = indices.find(name);
+        if ( it == indices.end() ) return npos;
+        return it->second;
+    }
+
+    /** Returns the name interned at index */
+    const std::string& getName(uint32_t index) const {
+        return *names[index];
+    }
+
+    size_t size() const { return names.size(); }
+
+private:
+    PortTable(const PortTable&) = delete;
+    PortTable& operator=(const PortTable&) = delete;
+
+    std::unordered_map<std::string,uint32_t> indices;
+    // Points at the keys in indices, which never move
+    std::vector<const std::string*> names;
+};
+
+
 /**
  * Maps port names to the Links that are connected to it
  */
 class LinkMap {
 
 private:
-    std::map<std::string,Link*> linkMap;
-    // const std::vector<std::string> * allowedPorts;
-    std::vector<std::string> selfPorts;
-
-    // bool checkPort(const char *def, const char *offered) const
-    // {
-    //     const char * x = def;
-    //     const char * y = offered;
-
-    //     /* Special case.  Name of '*' matches everything */
-    //     if ( *x == '*' && *(x+1) == '\0' ) return true;
-
-    //     do {
-    //         if ( *x == '%' && (*(x+1) == '(' || *(x+1) == 'd') ) {
-    //             // We have a %d or %(var)d to eat
-    //             x++;
-    //             if ( *x == '(' ) {
-    //                 while ( *x && (*x != ')') ) x++;
-    //                 x++;  /* *x should now == 'd' */
-    //             }
-    //             if ( *x != 'd') /* Malformed string.  Fail all the things */
-    //                 return false;
-    //             x++; /* Finish eating the variable */
-    //             /* Now, eat the corresponding digits of y */
-    //             while ( *y && isdigit(*y) ) y++;
-    //         }
-    //         if ( *x != *y ) return false;
-    //         if ( *x == '\0' ) return true;
-    //         x++;
-    //         y++;
-    //     } while ( *x && *y );
-    //     if ( *x != *y ) return false; // aka, both nullptr
-    //     return true;
-    // }
-
-    // bool checkPort(const std::string& name) const
-    // {
-    //     // First check to see if this is a self port
-    //     for ( std::vector<std::string>::const_iterator i = selfPorts.begin() ; i != selfPorts.end() ; ++i ) {
-    //         /* Compare name with stored name, which may have wildcards */
-    //         // if ( checkPort(i->c_str(), x) ) {
-    //         if ( name == *i ) {
-    //             return true;
-    //         }
-    //     }
-
-    //     // If no a self port, check against info in library manifest
-    //     Component::isValidPortForComponent(
-    //     const char *x = name.c_str();
-    //     bool found = false;
-    //     if ( nullptr != allowedPorts ) {
-    //         for ( std::vector<std::string>::const_iterator i = allowedPorts->begin() ; i != allowedPorts->end() ; ++i ) {
-    //             /* Compare name with stored name, which may have wildcards */
-    //             if ( checkPort(i->c_str(), x) ) {
-    //                 found = true;
-    //                 break;
-    //             }
-    //         }
-    //     }
-    //     return found;
-    // }
-
-    // bool checkPort(const std::string& name) const
-    // {
-    //     const char *x = name.c_str();
-    //     bool found = false;
-    //     if ( nullptr != allowedPorts ) {
-    //         for ( std::vector<std::string>::const_iterator i = allowedPorts->begin() ; i != allowedPorts->end() ; ++i ) {
-    //             /* Compare name with stored name, which may have wildcards */
-    //             if ( checkPort(i->c_str(), x) ) {
-    //                 found = true;
-    //                 break;
-    //             }
-    //         }
-    //     }
-
-    //     if ( !found ) { // Check self ports
-    //         for ( std::vector<std::string>::const_iterator i = selfPorts.begin() ; i != selfPorts.end() ; ++i ) {
-    //             /* Compare name with stored name, which may have wildcards */
-    //             // if ( checkPort(i->c_str(), x) ) {
-    //             if ( name == *i ) {
-    //                 found = true;
-    //                 break;
-    //             }
-    //         }
-    //     }
-
-    //     return found;
-    // }
+    PortTable* ports;
+    bool ownPorts;
+    // Indexed by the port's index in the PortTable
+    std::vector<Link*> links;
+    size_t numLinks;
+    std::vector<uint32_t> selfPorts;
+    // Only filled in by the deprecated getLinkMap()
+    std::map<std::string,Link*> legacyMap;
+
+    Link* getLinkByIndex(uint32_t index) const {
+        if ( index >= links.size() ) return nullptr;
+        return links[index];
+    }
 
 public:
-    LinkMap() /*: allowedPorts(nullptr)*/ {}
-    ~LinkMap() {
-        // Delete all the links in the map
-        for ( std::map<std::string,Link*>::iterator it = linkMap.begin(); it != linkMap.end(); ++it ) {
-            delete it->second;
+    /**
+     * Iterates over the connected ports as (name, Link*) pairs, in the
+     * order the port names were interned
+     */
+    class const_iterator {
+    public:
+        const_iterator(const LinkMap* map, size_t index) : map(map), index(index) { skipEmpty(); }
+
+        std::pair<const std::string&, Link*> operator*() const {
+            return std::pair<const std::string&, Link*>(map->ports->getName(index), map->links[index]);
         }
-        linkMap.clear();
-    }
 
-    // /**
-    //  * Set the list of allowed port names from the ElementInfoPort
-    //  */
-    // void setAllowedPorts(const std::vector<std::string> *p)
-    // {
-    //     allowedPorts = p;
-    // }
+        const_iterator& operator++() {
+            ++index;
+            skipEmpty();
+            return *this;
+        }
 
+        bool operator==(const const_iterator& o) const { return index == o.index; }
+        bool operator!=(const const_iterator& o) const { return index != o.index; }
 
+    private:
+        void skipEmpty() {
+            while ( index < map->links.size() && map->links[index] == nullptr ) ++index;
+        }
+
+        const LinkMap* map;
+        size_t index;
+    };
+
+    /**
+     * Create a LinkMap whose port names are interned in ports, which
+     * is normally shared with all other components of the same type
+     */
+    LinkMap(PortTable* ports) : ports(ports), ownPorts(false), numLinks(0) {}
+
+    /** Create a LinkMap with its own private PortTable */
+    LinkMap() : ports(new PortTable()), ownPorts(true), numLinks(0) {}
+
+    ~LinkMap() {
+        // Delete all the links in the map
+        for ( Link* link : links ) {
+            delete link;
+        }
+        links.clear();
+        if ( ownPorts ) delete ports;
+    }
 
     /**
      * Add a port name to the list of allowed ports.
@@ -144,54 +146,70 @@ public:
      */
     void addSelfPort(const std::string& name)
     {
-        selfPorts.push_back(name);
+        selfPorts.push_back(ports->intern(name));
     }
 
     bool isSelfPort(const std::string& name) const {
-        for ( std::vector<std::string>::const_iterator i = selfPorts.begin() ; i != selfPorts.end() ; ++i ) {
-            /* Compare name with stored name, which may have wildcards */
-            // if ( checkPort(i->c_str(), x) ) {
-            if ( name == *i ) {
-                return true;
-            }
+        uint32_t index = ports->find(name);
+        if ( index == PortTable::npos ) return false;
+        for ( uint32_t i : selfPorts ) {
+            if ( i == index ) return true;
         }
         return false;
     }
 
-    /** Inserts a new pair of name and link into the map */
+    /** Inserts a new pair of name and link into the map.  As with
+     * std::map::insert, an existing entry for name is left in place. */
     void insertLink(const std::string& name, Link* link) {
-        linkMap.insert(std::pair<std::string,Link*>(name,link));
+        uint32_t index = ports->intern(name);
+        if ( index >= links.size() ) links.resize(index + 1, nullptr);
+        if ( links[index] == nullptr ) {
+            links[index] = link;
+            numLinks++;
+        }
     }
 
     void removeLink(const std::string& name) {
-        linkMap.erase(name);
+        uint32_t index = ports->find(name);
+        if ( getLinkByIndex(index) != nullptr ) {
+            links[index] = nullptr;
+            numLinks--;
+        }
     }
 
     /** Returns a Link pointer for a given name */
-    Link* getLink(const std::string& name) {
-//         if ( !checkPort(name) ) {
-// #ifdef USE_PARAM_WARNINGS
-//             std::cerr << "Warning:  Using undocumented port '" << name << "'." << std::endl;
-// #endif
-//         }
-        std::map<std::string,Link*>::iterator it = linkMap.find(name);
-        if ( it == linkMap.end() ) return nullptr;
-        else return it->second;
+    Link* getLink(const std::string& name) const {
+        if ( links.empty() ) return nullptr;
+        return getLinkByIndex(ports->find(name));
     }
 
     /**
        Checks to see if LinkMap is empty.
        @return True if Link map is empty, false otherwise
     */
-    bool empty() {
-        return linkMap.empty();
+    bool empty() const {
+        return numLinks == 0;
     }
 
-    // FIXME: Kludge for now, fix later.  Need to make LinkMap look
-    // like a regular map instead.
-    /** Return a reference to the internal map */
-    std::map<std::string,Link*>& getLinkMap() {
-        return linkMap;
+    /** Number of connected ports */
+    size_t size() const {
+        return numLinks;
+    }
+
+    const_iterator begin() const { return const_iterator(this, 0); }
+    const_iterator end() const { return const_iterator(this, links.size()); }
+
+    /** Return a map of the connected ports, sorted by name.  The map is
+     * a read-only snapshot built on each call: inserting into or erasing
+     * from it does not change the LinkMap.  Use getLink() or iterate over
+     * the LinkMap instead; iterating the LinkMap visits ports in the
+     * order their names were first seen, not sorted by name. */
+    std::map<std::string,Link*>& getLinkMap() __attribute__ ((deprecated("getLinkMap is deprecated and will be removed in SST 11. It now returns a read-only snapshot and changes to it are ignored. Please use getLink() or iterate over the LinkMap"))) {
+        legacyMap.clear();
+        for ( auto port : *this ) {
+            legacyMap.insert(std::make_pair(port.first, port.second));
+        }
+        return legacyMap;
     }
 
 };
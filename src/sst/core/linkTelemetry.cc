@@ -0,0 +1,164 @@
+// Copyright 2009-2020 NTESS. Under the terms
+// of Contract DE-NA0003525 with NTESS, the U.S.
+// Government retains certain rights in this software.
+//
+// Copyright (c) 2009-2020, NTESS
+// All rights reserved.
+//
+// This file is part of the SST software package. For license
+// information, see the LICENSE file in the top level directory of the
+// distribution.
+
+#include "sst_config.h"
+#include "sst/core/linkTelemetry.h"
+
+#include "sst/core/event.h"
+#include "sst/core/output.h"
+#include "sst/core/objectComms.h"
+
+#include <algorithm>
+#include <cinttypes>
+#include <fstream>
+
+namespace SST {
+namespace Core {
+namespace Profile {
+
+std::mutex LinkTelemetry::totalsMutex;
+LinkTelemetry::Totals_t LinkTelemetry::totals;
+LinkTelemetry::ComponentTotals_t LinkTelemetry::componentTotals;
+
+
+LinkTelemetry::LinkTelemetry()
+{
+    createTicks = getTicks();
+    createTime = std::chrono::steady_clock::now();
+}
+
+LinkCounter*
+LinkTelemetry::getLinkCounter(const std::string& name, Crossing crossing)
+{
+    // std::map never moves its entries, so the pointer stays valid
+    LinkInfo& info = links[name];
+    info.crossing = crossing;
+    return &info.counter;
+}
+
+Event::HandlerBase*
+LinkTelemetry::wrapEventHandler(Event::HandlerBase* handler, const std::string& component)
+{
+    if ( nullptr == handler ) return handler;
+    return new ProfiledEventHandler(handler, &components[component], nullptr);
+}
+
+void
+LinkTelemetry::registerClockHandler(Clock::HandlerBase* handler, const std::string& component)
+{
+    clockHandlers.set(handler, { &components[component] });
+}
+
+void
+LinkTelemetry::mergeThread()
+{
+    // Calibrate the same way as the RuntimeProfile
+    std::chrono::duration<double> elapsed = std::chrono::steady_clock::now() - createTime;
+    uint64_t ticks = getTicks() - createTicks;
+    double secondsPerTick = ticks > 0 ? elapsed.count() / ticks : 0.0;
+
+    std::lock_guard<std::mutex> lock(totalsMutex);
+    for ( auto& c : components ) {
+        auto& total = componentTotals[c.first];
+        total.first += c.second.ticks * secondsPerTick;
+        total.second += c.second.count;
+    }
+    for ( auto& l : links ) {
+        std::vector<uint64_t>& total = totals[l.first];
+        if ( total.empty() ) total.resize(3, 0);
+        total[0] += l.second.counter.events;
+        total[1] += l.second.counter.bytes;
+        // Both sides see the same crossing; keep the widest in case
+        total[2] = std::max<uint64_t>(total[2], l.second.crossing);
+    }
+}
+
+const char*
+LinkTelemetry::crossingName(Crossing crossing)
+{
+    switch ( crossing ) {
+    case THREAD: return "thread";
+    case RANK: return "rank";
+    default: return "local";
+    }
+}
+
+void
+LinkTelemetry::writeFile(const std::string& filename, Output& out, const RankInfo& myRank, const RankInfo& worldSize)
+{
+    Totals_t all = totals;
+    ComponentTotals_t componentCost = componentTotals;
+
+#ifdef SST_CONFIG_HAVE_MPI
+    if ( worldSize.rank > 1 ) {
+        std::vector<Totals_t> gathered;
+        Comms::all_gather(totals, gathered);
+        all.clear();
+        for ( auto& rankTotals : gathered ) {
+            for ( auto& item : rankTotals ) {
+                std::vector<uint64_t>& total = all[item.first];
+                if ( total.empty() ) total.resize(3, 0);
+                total[0] += item.second[0];
+                total[1] += item.second[1];
+                total[2] = std::max(total[2], item.second[2]);
+            }
+        }
+
+        std::vector<ComponentTotals_t> gatheredCost;
+        Comms::all_gather(componentTotals, gatheredCost);
+        componentCost.clear();
+        for ( auto& rankCost : gatheredCost ) {
+            for ( auto& item : rankCost ) {
+                componentCost[item.first].first += item.second.first;
+                componentCost[item.first].second += item.second.second;
+            }
+        }
+    }
+#else
+    (void)worldSize;
+#endif
+
+    if ( myRank.rank != 0 ) return;
+
+    std::ofstream file(filename.c_str());
+    if ( !file.is_open() ) {
+        out.fatal(CALL_INFO, 1, "Unable to open partition weights file %s for writing\n", filename.c_str());
+    }
+
+    uint64_t crossEvents = 0;
+    uint64_t crossBytes = 0;
+    file << "# SST partition weights" << std::endl;
+    file << "# link <name> <events> <bytes> <local|thread|rank>" << std::endl;
+    file << "# bytes are only measured on links that cross ranks" << std::endl;
+    file << "# component <name> <seconds> <calls>" << std::endl;
+    for ( auto& item : all ) {
+        Crossing crossing = static_cast<Crossing>(item.second[2]);
+        file << "link " << item.first << " " << item.second[0] << " " << item.second[1]
+             << " " << crossingName(crossing) << std::endl;
+        if ( crossing != LOCAL ) {
+            crossEvents += item.second[0];
+            crossBytes += item.second[1];
+        }
+    }
+    file.precision(9);
+    for ( auto& item : componentCost ) {
+        file << "component " << item.first << " " << std::fixed << item.second.first << " "
+             << item.second.second << std::endl;
+    }
+
+    out.verbose(CALL_INFO, 1, 0, "# Wrote traffic for %zu links and cost for %zu components to %s (%" PRIu64
+                " events crossed thread or rank boundaries, %" PRIu64 " bytes crossed ranks)\n", all.size(),
+                componentCost.size(), filename.c_str(), crossEvents, crossBytes);
+}
+
+} // namespace Profile
+} // namespace Core
+} // namespace SST
@@ -0,0 +1,135 @@
+// Copyright 2009-2020 NTESS. Under the terms
+// of Contract DE-NA0003525 with NTESS, the U.S.
+// Government retains certain rights in this software.
+//
+// Copyright (c) 2009-2020, NTESS
+// All rights reserved.
+//
+// This file is part of the SST software package. For license
+// information, see the LICENSE file in the top level directory of the
+// distribution.
+
+#ifndef SST_CORE_LINKTELEMETRY_H
+#define SST_CORE_LINKTELEMETRY_H
+
+#include "sst/core/sst_types.h"
+#include "sst/core/rankInfo.h"
+#include "sst/core/runtimeProfile.h"
+
+#include <chrono>
+#include <map>
+#include <mutex>
+#include <string>
+#include <vector>
+
+namespace SST {
+
+class Event;
+class Output;
+
+namespace Core {
+namespace Profile {
+
+/** Traffic sent on one link (both directions share a counter) */
+struct LinkCounter {
+    uint64_t events;
+    /** Bytes the rank sync serialized for the link, untimed data
+     * included; stays 0 for links that do not cross a rank, since their
+     * events are never serialized */
+    uint64_t bytes;
+
+    LinkCounter() : events(0), bytes(0) {}
+};
+
+/**
+ * Per-link traffic telemetry enabled with --output-partition-weights.
+ *
+ * Each Simulation (i.e. each thread) owns one LinkTelemetry and hands
+ * out a counter for every link it wires up.  Link::send() charges each
+ * event to the sending side's counter.  Events on links that cross a
+ * rank are also charged the bytes they take in the message the
+ * SyncQueue packs for the rank sync, so sizing them costs nothing
+ * extra.  Local and thread links are never serialized and report 0
+ * bytes, which is why link weights are event counts.  At the end of
+ * the run the per-thread counters are folded into rank totals,
+ * combined across ranks and written by rank 0 as a weights file that
+ * ConfigGraph::loadPartitionWeights() reads back on the next run.
+ *
+ * File format, one record per line ('#' starts a comment):
+ *   link <name> <events> <bytes> <local|thread|rank>
+ *   component <name> <seconds> <calls>
+ *
+ * The component records are the event and clock handler time of each
+ * (sub)component.  Only that time is measured, so writing the weights
+ * does not turn on the rest of the RuntimeProfile.
+ */
+class LinkTelemetry {
+public:
+    /** Which boundary, if any, the link crossed in this run */
+    enum Crossing { LOCAL = 0, THREAD, RANK };
+
+    LinkTelemetry();
+
+    /** Returns the counter for the named link.  The pointer stays
+     * valid for the life of the LinkTelemetry. */
+    LinkCounter* getLinkCounter(const std::string& name, Crossing crossing);
+
+    /** Wraps an event handler so that each delivery is charged to the
+     * component's cost.  The returned handler owns the original. */
+    Event::HandlerBase* wrapEventHandler(Event::HandlerBase* handler, const std::string& component);
+
+    /** Charge each call of a clock handler to the component's cost */
+    void registerClockHandler(Clock::HandlerBase* handler, const std::string& component);
+
+    /** Counters for the registered clock handlers, for Clock */
+    const ClockHandlerCounters* getClockHandlerCounters() const { return &clockHandlers; }
+
+    /** Charge an event to a link counter */
+    static inline void record(LinkCounter* counter) {
+        counter->events++;
+    }
+
+    /** Charge the serialized size of an event to a link counter */
+    static inline void recordBytes(LinkCounter* counter, uint64_t bytes) {
+        counter->bytes += bytes;
+    }
+
+    /** Fold this thread's counters into the rank totals */
+    void mergeThread();
+
+    /** Combine the totals across ranks and write the file on rank 0.
+     * Must be called by every rank. */
+    static void writeFile(const std::string& filename, Output& out, const RankInfo& myRank, const RankInfo& worldSize);
+
+    static const char* crossingName(Crossing crossing);
+
+private:
+    struct LinkInfo {
+        Crossing crossing;
+        LinkCounter counter;
+    };
+
+    /** name -> { events, bytes, crossing } */
+    typedef std::map<std::string, std::vector<uint64_t>> Totals_t;
+
+    /** name -> (seconds, calls) */
+    typedef std::map<std::string, std::pair<double, uint64_t>> ComponentTotals_t;
+
+    std::map<std::string, LinkInfo> links;
+    std::map<std::string, Counter> components;
+    ClockHandlerCounters clockHandlers;
+
+    /* Used to calibrate ticks against wall time */
+    uint64_t createTicks;
+    std::chrono::steady_clock::time_point createTime;
+
+    static std::mutex totalsMutex;
+    static Totals_t totals;
+    static ComponentTotals_t componentTotals;
+};
+
+} // namespace Profile
+} // namespace Core
+} // namespace SST
+
+#endif // SST_CORE_LINKTELEMETRY_H
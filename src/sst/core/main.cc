@@ -26,6 +26,7 @@ REENABLE_WARNING
 #include <iomanip>
 #include <iostream>
 #include <fstream>
+#include <sstream>
 #include <cinttypes>
 #include <signal.h>
 #include <time.h>
@@ -34,9 +35,12 @@ REENABLE_WARNING
 #include "sst/core/config.h"
 #include "sst/core/configGraph.h"
 #include "sst/core/factory.h"
+#include "sst/core/linkTelemetry.h"
 #include "sst/core/rankInfo.h"
+#include "sst/core/runtimeProfile.h"
 #include "sst/core/threadsafe.h"
 #include "sst/core/simulation.h"
+#include "sst/core/syncQueue.h"
 #include "sst/core/timeLord.h"
 #include "sst/core/timeVortex.h"
 #include "sst/core/part/sstpart.h"
@@ -46,6 +50,7 @@ REENABLE_WARNING
 
 #include "sst/core/model/sstmodel.h"
 #include "sst/core/model/python/pymodel.h"
+#include "sst/core/model/syntheticModel.h"
 #include "sst/core/memuse.h"
 #include "sst/core/iouse.h"
 
@@ -72,6 +77,39 @@ using namespace SST;
 static SST::Output g_output;
 
 
+/* Start-up is broken into phases, each timed (and its peak RSS taken)
+ * by thread 0 of every rank.  All ranks go through the same phases, so
+ * the lists line up when they are reduced at the end of the run. */
+typedef struct {
+    const char* name;
+    double seconds;
+    uint64_t peak_rss;
+    uint64_t rss_growth;
+} StartupPhase_t;
+
+static std::vector<StartupPhase_t> startup_phases;
+static double startup_phase_start;
+static uint64_t startup_phase_start_rss;
+
+static void startup_phase_begin()
+{
+    startup_phase_start = sst_get_cpu_time();
+    startup_phase_start_rss = processMaxMemSize();
+}
+
+/* Ends the current phase and starts the next one */
+static void startup_phase_end(const char* name)
+{
+    StartupPhase_t phase;
+    phase.name = name;
+    phase.seconds = sst_get_cpu_time() - startup_phase_start;
+    phase.peak_rss = processMaxMemSize();
+    phase.rss_growth = phase.peak_rss - startup_phase_start_rss;
+    startup_phases.push_back(phase);
+    startup_phase_begin();
+}
+
+
 
 static void
 SimulationSigHandler(int sig)
@@ -153,6 +191,15 @@ static void dump_partition(Config& cfg, ConfigGraph* graph, const RankInfo &size
     }
 }
 
+/* Add the element libraries of a component and its subcomponents */
+static void addLibraryNames(const ConfigComponent& comp, std::set<std::string>& lib_names)
+{
+    lib_names.insert(comp.type.substr(0, comp.type.find('.')));
+    for ( auto& sub : comp.subComponents ) {
+        addLibraryNames(sub, lib_names);
+    }
+}
+
 static void do_graph_wireup(ConfigGraph* graph,
         SST::Simulation* sim,
         const RankInfo &myRank, SimTime_t min_part) {
@@ -212,6 +259,11 @@ typedef struct {
     uint64_t current_tv_depth;
     uint64_t sync_data_size;
 
+    // Memory by subsystem at points of the run, and the RSS returned
+    // to the OS by releasing the graph (thread 0 only)
+    std::vector<MemAccounting::Snapshot> mem_snapshots;
+    uint64_t graph_release_rss;
+
 } SimThreadInfo_t;
 
 void finalize_statEngineConfig(void)
@@ -219,6 +271,23 @@ void finalize_statEngineConfig(void)
     StatisticProcessingEngine::getInstance()->finalizeInitialization();
 }
 
+// Deletes the graph once every thread is wired up.  Each thread has
+// already freed the configuration of the components it built, so
+// what is left is mostly the component and link tables.  Called by
+// thread 0 only.
+static void release_graph(SimThreadInfo_t &info)
+{
+    {
+        MemAccounting::Scope scope(MemAccounting::CONFIG_GRAPH);
+        delete info.graph;
+        info.graph = nullptr;
+    }
+    releaseFreeMemory();
+    info.mem_snapshots.push_back(MemAccounting::snapshot("after release"));
+    uint64_t before = info.mem_snapshots[1].rss, after = info.mem_snapshots[2].rss;
+    info.graph_release_rss = before > after ? before - after : 0;
+}
+
 static void start_simulation(uint32_t tid, SimThreadInfo_t &info, Core::ThreadSafe::Barrier &barrier)
 {
     info.myRank.thread = tid;
@@ -233,14 +302,20 @@ static void start_simulation(uint32_t tid, SimThreadInfo_t &info, Core::ThreadSa
     SST::Simulation* sim = Simulation::createSimulation(info.config, info.myRank, info.world_size, info.min_part);
 
     barrier.wait();
+    if ( tid == 0 ) startup_phase_end("Create simulation");
 
     sim->processGraphInfo( *info.graph, info.myRank, info.min_part );
 
     barrier.wait();
+    if ( tid == 0 ) {
+        startup_phase_end("Process graph info");
+        info.mem_snapshots.push_back(MemAccounting::snapshot("before wire-up"));
+    }
 
     // Perform the wireup.  Do this one thread at a time for now.  If
     // this ever changes, then need to put in some serialization into
-    // performWireUp.
+    // performWireUp.  The threads must also go in order, since each
+    // thread frees the graph data that no later thread will use.
     for ( uint32_t i = 0; i < info.world_size.thread; ++i ) {
         if ( i == info.myRank.thread ) {
             // g_output.output("wiring up this thread %u\n", info.myRank.thread);
@@ -248,10 +323,12 @@ static void start_simulation(uint32_t tid, SimThreadInfo_t &info, Core::ThreadSa
         }
         barrier.wait();
     }
+    if ( tid == 0 ) startup_phase_end("Wire-up");
 
     if ( tid == 0 ) {
+        info.mem_snapshots.push_back(MemAccounting::snapshot("after wire-up"));
         finalize_statEngineConfig();
-        delete info.graph;
+        release_graph(info);
     }
 
     double start_run = sst_get_cpu_time();
@@ -263,6 +340,7 @@ static void start_simulation(uint32_t tid, SimThreadInfo_t &info, Core::ThreadSa
     }
 #endif
     barrier.wait();
+    if ( tid == 0 ) startup_phase_end("Release graph");
 
     if ( info.config->runMode == Simulation::RUN || info.config->runMode == Simulation::BOTH ) {
         if ( info.config->verbose && 0 == tid ) {
@@ -320,13 +398,16 @@ static void start_simulation(uint32_t tid, SimThreadInfo_t &info, Core::ThreadSa
 #endif
         }
         barrier.wait();
+        if ( tid == 0 ) startup_phase_end("Prepare run");
 
         sim->initialize();
         barrier.wait();
+        if ( tid == 0 ) startup_phase_end("Initialize");
 
         /* Run Set */
         sim->setup();
         barrier.wait();
+        if ( tid == 0 ) startup_phase_end("Setup");
 
         /* Run Simulation */
         sim->run();
@@ -340,6 +421,7 @@ static void start_simulation(uint32_t tid, SimThreadInfo_t &info, Core::ThreadSa
     }
 
     barrier.wait();
+    if ( tid == 0 ) info.mem_snapshots.push_back(MemAccounting::snapshot("end of run"));
 
     info.simulated_time = sim->getFinalSimTime();
     // g_output.output(CALL_INFO,"Simulation time = %s\n",info.simulated_time.toStringBestSI().c_str());
@@ -354,6 +436,50 @@ static void start_simulation(uint32_t tid, SimThreadInfo_t &info, Core::ThreadSa
 
 }
 
+/* Reduce the start-up phases across ranks (max time and RSS) and print
+ * them on rank 0.  Must be called by every rank. */
+static void print_startup_phases(const RankInfo& myRank, const RankInfo& world_size, bool print)
+{
+    size_t count = startup_phases.size();
+    std::vector<double> seconds(count);
+    std::vector<uint64_t> rss(2 * count);
+    for ( size_t i = 0 ; i < count ; i++ ) {
+        seconds[i] = startup_phases[i].seconds;
+        rss[2 * i] = startup_phases[i].peak_rss;
+        rss[2 * i + 1] = startup_phases[i].rss_growth;
+    }
+
+#ifdef SST_CONFIG_HAVE_MPI
+    if ( world_size.rank > 1 && count > 0 ) {
+        std::vector<double> max_seconds(count);
+        std::vector<uint64_t> max_rss(2 * count);
+        MPI_Allreduce(seconds.data(), max_seconds.data(), count, MPI_DOUBLE, MPI_MAX, MPI_COMM_WORLD);
+        MPI_Allreduce(rss.data(), max_rss.data(), 2 * count, MPI_UINT64_T, MPI_MAX, MPI_COMM_WORLD);
+        seconds.swap(max_seconds);
+        rss.swap(max_rss);
+    }
+#else
+    (void)world_size;
+#endif
+
+    if ( myRank.rank != 0 || !print ) return;
+
+    g_output.output( "Startup Phase Information (max over ranks):\n");
+    g_output.output( "  %-28s %12s %14s %14s\n", "Phase", "Time (s)", "Peak RSS", "RSS growth");
+    for ( size_t i = 0 ; i < count ; i++ ) {
+        char ua_buffer[256];
+        sprintf(ua_buffer, "%" PRIu64 "KB", rss[2 * i]);
+        UnitAlgebra peak_ua(ua_buffer);
+        sprintf(ua_buffer, "%" PRIu64 "KB", rss[2 * i + 1]);
+        UnitAlgebra growth_ua(ua_buffer);
+        g_output.output( "  %-28s %12.6f %14s %14s\n", startup_phases[i].name, seconds[i],
+                peak_ua.toStringBestSI().c_str(), growth_ua.toStringBestSI().c_str());
+    }
+    g_output.output( "------------------------------------------------------------\n");
+    g_output.output( "\n" );
+    g_output.output( "\n" );
+}
+
 int
 main(int argc, char *argv[])
 {
@@ -383,7 +509,14 @@ main(int argc, char *argv[])
 
     SSTModelDescription* modelGen = nullptr;
 
-    if ( cfg.configFile != "NONE" ) {
+    if ( !cfg.synthetic_model.empty() ) {
+        if ( cfg.configFile != "NONE" ) {
+            std::cerr << "Cannot use both an sdl-file and --synthetic-model" << std::endl;
+            return -1;
+        }
+        modelGen = new SSTSyntheticModelDefinition(cfg.synthetic_model, cfg.verbose, &cfg);
+    }
+    else if ( cfg.configFile != "NONE" ) {
         string file_ext = "";
 
         if(cfg.configFile.size() > 3) {
@@ -408,6 +541,7 @@ main(int argc, char *argv[])
     }
 
     double start = sst_get_cpu_time();
+    startup_phase_begin();
 
     /* Build objected needed for startup */
     Factory *factory = new Factory(cfg.getLibPath());
@@ -419,17 +553,23 @@ main(int argc, char *argv[])
 
     // Get the memory before we create the graph
     const uint64_t pre_graph_create_rss = maxGlobalMemSize();
+    startup_phase_end("Core setup");
 
     ////// Start ConfigGraph Creation //////
+    // Everything this thread allocates until the graph is distributed
+    // belongs to the graph
+    MemAccounting::setThreadTag(MemAccounting::CONFIG_GRAPH);
     ConfigGraph* graph = nullptr;
 
     double start_graph_gen = sst_get_cpu_time();
-    graph = new ConfigGraph();
 
     // Only rank 0 will populate the graph
     if ( myRank.rank == 0 ) {
         graph = modelGen->createConfigGraph();
     }
+    else {
+        graph = new ConfigGraph();
+    }
 
 #ifdef SST_CONFIG_HAVE_MPI
     // Config is done - broadcast it
@@ -438,6 +578,8 @@ main(int argc, char *argv[])
     }
 #endif
 
+    startup_phase_end("Graph generation");
+
     // Need to initialize TimeLord
     Simulation::getTimeLord()->init(cfg.timeBase);
 
@@ -455,6 +597,7 @@ main(int argc, char *argv[])
     modelGen = nullptr;
 
     double end_graph_gen = sst_get_cpu_time();
+    startup_phase_end("Graph checks");
 
     if ( myRank.rank == 0 ) {
         g_output.verbose(CALL_INFO, 1, 0, "# ------------------------------------------------------------\n");
@@ -468,6 +611,11 @@ main(int argc, char *argv[])
     ////// Start Partitioning //////
     double start_part = sst_get_cpu_time();
 
+    // Apply weights measured on a previous run
+    if ( myRank.rank == 0 && !cfg.partition_weights.empty() ) {
+        graph->loadPartitionWeights(cfg.partition_weights);
+    }
+
     // If this is a serial job, just use the single partitioner,
     // but the same code path
     if ( world_size.rank == 1 && world_size.thread == 1) cfg.partitioner = "sst.single";
@@ -507,6 +655,7 @@ main(int argc, char *argv[])
         }
     }
     double end_part = sst_get_cpu_time();
+    startup_phase_end("Partition");
     const uint64_t post_graph_create_rss = maxGlobalMemSize();
 
     if(myRank.rank == 0) {
@@ -520,6 +669,7 @@ main(int argc, char *argv[])
         dump_partition(cfg, graph, world_size);
         doGraphOutput(&cfg, graph);
     }
+    startup_phase_end("Graph output");
 
     ////// End Partitioning //////
 
@@ -528,8 +678,8 @@ main(int argc, char *argv[])
     if ( world_size.rank > 1 ) {
         // Check the graph for the minimum latency crossing a partition boundary
         if ( myRank.rank == 0 ) {
-            ConfigComponentMap_t comps = graph->getComponentMap();
-            ConfigLinkMap_t links = graph->getLinkMap();
+            ConfigComponentMap_t& comps = graph->getComponentMap();
+            ConfigLinkMap_t& links = graph->getLinkMap();
             // Find the minimum latency across a partition
             for( ConfigLinkMap_t::iterator iter = links.begin();
                     iter != links.end(); ++iter ) {
@@ -559,6 +709,7 @@ main(int argc, char *argv[])
 #endif
     }
     ////// End Calculate Minimum Partitioning //////
+    startup_phase_end("Minimum partition latency");
 
     if(cfg.enable_sig_handling) {
         g_output.verbose(CALL_INFO, 1, 0, "Signal handlers will be registered for USR1, USR2, INT and TERM...\n");
@@ -574,6 +725,7 @@ main(int argc, char *argv[])
         Comms::broadcast(Params::keyMap, 0);
         Comms::broadcast(Params::keyMapReverse, 0);
         Comms::broadcast(Params::nextKeyID, 0);
+        Comms::broadcast(Params::shared_params, 0);
 
         std::set<uint32_t> my_ranks;
         std::set<uint32_t> your_ranks;
@@ -595,6 +747,7 @@ main(int argc, char *argv[])
             Comms::send(dest, 0, your_ranks);
             Comms::send(dest, 0, *your_graph);
             your_ranks.clear();
+            delete your_graph;
         }
         else {
             Comms::recv(MPI_ANY_SOURCE, 0, my_ranks);
@@ -623,6 +776,30 @@ main(int argc, char *argv[])
     }
 #endif
     ////// End Broadcast Graph //////
+    startup_phase_end("Graph broadcast");
+    MemAccounting::setThreadTag(MemAccounting::OTHER);
+
+    // Every rank now has all the keys and shared parameter sets the
+    // graph refers to
+    Params::freezeSharedData();
+
+    // Load the libraries this rank's components come from up front, all
+    // together, instead of one by one as the components are built.  Any
+    // that fail are fatal when their components are built; here their
+    // errors are only reported at verbose level.
+    {
+        std::set<std::string> lib_names;
+        for ( auto& comp : graph->getComponentMap() ) {
+            if ( comp.rank.rank == myRank.rank ) addLibraryNames(comp, lib_names);
+        }
+        std::stringstream lib_errors;
+        factory->loadUnloadedLibraries(lib_names, lib_errors);
+        if ( !lib_errors.str().empty() ) {
+            g_output.verbose(CALL_INFO, 1, 0, "Failed to load some element libraries up front:\n%s",
+                             lib_errors.str().c_str());
+        }
+    }
+    startup_phase_end("Load libraries");
 
     // // Print the graph
     // if ( myRank.rank == 0 ) {
@@ -638,7 +815,10 @@ main(int argc, char *argv[])
 
     ///// Set up StatisticEngine /////
 
-    SST::Statistics::StatisticProcessingEngine::init(graph);
+    {
+        MemAccounting::Scope scope(MemAccounting::STATISTICS);
+        SST::Statistics::StatisticProcessingEngine::init(graph);
+    }
 
     ///// End Set up StatisticEngine /////
 
@@ -666,6 +846,7 @@ main(int argc, char *argv[])
     }
 
     double end_serial_build = sst_get_cpu_time();
+    startup_phase_end("Statistic engine");
 
     Output::setThreadID(std::this_thread::get_id(), 0);
     for ( uint32_t i = 1 ; i < world_size.thread ; i++ ) {
@@ -708,6 +889,12 @@ main(int argc, char *argv[])
 
     uint64_t global_max_sync_data_size = 0, global_sync_data_size = 0;
 
+    // Events sent between ranks and the size of their wire format
+    uint64_t local_wire[3], global_wire[3];
+    SyncQueue::getWireStats(local_wire[0], local_wire[1], local_wire[2]);
+
+    uint64_t graph_release_rss = threadInfo[0].graph_release_rss, global_graph_release_rss = 0;
+
     uint64_t mempool_size = 0, max_mempool_size = 0, global_mempool_size = 0;
     uint64_t active_activities = 0, global_active_activities = 0;
 #ifdef USE_MEMPOOL
@@ -724,9 +911,11 @@ main(int argc, char *argv[])
     MPI_Allreduce(&local_current_tv_depth, &global_current_tv_depth, 1, MPI_UINT64_T, MPI_SUM, MPI_COMM_WORLD );
     MPI_Allreduce(&local_sync_data_size, &global_max_sync_data_size, 1, MPI_UINT64_T, MPI_MAX, MPI_COMM_WORLD );
     MPI_Allreduce(&local_sync_data_size, &global_sync_data_size, 1, MPI_UINT64_T, MPI_SUM, MPI_COMM_WORLD );
+    MPI_Allreduce(local_wire, global_wire, 3, MPI_UINT64_T, MPI_SUM, MPI_COMM_WORLD );
     MPI_Allreduce(&mempool_size, &max_mempool_size, 1, MPI_UINT64_T, MPI_MAX, MPI_COMM_WORLD );
     MPI_Allreduce(&mempool_size, &global_mempool_size, 1, MPI_UINT64_T, MPI_SUM, MPI_COMM_WORLD );
     MPI_Allreduce(&active_activities, &global_active_activities, 1, MPI_UINT64_T, MPI_SUM, MPI_COMM_WORLD );
+    MPI_Allreduce(&graph_release_rss, &global_graph_release_rss, 1, MPI_UINT64_T, MPI_SUM, MPI_COMM_WORLD );
 #else
     max_build_time = build_time;
     max_run_time = run_time;
@@ -735,9 +924,11 @@ main(int argc, char *argv[])
     global_current_tv_depth = local_current_tv_depth;
     global_max_sync_data_size = 0;
     global_max_sync_data_size = 0;
+    for ( int i = 0; i < 3; i++ ) global_wire[i] = local_wire[i];
     max_mempool_size = mempool_size;
     global_mempool_size = mempool_size;
     global_active_activities = active_activities;
+    global_graph_release_rss = graph_release_rss;
 #endif
 
     const uint64_t local_max_rss     = maxLocalMemSize();
@@ -761,6 +952,9 @@ main(int argc, char *argv[])
         sprintf(ua_buffer, "%" PRIu64 "B", global_sync_data_size);
         UnitAlgebra global_sync_data_size_ua(ua_buffer);
 
+        sprintf(ua_buffer, "%" PRIu64 "KB", global_graph_release_rss);
+        UnitAlgebra global_graph_release_rss_ua(ua_buffer);
+
         sprintf(ua_buffer, "%" PRIu64 "B", max_mempool_size);
         UnitAlgebra max_mempool_size_ua(ua_buffer);
 
@@ -785,6 +979,8 @@ main(int argc, char *argv[])
                 local_max_pf);
         g_output.output( "Global Page Faults:              %" PRIu64 " faults\n",
                 global_pf);
+        g_output.output( "Graph release reclaimed RSS:     %s\n",
+                global_graph_release_rss_ua.toStringBestSI().c_str());
         g_output.output( "Max Output Blocks:               %" PRIu64 " blocks\n",
                 global_max_io_in);
         g_output.output( "Max Input Blocks:                %" PRIu64 " blocks\n",
@@ -803,10 +999,29 @@ main(int argc, char *argv[])
                 global_max_sync_data_size_ua.toStringBestSI().c_str());
         g_output.output( "Global Sync data size:           %s\n",
                 global_sync_data_size_ua.toStringBestSI().c_str());
-        g_output.output( "------------------------------------------------------------\n");
-        g_output.output( "\n" );
-        g_output.output( "\n" );
+        if ( global_wire[0] > 0 ) {
+            sprintf(ua_buffer, "%" PRIu64 "B", global_wire[1]);
+            UnitAlgebra global_wire_ua(ua_buffer);
+            g_output.output( "Global Sync events sent:         %" PRIu64 " events, %s\n",
+                    global_wire[0], global_wire_ua.toStringBestSI().c_str());
+            g_output.output( "Sync wire compression ratio:     %.2f (%.1f bytes/event)\n",
+                    (double)global_wire[2] / global_wire[1], (double)global_wire[1] / global_wire[0]);
+        }
+        g_output.output( "\n");
+    }
+
+    if ( cfg.verbose || cfg.printTimingInfo() ) {
+        MemAccounting::writeReport(g_output, myRank, world_size, threadInfo[0].mem_snapshots);
+    }
+
+    print_startup_phases(myRank, world_size, cfg.verbose || cfg.printTimingInfo());
+
+    if ( cfg.profilingEnabled() ) {
+        Core::Profile::RuntimeProfile::writeReport(cfg, g_output, myRank, world_size);
+    }
 
+    if ( !cfg.output_partition_weights.empty() ) {
+        Core::Profile::LinkTelemetry::writeFile(cfg.output_partition_weights, g_output, myRank, world_size);
     }
 
 #ifdef USE_MEMPOOL
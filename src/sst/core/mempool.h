@@ -59,7 +59,7 @@ public:
      * @param initialSize - Size of the memory pool (in bytes)
      */
     MemPool(size_t elementSize, size_t initialSize=(2<<20)) :
-        numAlloc(0), numFree(0),
+        numAlloc(0), numFree(0), peakEntries(0),
         elemSize(elementSize), arenaSize(initialSize),
         allocating(false)
     {
@@ -83,7 +83,12 @@ public:
             sst_pause();
             ret = freeList.try_remove();
         }
-        ++numAlloc;
+        // High-water mark of entries in use.  numFree may already count
+        // frees of later allocations, so only positive values count.
+        int64_t in_use = (int64_t)(++numAlloc - numFree.load(std::memory_order_relaxed));
+        if ( in_use > (int64_t)peakEntries.load(std::memory_order_relaxed) ) {
+            peakEntries.store(in_use, std::memory_order_relaxed);
+        }
         return ret;
     }
 
@@ -112,10 +117,17 @@ public:
         return numAlloc - numFree;
     }
 
+    /** Most entries that have been in use at once */
+    uint64_t getPeakEntries() const {
+        return peakEntries.load(std::memory_order_relaxed);
+    }
+
     /** Counter:  Number of times elements have been allocated */
     std::atomic<uint64_t> numAlloc;
     /** Counter:  Number times elements have been freed */
     std::atomic<uint64_t> numFree;
+    /** Counter:  Most entries in use at once */
+    std::atomic<uint64_t> peakEntries;
 
     size_t getArenaSize() const { return arenaSize; }
     size_t getElementSize() const { return elemSize; }
@@ -13,9 +13,30 @@
 #include "sst_config.h"
 #include "sst/core/memuse.h"
 
+#include "sst/core/activity.h"
+#include "sst/core/objectComms.h"
+#include "sst/core/output.h"
+#include "sst/core/rankInfo.h"
+#include "sst/core/unitAlgebra.h"
 #include "sst/core/warnmacros.h"
 
+#include <algorithm>
+#include <atomic>
+#include <cinttypes>
+#include <cstddef>
+#include <cstdio>
+#include <cstdlib>
+#include <new>
+#include <vector>
+
 #include <sys/resource.h>
+#include <unistd.h>
+
+#if defined(SST_COMPILE_MACOSX)
+#include <mach/mach.h>
+#elif defined(__GLIBC__)
+#include <malloc.h>
+#endif
 
 #ifdef SST_CONFIG_HAVE_MPI
 DISABLE_WARN_MISSING_OVERRIDE
@@ -26,6 +47,41 @@ REENABLE_WARNING
 
 using namespace SST::Core;
 
+uint64_t SST::Core::processMaxMemSize() {
+    struct rusage sim_ruse;
+    getrusage(RUSAGE_SELF, &sim_ruse);
+
+#ifdef SST_COMPILE_MACOSX
+    return (sim_ruse.ru_maxrss / 1024);
+#else
+    return sim_ruse.ru_maxrss;
+#endif
+}
+
+uint64_t SST::Core::processCurrentMemSize() {
+#if defined(SST_COMPILE_MACOSX)
+    mach_task_basic_info_data_t info;
+    mach_msg_type_number_t count = MACH_TASK_BASIC_INFO_COUNT;
+    if ( KERN_SUCCESS != task_info(mach_task_self(), MACH_TASK_BASIC_INFO, (task_info_t)&info, &count) ) return 0;
+    return info.resident_size / 1024;
+#else
+    // The second field of statm is the resident set in pages
+    FILE* statm = fopen("/proc/self/statm", "r");
+    if ( nullptr == statm ) return 0;
+    unsigned long size = 0, resident = 0;
+    int fields = fscanf(statm, "%lu %lu", &size, &resident);
+    fclose(statm);
+    if ( fields != 2 ) return 0;
+    return (uint64_t)resident * (sysconf(_SC_PAGESIZE) / 1024);
+#endif
+}
+
+void SST::Core::releaseFreeMemory() {
+#ifdef __GLIBC__
+    malloc_trim(0);
+#endif
+}
+
 uint64_t SST::Core::maxLocalMemSize() {
 
     struct rusage sim_ruse;
@@ -87,3 +143,336 @@ uint64_t SST::Core::globalPageFaults() {
 
     return global_pf;
 };
+
+
+
+/* Tagged allocation accounting */
+
+namespace {
+
+/* Counters for one thread.  Only the owning thread writes them, so the
+ * updates are plain load/store pairs; readers may see slightly stale
+ * values.  The blocks are allocated with malloc, since they are made
+ * from inside operator new, and are never freed, so the counts of
+ * threads that have exited are kept. */
+struct ThreadMem {
+    std::atomic<int64_t> bytes[MemAccounting::NUM_TAGS];
+    MemAccounting::TypeBytes_t* types;
+    ThreadMem* next;
+};
+
+std::atomic<ThreadMem*> threadMemList(nullptr);
+
+thread_local ThreadMem* threadMem = nullptr;
+thread_local MemAccounting::Tag threadTag = MemAccounting::OTHER;
+
+#ifdef __SST_ENABLE_MEM_ACCOUNTING__
+
+ThreadMem* registerThread()
+{
+    ThreadMem* mem = static_cast<ThreadMem*>(std::malloc(sizeof(ThreadMem)));
+    if ( nullptr == mem ) return nullptr;
+    for ( int i = 0 ; i < MemAccounting::NUM_TAGS ; i++ ) {
+        new (&mem->bytes[i]) std::atomic<int64_t>(0);
+    }
+    mem->types = nullptr;
+    mem->next = threadMemList.load(std::memory_order_relaxed);
+    while ( !threadMemList.compare_exchange_weak(mem->next, mem, std::memory_order_release,
+                                                 std::memory_order_relaxed) ) {}
+    threadMem = mem;
+    return mem;
+}
+
+/* Precedes every allocation.  It records what the free has to credit
+ * back and keeps the alignment that malloc guarantees. */
+struct alignas(alignof(std::max_align_t)) AllocHeader {
+    uint64_t size;
+    MemAccounting::Tag tag;
+};
+
+inline void charge(MemAccounting::Tag tag, int64_t bytes)
+{
+    ThreadMem* mem = threadMem;
+    if ( nullptr == mem ) {
+        mem = registerThread();
+        if ( nullptr == mem ) return;
+    }
+    std::atomic<int64_t>& counter = mem->bytes[tag];
+    counter.store(counter.load(std::memory_order_relaxed) + bytes, std::memory_order_relaxed);
+}
+
+void* accountedAlloc(std::size_t size)
+{
+    if ( 0 == size ) size = 1;
+    void* ptr;
+    while ( nullptr == (ptr = std::malloc(sizeof(AllocHeader) + size)) ) {
+        std::new_handler handler = std::get_new_handler();
+        if ( nullptr == handler ) return nullptr;
+        handler();
+    }
+    AllocHeader* header = static_cast<AllocHeader*>(ptr);
+    header->size = size;
+    header->tag = threadTag;
+    charge(header->tag, size);
+    return header + 1;
+}
+
+inline void accountedFree(void* ptr) noexcept
+{
+    if ( nullptr == ptr ) return;
+    AllocHeader* header = static_cast<AllocHeader*>(ptr) - 1;
+    charge(header->tag, -(int64_t)header->size);
+    std::free(header);
+}
+
+#endif
+
+std::string pad(const std::string& str, size_t width = 16)
+{
+    if ( str.size() >= width ) return str;
+    return str + std::string(width - str.size(), ' ');
+}
+
+std::string trim(std::string str)
+{
+    str.erase(str.find_last_not_of(' ') + 1);
+    return str;
+}
+
+void addTypeBytes(MemAccounting::TypeBytes_t& to, const MemAccounting::TypeBytes_t& from)
+{
+    for ( auto& item : from ) {
+        to[item.first].first += item.second.first;
+        to[item.first].second += item.second.second;
+    }
+}
+
+}
+
+#ifdef __SST_ENABLE_MEM_ACCOUNTING__
+
+void* operator new(std::size_t size)
+{
+    void* ptr = accountedAlloc(size);
+    if ( nullptr == ptr ) throw std::bad_alloc();
+    return ptr;
+}
+
+void* operator new[](std::size_t size)
+{
+    void* ptr = accountedAlloc(size);
+    if ( nullptr == ptr ) throw std::bad_alloc();
+    return ptr;
+}
+
+void* operator new(std::size_t size, const std::nothrow_t&) noexcept
+{
+    try {
+        return accountedAlloc(size);
+    }
+    catch (...) {
+        return nullptr;
+    }
+}
+
+void* operator new[](std::size_t size, const std::nothrow_t&) noexcept
+{
+    try {
+        return accountedAlloc(size);
+    }
+    catch (...) {
+        return nullptr;
+    }
+}
+
+void operator delete(void* ptr) noexcept { accountedFree(ptr); }
+void operator delete[](void* ptr) noexcept { accountedFree(ptr); }
+void operator delete(void* ptr, const std::nothrow_t&) noexcept { accountedFree(ptr); }
+void operator delete[](void* ptr, const std::nothrow_t&) noexcept { accountedFree(ptr); }
+void operator delete(void* ptr, std::size_t) noexcept { accountedFree(ptr); }
+void operator delete[](void* ptr, std::size_t) noexcept { accountedFree(ptr); }
+
+#endif
+
+bool MemAccounting::enabled()
+{
+#ifdef __SST_ENABLE_MEM_ACCOUNTING__
+    return true;
+#else
+    return false;
+#endif
+}
+
+const char* MemAccounting::tagName(Tag tag)
+{
+    switch ( tag ) {
+    case OTHER:        return "Other";
+    case CONFIG_GRAPH: return "ConfigGraph";
+    case COMPONENTS:   return "Components";
+    case LINKS:        return "Links";
+    case TIME_VORTEX:  return "TimeVortex";
+    case STATISTICS:   return "Statistics";
+    default:           return "Unknown";
+    }
+}
+
+MemAccounting::Tag MemAccounting::setThreadTag(Tag tag)
+{
+    Tag prev = threadTag;
+    threadTag = tag;
+    return prev;
+}
+
+int64_t MemAccounting::threadBytes()
+{
+    ThreadMem* mem = threadMem;
+    if ( nullptr == mem ) return 0;
+    int64_t total = 0;
+    for ( int i = 0 ; i < NUM_TAGS ; i++ ) {
+        total += mem->bytes[i].load(std::memory_order_relaxed);
+    }
+    return total;
+}
+
+void MemAccounting::chargeComponentType(const std::string& type, bool construct, int64_t bytes)
+{
+    ThreadMem* mem = threadMem;
+    if ( nullptr == mem ) return;
+    if ( nullptr == mem->types ) mem->types = new TypeBytes_t();
+    auto& entry = (*mem->types)[type];
+    if ( construct ) entry.first++;
+    entry.second += bytes;
+}
+
+void MemAccounting::getTagBytes(TagBytes& bytes)
+{
+    for ( int i = 0 ; i < NUM_TAGS ; i++ ) bytes[i] = 0;
+    for ( ThreadMem* mem = threadMemList.load(std::memory_order_acquire) ; mem != nullptr ; mem = mem->next ) {
+        for ( int i = 0 ; i < NUM_TAGS ; i++ ) {
+            bytes[i] += mem->bytes[i].load(std::memory_order_relaxed);
+        }
+    }
+}
+
+void MemAccounting::getGlobalTagBytes(TagBytes& bytes)
+{
+    getTagBytes(bytes);
+#ifdef SST_CONFIG_HAVE_MPI
+    MPI_Allreduce(MPI_IN_PLACE, bytes.data(), NUM_TAGS, MPI_INT64_T, MPI_SUM, MPI_COMM_WORLD);
+#endif
+}
+
+MemAccounting::Snapshot MemAccounting::snapshot(const std::string& label)
+{
+    Snapshot snap;
+    snap.label = label;
+    getTagBytes(snap.bytes);
+    snap.rss = processCurrentMemSize();
+    return snap;
+}
+
+std::string MemAccounting::formatBytes(int64_t bytes)
+{
+    char buffer[64];
+    sprintf(buffer, "%" PRIu64 "B", (uint64_t)(bytes < 0 ? -bytes : bytes));
+    std::string str = UnitAlgebra(buffer).toStringBestSI();
+    return bytes < 0 ? "-" + str : str;
+}
+
+void MemAccounting::writeReport(Output& out, const RankInfo& myRank, const RankInfo& worldSize,
+                                const std::vector<Snapshot>& snapshots)
+{
+    // Threads have all exited, so the per-thread type maps are stable
+    TypeBytes_t types;
+    for ( ThreadMem* mem = threadMemList.load(std::memory_order_acquire) ; mem != nullptr ; mem = mem->next ) {
+        if ( nullptr != mem->types ) addTypeBytes(types, *mem->types);
+    }
+
+    /* Event size -> bytes held by the pools, entries in use, summed
+     * high-water marks of entries in use */
+    std::map<uint64_t, std::vector<uint64_t>> pools;
+#ifdef USE_MEMPOOL
+    Activity::getMemPoolSizeClasses(pools);
+#endif
+
+    std::vector<Snapshot> global(snapshots);
+
+#ifdef SST_CONFIG_HAVE_MPI
+    if ( worldSize.rank > 1 ) {
+        for ( auto& snap : global ) {
+            MPI_Allreduce(MPI_IN_PLACE, snap.bytes.data(), NUM_TAGS, MPI_INT64_T, MPI_SUM, MPI_COMM_WORLD);
+            MPI_Allreduce(MPI_IN_PLACE, &snap.rss, 1, MPI_UINT64_T, MPI_SUM, MPI_COMM_WORLD);
+        }
+
+        std::vector<TypeBytes_t> gatheredTypes;
+        Comms::all_gather(types, gatheredTypes);
+        types.clear();
+        for ( auto& rankTypes : gatheredTypes ) addTypeBytes(types, rankTypes);
+
+        std::vector<std::map<uint64_t, std::vector<uint64_t>>> gatheredPools;
+        Comms::all_gather(pools, gatheredPools);
+        pools.clear();
+        for ( auto& rankPools : gatheredPools ) {
+            for ( auto& item : rankPools ) {
+                std::vector<uint64_t>& counts = pools[item.first];
+                counts.resize(item.second.size());
+                for ( size_t i = 0 ; i < item.second.size() ; i++ ) counts[i] += item.second[i];
+            }
+        }
+    }
+#else
+    (void)worldSize;
+#endif
+
+    if ( myRank.rank != 0 ) return;
+
+    out.output("Simulation Memory Information:\n");
+    if ( !enabled() ) {
+        out.output("Allocation accounting is not enabled (configure with --enable-mem-accounting)\n");
+    }
+    else {
+        std::string line = "Allocations by subsystem:       ";
+        for ( auto& snap : global ) line += " " + pad(snap.label);
+        out.output("%s\n", trim(line).c_str());
+        for ( int i = 0 ; i < NUM_TAGS ; i++ ) {
+            line = "  " + pad(tagName((Tag)i), 30);
+            for ( auto& snap : global ) line += " " + pad(formatBytes(snap.bytes[i]));
+            out.output("%s\n", trim(line).c_str());
+        }
+    }
+    if ( processCurrentMemSize() > 0 ) {
+        std::string line = "Global resident set size:       ";
+        for ( auto& snap : global ) line += " " + pad(formatBytes(snap.rss * 1024));
+        out.output("%s\n", trim(line).c_str());
+    }
+
+    if ( !pools.empty() ) {
+        out.output("Event pools by event size:       %-16s %-16s %s\n", "pool size", "in use", "peak in use");
+        for ( auto& item : pools ) {
+            out.output("  %-6" PRIu64 " bytes                   %-16s %-16" PRIu64 " %" PRIu64 "\n",
+                       item.first, formatBytes(item.second[0]).c_str(), item.second[1], item.second[2]);
+        }
+    }
+
+    if ( enabled() && !types.empty() ) {
+        std::vector<std::pair<std::string, std::pair<uint64_t, int64_t>>> sorted(types.begin(), types.end());
+        std::sort(sorted.begin(), sorted.end(),
+                  [](const std::pair<std::string, std::pair<uint64_t, int64_t>>& a,
+                     const std::pair<std::string, std::pair<uint64_t, int64_t>>& b) {
+                      return a.second.second > b.second.second;
+                  });
+        const size_t limit = 20;
+        out.output("Component types by bytes allocated in construction, init and setup:\n");
+        for ( size_t i = 0 ; i < sorted.size() && i < limit ; i++ ) {
+            uint64_t count = sorted[i].second.first;
+            int64_t bytes = sorted[i].second.second;
+            out.output("  %-16s %8" PRIu64 " components, %-12s each  %s\n",
+                       formatBytes(bytes).c_str(), count,
+                       formatBytes(count ? bytes / (int64_t)count : 0).c_str(), sorted[i].first.c_str());
+        }
+        if ( sorted.size() > limit ) {
+            out.output("  ... %zu more types\n", sorted.size() - limit);
+        }
+    }
+    out.output("\n");
+}
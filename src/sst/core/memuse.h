@@ -15,16 +15,152 @@
 
 #include <inttypes.h>
 
+#include <array>
+#include <map>
+#include <string>
+#include <utility>
+#include <vector>
+
 namespace SST {
+
+class Output;
+class RankInfo;
+
 namespace Core {
 
+/** Peak RSS of this process in KB.  Unlike the functions below it does
+ * not communicate, so it can be called on one rank at a time. */
+uint64_t processMaxMemSize();
+/** Current RSS of this process in KB, or 0 if the platform can't tell */
+uint64_t processCurrentMemSize();
+/** Return freed heap memory to the OS where the allocator supports it */
+void releaseFreeMemory();
 uint64_t maxLocalMemSize();
 uint64_t maxGlobalMemSize();
 uint64_t maxLocalPageFaults();
 uint64_t globalPageFaults();
 
+
+/**
+ * Accounting of the memory allocated through operator new, broken
+ * down by the subsystem that allocated it.  Only available when the
+ * core is configured with --enable-mem-accounting.
+ *
+ * The core then replaces the global operator new and delete.  Each
+ * thread has a current tag (Other unless a Scope says otherwise) and a
+ * block of counters that only it writes, so counting an allocation
+ * costs a thread-local lookup and a store.  Every allocation carries a
+ * small header with its size and the tag it was charged to, and the
+ * free credits that same tag, so a subsystem's count is the memory it
+ * holds no matter which code frees it.
+ *
+ * The core tags its own paths: graph construction, wire-up, link
+ * sends and queues, the TimeVortex, statistic collection and output,
+ * and the rank sync.  Everything else the simulation allocates while
+ * it runs, which is mostly event and clock handlers, is charged to
+ * Components.
+ *
+ * Component memory is also attributed to the component's type: the
+ * net bytes the thread allocates while a ComponentScope is active are
+ * charged to that type.
+ *
+ * Event memory comes from the Activity pools and is reported from
+ * there, per event size.
+ */
+class MemAccounting {
+public:
+    enum Tag { OTHER = 0, CONFIG_GRAPH, COMPONENTS, LINKS, TIME_VORTEX, STATISTICS, NUM_TAGS };
+
+    /** Bytes per tag */
+    typedef std::array<int64_t, NUM_TAGS> TagBytes;
+
+    /** Bytes per tag and current RSS (KB) at one point of the run */
+    struct Snapshot {
+        std::string label;
+        TagBytes bytes;
+        uint64_t rss;
+    };
+
+    /** Per component type: number of components and bytes */
+    typedef std::map<std::string, std::pair<uint64_t, int64_t>> TypeBytes_t;
+
+    /** Charges the calling thread's allocations to a tag for the life
+     * of the object */
+    class Scope {
+    public:
+        explicit Scope(Tag tag) : prev(setThreadTag(tag)) {}
+        ~Scope() { setThreadTag(prev); }
+    private:
+        Tag prev;
+    };
+
+    /** Charges the calling thread's allocations to COMPONENTS, and the
+     * net bytes allocated to the component type */
+    class ComponentScope {
+    public:
+        /** Set construct for the scope that builds the component, so
+         * it is counted once */
+        ComponentScope(const std::string& type, bool construct = false) :
+            type(type), construct(construct), prev(setThreadTag(COMPONENTS)), start(threadBytes())
+        {}
+        ~ComponentScope() {
+            setThreadTag(prev);
+            chargeComponentType(type, construct, threadBytes() - start);
+        }
+    private:
+        std::string type;
+        bool construct;
+        Tag prev;
+        int64_t start;
+    };
+
+    /** True if configured with --enable-mem-accounting.  Otherwise
+     * nothing is counted and all the counts are zero. */
+    static bool enabled();
+
+    static const char* tagName(Tag tag);
+
+    /** Set the calling thread's tag, returning the previous one */
+    static Tag setThreadTag(Tag tag);
+
+    /** Net bytes allocated by the calling thread, over all tags */
+    static int64_t threadBytes();
+
+    static void chargeComponentType(const std::string& type, bool construct, int64_t bytes);
+
+    /** Net bytes per tag in this process, summed over the threads */
+    static void getTagBytes(TagBytes& bytes);
+
+    /** Net bytes per tag summed over all ranks.  Must be called by
+     * every rank. */
+    static void getGlobalTagBytes(TagBytes& bytes);
+
+    /** This rank's bytes per tag and RSS right now */
+    static Snapshot snapshot(const std::string& label);
+
+    /** Format a (possibly negative) byte count with an SI prefix */
+    static std::string formatBytes(int64_t bytes);
+
+    /**
+     * Combine the accounting across ranks and write the memory report
+     * on rank 0, with a column for each of this rank's snapshots.
+     * Every rank must call it with the same number of snapshots.
+     */
+    static void writeReport(Output& out, const RankInfo& myRank, const RankInfo& worldSize,
+                            const std::vector<Snapshot>& snapshots);
+};
+
 }
 }
 
+/* Charges the calling thread's allocations to a MemAccounting tag until
+ * the end of the enclosing block.  For the core's run-time paths: it
+ * compiles to nothing unless the accounting is configured in. */
+#ifdef __SST_ENABLE_MEM_ACCOUNTING__
+#define SST_MEM_ACCOUNTING_SCOPE(tag) \
+    SST::Core::MemAccounting::Scope sst_mem_accounting_scope_(SST::Core::MemAccounting::tag)
+#else
+#define SST_MEM_ACCOUNTING_SCOPE(tag)
+#endif
 
 #endif
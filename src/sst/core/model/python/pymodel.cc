@@ -254,23 +254,233 @@ static PyObject* findComponentByName(PyObject* UNUSED(self), PyObject* args)
         return Py_None;
     }
     
-    if ( SUBCOMPONENT_ID_MASK(cc->id) == 0 ) {
-        // Component
-        PyObject *argList = Py_BuildValue("ssk", name, "irrelephant", cc->id);
-        PyObject *res = PyObject_CallObject((PyObject *) &PyModel_ComponentType, argList);
-        Py_DECREF(argList);
-        return res;
+    return createComponentHandle(cc->id);
+}
+
+
+static PyObject* findComponentById(PyObject* UNUSED(self), PyObject* arg)
+{
+    Py_ssize_t val = PyNumber_AsSsize_t(arg, PyExc_OverflowError);
+    if ( -1 == val && PyErr_Occurred() ) return nullptr;
+
+    ComponentId_t id = val;
+    ConfigGraph* graph = gModel->getGraph();
+    if ( val < 0 || !graph->containsComponent(COMPONENT_ID_MASK(id)) ||
+         nullptr == graph->findComponent(id) ) {
+        Py_INCREF(Py_None);
+        return Py_None;
     }
-    else {
-        // SubComponent
-        PyObject *argList = Py_BuildValue("Ok", Py_None, cc->id);
-        PyObject *res = PyObject_CallObject((PyObject *) &PyModel_SubComponentType, argList);
-        Py_DECREF(argList);
-        return res;
+    return createComponentHandle(id);
+}
+
+
+/***** Bulk graph construction *****/
+
+// Holds a string argument that is either one string used for every
+// element or a sequence with one string per element.  The strings point
+// into the Python objects, which are kept alive by 'seq'.
+struct BulkStringArg {
+    PyObject* seq;
+    std::vector<const char*> values;
+
+    BulkStringArg() : seq(nullptr) { }
+    ~BulkStringArg() { Py_XDECREF(seq); }
+
+    bool parse(PyObject* obj, size_t count, const char* what) {
+        if ( !PyList_Check(obj) && !PyTuple_Check(obj) ) {
+            const char* str = SST_ConvertToCppString(obj);
+            if ( nullptr == str ) return false;
+            values.assign(1, str);
+            return true;
+        }
+        seq = PySequence_Fast(obj, what);
+        if ( nullptr == seq ) return false;
+        if ( (size_t)PySequence_Fast_GET_SIZE(seq) != count ) {
+            PyErr_Format(PyExc_ValueError, "%s has %zd entries, expected %zu", what, PySequence_Fast_GET_SIZE(seq), count);
+            return false;
+        }
+        values.resize(count);
+        PyObject** items = PySequence_Fast_ITEMS(seq);
+        for ( size_t i = 0; i < count; i++ ) {
+            values[i] = SST_ConvertToCppString(items[i]);
+            if ( nullptr == values[i] ) return false;
+        }
+        return true;
+    }
+
+    const char* operator[](size_t i) const { return values.size() == 1 ? values[0] : values[i]; }
+};
+
+
+// Reads a one dimensional buffer of integers (array.array, numpy array,
+// ...) or a sequence of ints into a vector of component ids
+static bool getBulkComponentIds(PyObject* obj, std::vector<ComponentId_t>& ids, const char* what)
+{
+    ids.clear();
+    if ( PyObject_CheckBuffer(obj) ) {
+        Py_buffer view;
+        if ( PyObject_GetBuffer(obj, &view, PyBUF_FORMAT | PyBUF_C_CONTIGUOUS) < 0 ) return false;
+
+        const char* fmt = view.format ? view.format : "B";
+        if ( *fmt == '@' || *fmt == '=' || *fmt == '<' ) fmt++;
+        bool is_signed = (nullptr != strchr("bhilqn", *fmt));
+        bool ok = view.ndim <= 1 && fmt[0] != '\0' && fmt[1] == '\0' && nullptr != strchr("bhilqnBHILQN", *fmt) &&
+            (view.itemsize == 1 || view.itemsize == 2 || view.itemsize == 4 || view.itemsize == 8);
+        if ( !ok ) {
+            PyErr_Format(PyExc_TypeError, "%s must be a one dimensional buffer of integers", what);
+            PyBuffer_Release(&view);
+            return false;
+        }
+
+        size_t count = view.len / view.itemsize;
+        ids.resize(count);
+        const char* data = (const char*)view.buf;
+        for ( size_t i = 0; i < count && ok; i++ ) {
+            int64_t val;
+            switch ( view.itemsize ) {
+            case 1: val = is_signed ? (int64_t)((const int8_t*)data)[i] : (int64_t)((const uint8_t*)data)[i]; break;
+            case 2: val = is_signed ? (int64_t)((const int16_t*)data)[i] : (int64_t)((const uint16_t*)data)[i]; break;
+            case 4: val = is_signed ? (int64_t)((const int32_t*)data)[i] : (int64_t)((const uint32_t*)data)[i]; break;
+            default: val = ((const int64_t*)data)[i]; break;
+            }
+            if ( is_signed && val < 0 ) {
+                PyErr_Format(PyExc_ValueError, "%s contains a negative component id", what);
+                ok = false;
+            }
+            ids[i] = (ComponentId_t)val;
+        }
+        PyBuffer_Release(&view);
+        return ok;
     }
 
-    Py_INCREF(Py_None);
-    return Py_None;
+    PyObject* seq = PySequence_Fast(obj, what);
+    if ( nullptr == seq ) return false;
+    size_t count = PySequence_Fast_GET_SIZE(seq);
+    PyObject** items = PySequence_Fast_ITEMS(seq);
+    ids.resize(count);
+    for ( size_t i = 0; i < count; i++ ) {
+        Py_ssize_t val = PyNumber_AsSsize_t(items[i], PyExc_OverflowError);
+        if ( val < 0 ) {
+            if ( !PyErr_Occurred() ) PyErr_Format(PyExc_ValueError, "%s contains a negative component id", what);
+            Py_DECREF(seq);
+            return false;
+        }
+        ids[i] = val;
+    }
+    Py_DECREF(seq);
+    return true;
+}
+
+
+static PyObject* addComponents(PyObject* UNUSED(self), PyObject* args, PyObject* kwds)
+{
+    static const char* kwlist[] = { "name", "type", "count", "params", nullptr };
+    char *name, *type;
+    unsigned long count;
+    PyObject* dict = nullptr;
+    if ( !PyArg_ParseTupleAndKeywords(args, kwds, "ssk|O!", (char**)kwlist, &name, &type, &count, &PyDict_Type, &dict) )
+        return nullptr;
+    if ( 0 == count ) {
+        PyErr_SetString(PyExc_ValueError, "count must be at least 1");
+        return nullptr;
+    }
+
+    char* prefixed_name = gModel->addNamePrefix(name);
+    std::string comp_name(prefixed_name);
+    free(prefixed_name);
+    const size_t base_len = comp_name.size();
+
+    // The parameters go into a shared set that every component
+    // subscribes to, so they are stored once however many components
+    // there are.  Number the sets so that calls can't merge them.
+    static unsigned long num_param_sets = 0;
+    std::string param_set;
+    if ( nullptr != dict && PyDict_Size(dict) > 0 ) {
+        param_set = "addComponents" + std::to_string(num_param_sets++) + ":" + comp_name;
+        Py_ssize_t pos = 0;
+        PyObject *key, *val;
+        while ( PyDict_Next(dict, &pos, &key, &val) ) {
+            PyObject *kstr = PyObject_CallMethod(key, (char*)"__str__", nullptr);
+            PyObject *vstr = PyObject_CallMethod(val, (char*)"__str__", nullptr);
+            if ( nullptr == kstr || nullptr == vstr ) {
+                Py_XDECREF(kstr);
+                Py_XDECREF(vstr);
+                return nullptr;
+            }
+            Params::insert_shared(param_set, SST_ConvertToCppString(kstr), SST_ConvertToCppString(vstr));
+            Py_DECREF(kstr);
+            Py_DECREF(vstr);
+        }
+    }
+
+    ConfigGraph* graph = gModel->getGraph();
+    ComponentId_t first = UNSET_COMPONENT_ID;
+    for ( unsigned long i = 0; i < count; i++ ) {
+        comp_name.resize(base_len);
+        comp_name += std::to_string(i);
+        ComponentId_t id = gModel->addComponent(comp_name.c_str(), type);
+        if ( 0 == i ) first = id;
+        if ( !param_set.empty() ) graph->findComponent(id)->addSharedParamSet(param_set);
+    }
+
+    gModel->getOutput()->verbose(CALL_INFO, 3, 0, "Creating %lu components [%s0..] of type [%s]: first id [%" PRIu64 "]\n",
+                                 count, comp_name.substr(0, base_len).c_str(), type, first);
+
+    return PyLong_FromUnsignedLongLong(first);
+}
+
+
+static PyObject* connectComponents(PyObject* UNUSED(self), PyObject* args, PyObject* kwds)
+{
+    static const char* kwlist[] = { "name", "comp0", "port0", "comp1", "port1", "latency", "no_cut", nullptr };
+    char *name;
+    PyObject *pcomp0, *pport0, *pcomp1, *pport1, *plat;
+    int no_cut = 0;
+    if ( !PyArg_ParseTupleAndKeywords(args, kwds, "sOOOOO|i", (char**)kwlist, &name, &pcomp0, &pport0, &pcomp1, &pport1, &plat, &no_cut) )
+        return nullptr;
+
+    std::vector<ComponentId_t> comp0, comp1;
+    if ( !getBulkComponentIds(pcomp0, comp0, "comp0") ) return nullptr;
+    if ( !getBulkComponentIds(pcomp1, comp1, "comp1") ) return nullptr;
+    if ( comp0.size() != comp1.size() ) {
+        PyErr_Format(PyExc_ValueError, "comp0 has %zu entries but comp1 has %zu", comp0.size(), comp1.size());
+        return nullptr;
+    }
+    const size_t count = comp0.size();
+
+    BulkStringArg port0, port1, lat;
+    if ( !port0.parse(pport0, count, "port0") ) return nullptr;
+    if ( !port1.parse(pport1, count, "port1") ) return nullptr;
+    if ( !lat.parse(plat, count, "latency") ) return nullptr;
+
+    // Check the ids up front rather than failing half way through.  The
+    // ids may be of components or of subcomponents.
+    ConfigGraph* graph = gModel->getGraph();
+    auto known = [graph](ComponentId_t id) {
+        return graph->containsComponent(COMPONENT_ID_MASK(id)) && nullptr != graph->findComponent(id);
+    };
+    for ( size_t i = 0; i < count; i++ ) {
+        if ( !known(comp0[i]) || !known(comp1[i]) ) {
+            PyErr_Format(PyExc_ValueError, "link %zu connects to an unknown component id", i);
+            return nullptr;
+        }
+    }
+
+    char* prefixed_name = gModel->addNamePrefix(name);
+    std::string link_name(prefixed_name);
+    free(prefixed_name);
+    const size_t base_len = link_name.size();
+
+    for ( size_t i = 0; i < count; i++ ) {
+        link_name.resize(base_len);
+        link_name += std::to_string(i);
+        graph->addLink(comp0[i], link_name, port0[i], lat[i], no_cut);
+        graph->addLink(comp1[i], link_name, port1[i], lat[i], no_cut);
+    }
+
+    gModel->getOutput()->verbose(CALL_INFO, 3, 0, "Connecting %zu links [%s0..]\n", count, link_name.substr(0, base_len).c_str());
+
+    return PyLong_FromSize_t(count);
 }
 
 
@@ -337,6 +547,46 @@ static PyObject* getProgramOptions(PyObject*UNUSED(self), PyObject *UNUSED(args)
 }
 
 
+static PyObject* addSharedParam(PyObject* UNUSED(self), PyObject* args)
+{
+    char *set, *param;
+    PyObject *value = nullptr;
+    PyErr_Clear();
+    if ( !PyArg_ParseTuple(args, "ssO", &set, &param, &value) )
+        return nullptr;
+
+    PyObject *vstr = PyObject_CallMethod(value, (char*)"__str__", nullptr);
+    Params::insert_shared(set, param, SST_ConvertToCppString(vstr));
+    Py_XDECREF(vstr);
+
+    return SST_ConvertToPythonLong(0);
+}
+
+
+static PyObject* addSharedParams(PyObject* UNUSED(self), PyObject* args)
+{
+    char *set;
+    PyObject *dict = nullptr;
+    PyErr_Clear();
+    if ( !PyArg_ParseTuple(args, "sO!", &set, &PyDict_Type, &dict) )
+        return nullptr;
+
+    Py_ssize_t pos = 0;
+    PyObject *key, *val;
+    long count = 0;
+
+    while ( PyDict_Next(dict, &pos, &key, &val) ) {
+        PyObject *kstr = PyObject_CallMethod(key, (char*)"__str__", nullptr);
+        PyObject *vstr = PyObject_CallMethod(val, (char*)"__str__", nullptr);
+        Params::insert_shared(set, SST_ConvertToCppString(kstr), SST_ConvertToCppString(vstr));
+        Py_XDECREF(kstr);
+        Py_XDECREF(vstr);
+        count++;
+    }
+    return SST_ConvertToPythonLong(count);
+}
+
+
 static PyObject* pushNamePrefix(PyObject* UNUSED(self), PyObject* arg)
 {
     const char *name = nullptr;
@@ -768,6 +1018,12 @@ static PyMethodDef sstModuleMethods[] = {
   {   "getProgramOptions",
       getProgramOptions, METH_NOARGS,
       "Returns a dict of the current program options."},
+  {   "addSharedParam",
+      addSharedParam, METH_VARARGS,
+      "Adds a parameter(set, name, value) to a shared parameter set"},
+  {   "addSharedParams",
+      addSharedParams, METH_VARARGS,
+      "Adds multiple parameters from a dict to a shared parameter set"},
   {   "pushNamePrefix",
       pushNamePrefix, METH_O,
       "Pushes a string onto the prefix of new component and link names"},
@@ -825,9 +1081,18 @@ static PyMethodDef sstModuleMethods[] = {
   {   "setStatisticLoadLevelForComponentType",
       setStatisticLoadLevelForComponentType, METH_VARARGS,
       "Sets the statistic load level for all components of the specified type."},
+  {   "addComponents",
+      (PyCFunction)(void(*)(void))addComponents, METH_VARARGS | METH_KEYWORDS,
+      "Creates count components named <name>0, <name>1, ... of one type, all subscribed to one shared parameter set holding the optional params dict (form: addComponents(name, type, count, params)).  Returns the id of the first component; the others have consecutive ids."},
+  {   "connectComponents",
+      (PyCFunction)(void(*)(void))connectComponents, METH_VARARGS | METH_KEYWORDS,
+      "Creates links <name>0, <name>1, ... from parallel arrays (form: connectComponents(name, comp0, port0, comp1, port1, latency, no_cut=False)).  comp0 and comp1 are sequences or integer buffers of component or subcomponent ids; the ports and latency are a string or a list of strings.  Returns the number of links."},
   {   "findComponentByName",
       findComponentByName, METH_O,
       "Looks up to find a previously created component/subcomponent, based off of its name.  Returns None if none are to be found."},
+  {   "findComponentById",
+      findComponentById, METH_O,
+      "Returns a handle for the component/subcomponent with the given id, such as one returned by addComponents().  Returns None if there is no such component."},
   {   nullptr, nullptr, 0, nullptr }
 };
 
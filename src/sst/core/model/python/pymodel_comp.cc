@@ -38,39 +38,24 @@ extern SST::Core::SSTPythonModelDefinition *gModel;
 extern "C" {
 
 
-ConfigComponent* ComponentHolder::getSubComp(const std::string& name, int slot_num)
-{
-    for ( auto &sc : getComp()->subComponents ) {
-        if ( sc.name == name && sc.slot_num == slot_num)
-            return &sc;
+ConfigComponent* getComp(PyObject *pobj) {
+    ComponentId_t id = ((ComponentPy_t*)pobj)->id;
+    ConfigGraph* graph = gModel->getGraph();
+    ConfigComponent *c = nullptr;
+    if ( graph->containsComponent(COMPONENT_ID_MASK(id)) ) c = graph->findComponent(id);
+    if ( c == nullptr ) {
+        PyErr_SetString(PyExc_RuntimeError, "Failed to find ConfigComponent");
     }
-    return nullptr;
-}
-
-ComponentId_t ComponentHolder::getID()
-{
-    return id;
-}
-
-std::string ComponentHolder::getName() {
-    return getComp()->name;
-}
-
-ConfigComponent* ComponentHolder::getComp() {
-    return gModel->getGraph()->findComponent(id);
-}
-    
-
-int ComponentHolder::compare(ComponentHolder *other) {
-    if (id < other->id) return -1;
-    else if (id > other->id ) return 1;
-    else return 0;    
+    return c;
 }
 
 
-
-int PySubComponent::getSlot() {
-    return getComp()->slot_num;
+PyObject* createComponentHandle(ComponentId_t id)
+{
+    PyTypeObject* type = SUBCOMPONENT_ID_MASK(id) == 0 ? &PyModel_ComponentType : &PyModel_SubComponentType;
+    ComponentPy_t* self = (ComponentPy_t*)type->tp_alloc(type, 0);
+    if ( nullptr != self ) self->id = id;
+    return (PyObject*)self;
 }
 
 
@@ -81,16 +66,14 @@ static int compInit(ComponentPy_t *self, PyObject *args, PyObject *UNUSED(kwds))
     if ( !PyArg_ParseTuple(args, "ss|k", &name, &type, &useID) )
         return -1;
 
-    PyComponent *obj;
     if ( useID == UNSET_COMPONENT_ID ) {
         char* prefixed_name = gModel->addNamePrefix(name);
-        ComponentId_t id = gModel->addComponent(prefixed_name, type);
-        obj = new PyComponent(self,id);
-        gModel->getOutput()->verbose(CALL_INFO, 3, 0, "Creating component [%s] of type [%s]: id [%" PRIu64 "]\n", name, type, id);
+        self->id = gModel->addComponent(prefixed_name, type);
+        free(prefixed_name);
+        gModel->getOutput()->verbose(CALL_INFO, 3, 0, "Creating component [%s] of type [%s]: id [%" PRIu64 "]\n", name, type, self->id);
     } else {
-        obj = new PyComponent(self,useID);
+        self->id = useID;
     }
-    self->obj = obj;
 
     return 0;
 }
@@ -98,7 +81,6 @@ static int compInit(ComponentPy_t *self, PyObject *args, PyObject *UNUSED(kwds))
 
 static void compDealloc(ComponentPy_t *self)
 {
-    if ( self->obj ) delete self->obj;
     Py_TYPE(self)->tp_free((PyObject*)self);
 }
 
@@ -149,6 +131,19 @@ static PyObject* compAddParams(PyObject *self, PyObject *args)
 }
 
 
+static PyObject* compAddSharedParamSet(PyObject *self, PyObject *args)
+{
+    ConfigComponent *c = getComp(self);
+    if ( nullptr == c ) return nullptr;
+
+    PyObject* vstr = PyObject_CallMethod(args, (char*)"__str__", nullptr);
+    c->addSharedParamSet(SST_ConvertToCppString(vstr));
+    Py_XDECREF(vstr);
+
+    return SST_ConvertToPythonLong(0);
+}
+
+
 static PyObject* compSetRank(PyObject *self, PyObject *args)
 {
     ConfigComponent *c = getComp(self);
@@ -213,20 +208,38 @@ static PyObject* compAddLink(PyObject *self, PyObject *args)
 
 static PyObject* compGetFullName(PyObject *self, PyObject *UNUSED(args))
 {
-    return SST_ConvertToPythonString(getComp(self)->getFullName().c_str());
+    ConfigComponent *c = getComp(self);
+    if ( nullptr == c ) return nullptr;
+    return SST_ConvertToPythonString(c->getFullName().c_str());
+}
+
+static int compareIds(PyObject *obj0, PyObject *obj1) {
+    ComponentId_t id0 = ((ComponentPy_t*)obj0)->id;
+    ComponentId_t id1 = ((ComponentPy_t*)obj1)->id;
+    if ( id0 < id1 ) return -1;
+    else if ( id0 > id1 ) return 1;
+    else return 0;
 }
 
 #if PY_MAJOR_VERSION >= 3
+static bool isComponentHandle(PyObject *obj) {
+    return PyObject_TypeCheck(obj, &PyModel_ComponentType) || PyObject_TypeCheck(obj, &PyModel_SubComponentType);
+}
+
 static PyObject* compCompare(PyObject *obj0, PyObject *obj1, int op) {
+    if ( !isComponentHandle(obj0) || !isComponentHandle(obj1) ) {
+        Py_INCREF(Py_NotImplemented);
+        return Py_NotImplemented;
+    }
     PyObject *result;
     bool cmp = false;
     switch(op) {
-        case Py_LT: cmp = ((ComponentHolder*)obj0)->compare(((ComponentPy_t*)obj1)->obj) == -1; break;
-        case Py_LE: cmp = ((ComponentHolder*)obj0)->compare(((ComponentPy_t*)obj1)->obj) != 1; break;
-        case Py_EQ: cmp = ((ComponentHolder*)obj0)->compare(((ComponentPy_t*)obj1)->obj) == 0; break;
-        case Py_NE: cmp = ((ComponentHolder*)obj0)->compare(((ComponentPy_t*)obj1)->obj) != 0; break;
-        case Py_GT: cmp = ((ComponentHolder*)obj0)->compare(((ComponentPy_t*)obj1)->obj) == 1; break;
-        case Py_GE: cmp = ((ComponentHolder*)obj0)->compare(((ComponentPy_t*)obj1)->obj) != -1; break;
+        case Py_LT: cmp = compareIds(obj0, obj1) == -1; break;
+        case Py_LE: cmp = compareIds(obj0, obj1) != 1; break;
+        case Py_EQ: cmp = compareIds(obj0, obj1) == 0; break;
+        case Py_NE: cmp = compareIds(obj0, obj1) != 0; break;
+        case Py_GT: cmp = compareIds(obj0, obj1) == 1; break;
+        case Py_GE: cmp = compareIds(obj0, obj1) != -1; break;
     }
     result = cmp ? Py_True : Py_False;
     Py_INCREF(result);
@@ -234,14 +247,27 @@ static PyObject* compCompare(PyObject *obj0, PyObject *obj1, int op) {
 }
 #else
 static int compCompare(PyObject *obj0, PyObject *obj1) {
-    return ((ComponentHolder*)obj0)->compare(((ComponentHolder*)obj1));
+    return compareIds(obj0, obj1);
 }
 #endif
 
+// Handles are created on demand, so two handles for the same component
+// must compare and hash the same
+static long compHash(PyObject *self) {
+    return (long)(((ComponentPy_t*)self)->id & 0x7fffffffffffffffULL);
+}
+
 
 static PyObject* compGetType(PyObject *self, PyObject *UNUSED(args))
 {
-    return PyUnicode_FromString(getComp(self)->type.c_str());
+    ConfigComponent *c = getComp(self);
+    if ( nullptr == c ) return nullptr;
+    return PyUnicode_FromString(c->type.c_str());
+}
+
+static PyObject* compGetId(PyObject *self, PyObject *UNUSED(args))
+{
+    return SST_ConvertToPythonLong(((ComponentPy_t*)self)->id);
 }
 
 static PyObject* compSetSubComponent(PyObject *self, PyObject *args)
@@ -259,10 +285,8 @@ static PyObject* compSetSubComponent(PyObject *self, PyObject *args)
     ComponentId_t subC_id = c->getNextSubComponentID();
     ConfigComponent* sub = c->addSubComponent(subC_id, name, type, slot);
     if ( nullptr != sub ) {
-        PyObject *argList = Py_BuildValue("Ok", self, subC_id);
-        PyObject *subObj = PyObject_CallObject((PyObject*)&PyModel_SubComponentType, argList);
-        Py_DECREF(argList);
-        return subObj;
+        gModel->getOutput()->verbose(CALL_INFO, 3, 0, "Creating subcomponent [%s] of type [%s]]\n", name, type);
+        return createComponentHandle(subC_id);
     }
 
     char errMsg[1024] = {0};
@@ -417,6 +441,9 @@ static PyMethodDef componentMethods[] = {
     {   "addParams",
         compAddParams, METH_O,
         "Adds Multiple Parameters from a dict"},
+    {   "addSharedParamSet",
+        compAddSharedParamSet, METH_O,
+        "Subscribes to a shared parameter set created with sst.addSharedParam(s)"},
     {   "setRank",
         compSetRank, METH_VARARGS,
         "Sets which rank on which this component should sit"},
@@ -432,6 +459,9 @@ static PyMethodDef componentMethods[] = {
     {   "getType",
         compGetType, METH_NOARGS,
         "Returns the type of the component."},
+    {   "getId",
+        compGetId, METH_NOARGS,
+        "Returns the id of the component, for use with connectComponents()"},
     {   "setStatisticLoadLevel",
         compSetStatisticLoadLevel, METH_VARARGS,
         "Sets the statistics load level for this component"},
@@ -471,7 +501,7 @@ PyTypeObject PyModel_ComponentType = {
     nullptr,                         /* tp_as_number */
     nullptr,                         /* tp_as_sequence */
     nullptr,                         /* tp_as_mapping */
-    nullptr,                         /* tp_hash */
+    (hashfunc)compHash,              /* tp_hash */
     nullptr,                         /* tp_call */
     nullptr,                         /* tp_str */
     nullptr,                         /* tp_getattro */
@@ -521,31 +551,14 @@ REENABLE_WARNING
 
 static int subCompInit(ComponentPy_t *self, PyObject *args, PyObject *UNUSED(kwds))
 {
-    ComponentId_t id;
     PyObject *parent;
-    // if ( !PyArg_ParseTuple(args, "Ossii", &parent, &name, &type, &slot, &id) )
-    if ( !PyArg_ParseTuple(args, "Ok", &parent, &id) )
+    if ( !PyArg_ParseTuple(args, "Ok", &parent, &self->id) )
         return -1;
 
-    PySubComponent *obj = new PySubComponent(self,id);
-    
-    self->obj = obj;
-
-    gModel->getOutput()->verbose(CALL_INFO, 3, 0, "Creating subcomponent [%s] of type [%s]]\n", getComp((PyObject*)self)->name.c_str(), getComp((PyObject*)self)->type.c_str());
-
     return 0;
 }
 
 
-static void subCompDealloc(ComponentPy_t *self)
-{
-    if ( self->obj ) {
-        delete self->obj;
-    }
-    Py_TYPE(self)->tp_free((PyObject*)self);
-}
-
-
 
 static PyMethodDef subComponentMethods[] = {
     {   "addParam",
@@ -554,6 +567,9 @@ static PyMethodDef subComponentMethods[] = {
     {   "addParams",
         compAddParams, METH_O,
         "Adds Multiple Parameters from a dict"},
+    {   "addSharedParamSet",
+        compAddSharedParamSet, METH_O,
+        "Subscribes to a shared parameter set created with sst.addSharedParam(s)"},
     {   "addLink",
         compAddLink, METH_VARARGS,
         "Connects this subComponent to a Link"},
@@ -563,6 +579,9 @@ static PyMethodDef subComponentMethods[] = {
     {   "getType",
         compGetType, METH_NOARGS,
         "Returns the type of the component."},
+    {   "getId",
+        compGetId, METH_NOARGS,
+        "Returns the id of the component, for use with connectComponents()"},
     {   "setStatisticLoadLevel",
         compSetStatisticLoadLevel, METH_VARARGS,
         "Sets the statistics load level for this component"},
@@ -592,7 +611,7 @@ PyTypeObject PyModel_SubComponentType = {
     "sst.SubComponent",        /* tp_name */
     sizeof(ComponentPy_t),     /* tp_basicsize */
     0,                         /* tp_itemsize */
-    (destructor)subCompDealloc,/* tp_dealloc */
+    (destructor)compDealloc,   /* tp_dealloc */
     SST_TP_VECTORCALL_OFFSET       /* Python3 only */
     SST_TP_PRINT                   /* Python2 only */
     nullptr,                         /* tp_getattr */
@@ -603,7 +622,7 @@ PyTypeObject PyModel_SubComponentType = {
     nullptr,                         /* tp_as_number */
     nullptr,                         /* tp_as_sequence */
     nullptr,                         /* tp_as_mapping */
-    nullptr,                         /* tp_hash */
+    (hashfunc)compHash,              /* tp_hash */
     nullptr,                         /* tp_call */
     nullptr,                         /* tp_str */
     nullptr,                         /* tp_getattro */
@@ -19,52 +19,23 @@
 extern "C" {
 
 
-struct ComponentPy_t;
-struct PyComponent;
-
-struct ComponentHolder {
-    ComponentPy_t *pobj;
-    // ConfigComponent* config;
-    ComponentId_t id;
-    
-    ComponentHolder(ComponentPy_t *pobj, ComponentId_t id) : pobj(pobj), id(id) { }
-    virtual ~ComponentHolder() { }
-    virtual ConfigComponent* getComp();
-    virtual int compare(ComponentHolder *other);
-    virtual std::string getName();
-    ComponentId_t getID();
-    ConfigComponent* getSubComp(const std::string& name, int slot_num);
-};
-
-struct PyComponent : ComponentHolder {
-    uint16_t subCompId;
-
-    PyComponent(ComponentPy_t *pobj, ComponentId_t id) : ComponentHolder(pobj,id), subCompId(0) { }
-    ~PyComponent() {}
-};
-
-struct PySubComponent : ComponentHolder {
-    PySubComponent(ComponentPy_t *pobj, ComponentId_t id) : ComponentHolder(pobj,id) { }
-    ~PySubComponent() {}
-    int getSlot();
-};
-
-
+/* Python handle for a component or subcomponent.  It only holds the
+ * id; everything else is looked up in the ConfigGraph, which is the
+ * single copy of the component's configuration.  Handles are created
+ * on demand and freed as soon as the script drops them. */
 struct ComponentPy_t {
     PyObject_HEAD
-    ComponentHolder *obj;
+    ComponentId_t id;
 };
 
 extern PyTypeObject PyModel_ComponentType;
 extern PyTypeObject PyModel_SubComponentType;
 
-static inline ConfigComponent* getComp(PyObject *pobj) {
-    ConfigComponent *c = ((ComponentPy_t*)pobj)->obj->getComp();
-    if ( c == nullptr ) {
-        PyErr_SetString(PyExc_RuntimeError, "Failed to find ConfigComponent");
-    }
-    return c;
-}
+/* Create a new handle for an existing component or subcomponent */
+PyObject* createComponentHandle(ComponentId_t id);
+
+/* Find the ConfigComponent for a handle */
+ConfigComponent* getComp(PyObject *pobj);
 
 
 }  /* extern C */
@@ -99,9 +99,13 @@ static PyObject* linkConnect(PyObject* self, PyObject *args)
         return nullptr;
     }
 
+    ConfigComponent *cc0 = getComp(c0);
+    if ( nullptr == cc0 ) return nullptr;
+    ConfigComponent *cc1 = getComp(c1);
+    if ( nullptr == cc1 ) return nullptr;
     ComponentId_t id0, id1;
-    id0 = getComp(c0)->id;
-    id1 = getComp(c1)->id;
+    id0 = cc0->id;
+    id1 = cc1->id;
 
     gModel->getOutput()->verbose(CALL_INFO, 3, 0, "Connecting components %" PRIu64 " and %" PRIu64 " to Link %s (lat: %s %s)\n",
             id0, id1, ((LinkPy_t*)self)->name, lat0, lat1);
@@ -104,7 +104,7 @@ static PyObject* sgAddComp(PyObject *self, PyObject *args)
 
     if ( PyObject_TypeCheck(args, &PyModel_ComponentType) ||
             PyObject_TypeCheck(args, &PyModel_SubComponentType) ) {
-        csg->addComponent(((ComponentPy_t*)args)->obj->getID());
+        csg->addComponent(((ComponentPy_t*)args)->id);
     } else {
         PyErr_SetString(PyExc_TypeError, "Expected Component or SubComponent type");
         return nullptr;
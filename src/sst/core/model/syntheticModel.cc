@@ -0,0 +1,161 @@
+// Copyright 2009-2020 NTESS. Under the terms
+// of Contract DE-NA0003525 with NTESS, the U.S.
+// Government retains certain rights in this software.
+//
+// Copyright (c) 2009-2020, NTESS
+// All rights reserved.
+//
+// This file is part of the SST software package. For license
+// information, see the LICENSE file in the top level directory of the
+// distribution.
+
+
+#include "sst_config.h"
+#include "sst/core/model/syntheticModel.h"
+
+#include "sst/core/config.h"
+#include "sst/core/configGraph.h"
+#include "sst/core/output.h"
+
+#include <cerrno>
+#include <cinttypes>
+#include <cmath>
+#include <cstdlib>
+#include <vector>
+
+using namespace SST;
+using namespace SST::Core;
+
+SSTSyntheticModelDefinition::SSTSyntheticModelDefinition(const std::string& opts, int verbosity, Config* config) :
+    SSTModelDescription(),
+    config(config)
+{
+    output = new Output("SSTSyntheticModel: ", verbosity, 0, SST::Output::STDOUT);
+
+    // Split "key=value" pairs on commas and white space
+    size_t pos = 0;
+    while ( pos < opts.size() ) {
+        size_t end = opts.find_first_of(", \t", pos);
+        if ( end == std::string::npos ) end = opts.size();
+        std::string item = opts.substr(pos, end - pos);
+        pos = end + 1;
+        if ( item.empty() ) continue;
+
+        size_t eq = item.find('=');
+        if ( eq == std::string::npos || eq == 0 ) {
+            output->fatal(CALL_INFO, 1, "Synthetic model option '%s' is not of the form key=value\n", item.c_str());
+        }
+        options[item.substr(0, eq)] = item.substr(eq + 1);
+    }
+
+    static const char* known[] = { "components", "degree", "depth", "latency", "events", "stop",
+                                   "component", "subcomponent" };
+    for ( auto& opt : options ) {
+        bool found = false;
+        for ( const char* k : known ) found |= (opt.first == k);
+        if ( !found ) {
+            output->fatal(CALL_INFO, 1, "Unknown synthetic model option '%s'\n", opt.first.c_str());
+        }
+    }
+}
+
+SSTSyntheticModelDefinition::~SSTSyntheticModelDefinition()
+{
+    delete output;
+}
+
+std::string
+SSTSyntheticModelDefinition::getOption(const std::string& key, const std::string& def) const
+{
+    auto it = options.find(key);
+    return it == options.end() ? def : it->second;
+}
+
+uint64_t
+SSTSyntheticModelDefinition::getUIntOption(const std::string& key, uint64_t def) const
+{
+    auto it = options.find(key);
+    if ( it == options.end() ) return def;
+
+    char* end = nullptr;
+    errno = 0;
+    unsigned long long val = strtoull(it->second.c_str(), &end, 0);
+    if ( errno != 0 || end == it->second.c_str() || *end != '\0' ) {
+        output->fatal(CALL_INFO, 1, "Synthetic model option %s=%s is not an unsigned integer\n",
+                      key.c_str(), it->second.c_str());
+    }
+    return val;
+}
+
+ConfigGraph*
+SSTSyntheticModelDefinition::createConfigGraph()
+{
+    const uint64_t numComps = getUIntOption("components", 1000);
+    const uint64_t degree = getUIntOption("degree", 4);
+    const uint64_t depth = getUIntOption("depth", 0);
+    const uint64_t events = getUIntOption("events", 0);
+    const std::string latency = getOption("latency", "1ns");
+    const std::string compType = getOption("component", "coreTestElement.coreTestPerfComponent");
+    const std::string subType = getOption("subcomponent", "coreTestElement.coreTestPerfSubComponent");
+
+    if ( numComps == 0 ) {
+        output->fatal(CALL_INFO, 1, "Synthetic model needs at least one component\n");
+    }
+    if ( degree % 2 != 0 ) {
+        output->fatal(CALL_INFO, 1, "Synthetic model degree must be even, got %" PRIu64 "\n", degree);
+    }
+
+    // Run for a short, fixed time unless the user said otherwise
+    if ( options.count("stop") || config->stopAtCycle == "0 ns" ) {
+        config->stopAtCycle = getOption("stop", "1us");
+    }
+
+    // One stride per pair of ports; spread them like the dimensions of
+    // a torus so both near and far links exist
+    const uint64_t dims = degree / 2;
+    std::vector<uint64_t> strides;
+    if ( numComps > 1 ) {
+        uint64_t k = (uint64_t)std::ceil(std::pow((double)numComps, 1.0 / (dims ? dims : 1)));
+        if ( k < 2 ) k = 2;
+        uint64_t stride = 1;
+        for ( uint64_t j = 0; j < dims; j++ ) {
+            uint64_t s = stride % numComps;
+            strides.push_back(s ? s : 1);
+            stride *= k;
+        }
+    }
+
+    output->verbose(CALL_INFO, 1, 0, "Building %" PRIu64 " components with %zu links each and %" PRIu64
+                    " levels of subcomponents\n", numComps, 2 * strides.size(), depth);
+
+    ConfigGraph* graph = new ConfigGraph();
+    std::vector<ComponentId_t> ids;
+    ids.reserve(numComps);
+
+    const std::string numPorts = std::to_string(2 * strides.size());
+    const std::string initialEvents = std::to_string(events);
+    for ( uint64_t i = 0; i < numComps; i++ ) {
+        ComponentId_t id = graph->addComponent("c" + std::to_string(i), compType);
+        ids.push_back(id);
+
+        ConfigComponent* comp = graph->findComponent(id);
+        comp->addParameter("num_ports", numPorts, true);
+        comp->addParameter("initial_events", initialEvents, true);
+        comp->addParameter("forward", events ? "random" : "none", true);
+
+        ConfigComponent* parent = comp;
+        for ( uint64_t d = 0; d < depth; d++ ) {
+            parent = parent->addSubComponent(parent->getNextSubComponentID(), "child", subType, 0);
+        }
+    }
+
+    for ( uint64_t i = 0; i < numComps; i++ ) {
+        for ( size_t j = 0; j < strides.size(); j++ ) {
+            std::string name = "l" + std::to_string(i) + "_" + std::to_string(j);
+            graph->addLink(ids[i], name, "port" + std::to_string(2 * j), latency);
+            graph->addLink(ids[(i + strides[j]) % numComps], name, "port" + std::to_string(2 * j + 1), latency);
+        }
+    }
+
+    return graph;
+}
@@ -0,0 +1,75 @@
+// -*- c++ -*-
+
+// Copyright 2009-2020 NTESS. Under the terms
+// of Contract DE-NA0003525 with NTESS, the U.S.
+// Government retains certain rights in this software.
+//
+// Copyright (c) 2009-2020, NTESS
+// All rights reserved.
+//
+// This file is part of the SST software package. For license
+// information, see the LICENSE file in the top level directory of the
+// distribution.
+
+
+#ifndef SST_CORE_MODEL_SYNTHETIC_H
+#define SST_CORE_MODEL_SYNTHETIC_H
+
+#include <map>
+#include <string>
+
+#include "sst/core/model/sstmodel.h"
+
+namespace SST {
+
+class Config;
+class Output;
+
+namespace Core {
+
+/**
+ * Builds a large, regular ConfigGraph directly in C++, selected with
+ * --synthetic-model.  It is used to measure how start-up (graph
+ * construction, partitioning, graph broadcast and wire-up) scales with
+ * the number of components without the cost of a Python model.
+ *
+ * The options are a list of key=value pairs separated by commas or
+ * spaces:
+ *
+ *   components    number of components (default 1000)
+ *   degree        links per component, must be even (default 4)
+ *   depth         length of the chain of subcomponents loaded by each
+ *                 component (default 0)
+ *   latency       link latency (default 1ns)
+ *   events        events each component sends at setup (default 0)
+ *   stop          simulated time to run for (default 1us)
+ *   component     component type (default coreTestElement.coreTestPerfComponent)
+ *   subcomponent  subcomponent type (default coreTestElement.coreTestPerfSubComponent)
+ *
+ * Component i is linked to components i + 1, i + k, i + k^2, ...
+ * (modulo the number of components) for degree/2 strides, where k is
+ * chosen so that the strides span the graph like a torus of degree/2
+ * dimensions.  Port 2j carries the link for stride j and port 2j+1 the
+ * link arriving from component i - stride j.
+ */
+class SSTSyntheticModelDefinition : public SSTModelDescription {
+
+public:
+    SSTSyntheticModelDefinition(const std::string& options, int verbosity, Config* config);
+    virtual ~SSTSyntheticModelDefinition();
+
+    ConfigGraph* createConfigGraph() override;
+
+private:
+    std::string getOption(const std::string& key, const std::string& def) const;
+    uint64_t getUIntOption(const std::string& key, uint64_t def) const;
+
+    Output* output;
+    Config* config;
+    std::map<std::string, std::string> options;
+};
+
+} // namespace Core
+} // namespace SST
+
+#endif // SST_CORE_MODEL_SYNTHETIC_H
@@ -22,6 +22,7 @@ namespace SST {
 OneShot::OneShot(TimeConverter* timeDelay, int priority) :
     Action(),
     m_timeDelay(timeDelay),
+    m_firstId(0),
     m_scheduled(false)
 {
     setPriority(priority);
@@ -29,53 +30,41 @@ OneShot::OneShot(TimeConverter* timeDelay, int priority) :
 
 OneShot::~OneShot()
 {
-    HandlerList_t*        ptrHandlerList;
-    OneShot::HandlerBase* handler;
-
-//    std::cout << "OneShot (destructor) #" << m_timeDelay->getFactor() << " Destructor;" << std::endl;
-
-    // For all the entries in the map, find each vector set
-    for (HandlerVectorMap_t::iterator m_it = m_HandlerVectorMap.begin(); m_it != m_HandlerVectorMap.end(); ++m_it ) {
-        ptrHandlerList = m_it->second;
-
-        // Delete all handlers in the list
-        for (HandlerList_t::iterator v_it = ptrHandlerList->begin(); v_it != ptrHandlerList->end(); ++v_it ) {
-            handler = *v_it;
-            delete handler;
-        }
-        ptrHandlerList->clear();
-        delete ptrHandlerList;
+    // Delete all the handlers still waiting to be called
+    for ( OneShot::HandlerBase* handler : m_handlers ) {
+        delete handler;
     }
-    m_HandlerVectorMap.clear();
+    m_handlers.clear();
+    m_deliveries.clear();
 }
 
-void OneShot::registerHandler(OneShot::HandlerBase* handler)
+OneShot::HandlerId_t OneShot::registerHandler(OneShot::HandlerBase* handler)
 {
-    SimTime_t      nextEventTime;
-    HandlerList_t* ptrHandlerList;
-
     // Since we have a new handler, schedule the OneShot to callback in the future
-    nextEventTime = computeDeliveryTime();
-
-    // Check to see if the nextEventTime is already in our map.  Only
-    // need to check the first entry.  Anything else would have for
-    // sure been put in at an earlier time, and therefore could not
-    // have the same delivery time.
-    if ( m_HandlerVectorMap.empty() ||  m_HandlerVectorMap.front().first != nextEventTime ) {
-        // HandlerList with the specific nextEventTime not found,
-        // create a new one and add it to the map of Vectors
-        ptrHandlerList = new HandlerList_t();
-        m_HandlerVectorMap.emplace_front(nextEventTime,ptrHandlerList);
-    }
-    else {
-        ptrHandlerList = m_HandlerVectorMap.front().second;
-    }
+    SimTime_t nextEventTime = computeDeliveryTime();
 
-    // Add the handler to the list of handlers
-    ptrHandlerList->push_back(handler);
+    // Only the newest delivery time can match, since everything else
+    // was registered earlier with the same delay
+    if ( m_deliveries.empty() || m_deliveries.back().first != nextEventTime ) {
+        m_deliveries.emplace_back(nextEventTime, 0);
+    }
+    m_deliveries.back().second++;
+    m_handlers.push_back(handler);
 
     // Call scheduleOneShot() to make sure we're scheduled
     scheduleOneShot();
+
+    return m_firstId + m_handlers.size() - 1;
+}
+
+bool OneShot::cancel(HandlerId_t id)
+{
+    if ( id < m_firstId || id - m_firstId >= m_handlers.size() ) return false;
+
+    OneShot::HandlerBase*& handler = m_handlers[id - m_firstId];
+    if ( nullptr == handler ) return false;
+    handler = nullptr;
+    return true;
 }
 
 SimTime_t OneShot::computeDeliveryTime()
@@ -92,9 +81,9 @@ void OneShot::scheduleOneShot()
 {
     // If we aren't scheduled, put ourself in the event queue.  We
     // schedule based on the oldest entry in queue.
-    if ( !m_scheduled && !m_HandlerVectorMap.empty() ) {
+    if ( !m_scheduled && !m_deliveries.empty() ) {
         // Add this one shot to the Activity queue, and mark this OneShot at scheduled
-        Simulation::getSimulation()->insertActivity(m_HandlerVectorMap.back().first, this);
+        Simulation::getSimulation()->insertActivity(m_deliveries.front().first, this);
         m_scheduled = true;
     }
 }
@@ -103,35 +92,32 @@ void OneShot::execute(void)
 {
     // Execute the OneShot when the TimeVortex tells us to go.
     // This will call all registered callbacks.
-    OneShot::HandlerBase* handler;
-    HandlerList_t*        ptrHandlerList;
+    m_scheduled = false;
 
     // Figure out the current sim time
     SimTime_t currentEventTime = Simulation::getSimulation()->getCurrentSimCycle();
 
-    if (m_HandlerVectorMap.back().first != currentEventTime ) {
+    if ( m_deliveries.front().first != currentEventTime ) {
         // This shouldn't happen, but if we're not at the right time,
         // then simply reschedule.
         scheduleOneShot();
         return;
     }
 
-    // Get the List of Handlers for this time
-    ptrHandlerList = m_HandlerVectorMap.back().second;
+    // Take the handlers due now off the queues before calling them, as
+    // they may register or cancel other calls
+    size_t count = m_deliveries.front().second;
+    m_deliveries.pop_front();
 
-    // Walk the list of all handlers, and call them.
-    for (HandlerList_t::iterator it = ptrHandlerList->begin(); it != ptrHandlerList->end(); ++it ) {
-        handler = *it;
+    for ( size_t i = 0; i < count; i++ ) {
+        OneShot::HandlerBase* handler = m_handlers.front();
+        m_handlers.pop_front();
+        m_firstId++;
 
         // Call the registered Callback handlers
-        ((*handler)());
+        if ( nullptr != handler ) (*handler)();
     }
 
-    // Delete the Handler list and remove it from the map
-    delete ptrHandlerList;
-    m_HandlerVectorMap.pop_back();
-    m_scheduled = false;
-
     // Reschedule if there are any events left
     scheduleOneShot();
 }
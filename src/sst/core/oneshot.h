@@ -16,6 +16,7 @@
 #include "sst/core/sst_types.h"
 
 #include <cinttypes>
+#include <deque>
 
 #include "sst/core/action.h"
 
@@ -110,10 +111,26 @@ public:
 
     /////////////////////////////////////////////////
 
+    /** Identifies one pending call of a handler, see cancel() */
+    typedef uint64_t HandlerId_t;
+
+    /** A pending call of a handler on a particular OneShot, so it can
+     * be cancelled without knowing the delay it was registered with */
+    struct Handle {
+        OneShot*    oneShot;
+        HandlerId_t id;
+
+        Handle() : oneShot(nullptr), id(0) {}
+        Handle(OneShot* oneShot, HandlerId_t id) : oneShot(oneShot), id(id) {}
+
+        /** Stop the call.  The handler is not deleted.
+         * @return true if the call was still pending
+         */
+        bool cancel() { return nullptr != oneShot && oneShot->cancel(id); }
+    };
+
     /** Create a new One Shot for a specified time that will callback the
         handler function.
-        Note: OneShot cannot be canceled, and will always callback after
-              the timedelay.
     */
     OneShot(TimeConverter* timeDelay, int priority = ONESHOTPRIORITY);
     ~OneShot();
@@ -121,19 +138,28 @@ public:
     /** Is OneShot scheduled */
     bool isScheduled() {return m_scheduled;}
 
-    /** Add a handler to be called on this OneShot Event */
-    void registerHandler(OneShot::HandlerBase* handler);
+    /** Add a handler to be called on this OneShot Event
+     * @return id that can be passed to cancel()
+     */
+    HandlerId_t registerHandler(OneShot::HandlerBase* handler);
+
+    /** Stop a pending call of a handler.  The handler is not deleted.
+     * @return true if the call was still pending
+     */
+    bool cancel(HandlerId_t id);
 
     /** Print details about the OneShot */
     void print(const std::string& header, Output &out) const override;
 
 private:
-    typedef std::vector<OneShot::HandlerBase*>  HandlerList_t;
     // Since this only gets fixed latency events, the times will fire
-    // in order of arrival.  No need to use a full map, a double ended
-    // queue will work just as well
-    // typedef std::map<SimTime_t, HandlerList_t*> HandlerVectorMap_t;
-    typedef std::deque<std::pair<SimTime_t, HandlerList_t*> > HandlerVectorMap_t;
+    // in order of arrival, so two FIFOs work as a timing wheel: the
+    // handlers in the order they were registered, and for each
+    // delivery time the number of handlers due then.  Both insert and
+    // cancel are O(1), and there is one activity in the TimeVortex per
+    // delivery time.
+    typedef std::deque<OneShot::HandlerBase*> HandlerQueue_t;
+    typedef std::deque<std::pair<SimTime_t, size_t> > DeliveryQueue_t;
 
     // Generic constructor for serialization
     OneShot() { }
@@ -147,7 +173,9 @@ private:
     SimTime_t computeDeliveryTime();
 
     TimeConverter*      m_timeDelay;
-    HandlerVectorMap_t  m_HandlerVectorMap;
+    HandlerQueue_t      m_handlers;     // cancelled calls are nullptr
+    DeliveryQueue_t     m_deliveries;
+    HandlerId_t         m_firstId;      // id of m_handlers.front()
     bool                m_scheduled;
 
 };
@@ -14,6 +14,7 @@
 #include "sst/core/params.h"
 #include "sst/core/unitAlgebra.h"
 
+#include <algorithm>
 #include <map>
 #include <vector>
 #include <string>
@@ -25,41 +26,75 @@ const std::string&
 Params::getString(const std::string& name, bool& found) const
 {
     static std::string empty;
-    const_iterator i = data.find(getKey(name));
-    if ( i == data.end() ) {
+    const std::string* value = findValue(getKey(name));
+    if ( nullptr == value ) {
         found = false;
         return empty;
     }
     found = true;
-    return i->second;
+    return *value;
+}
+
+const std::string*
+Params::findValue(uint32_t id) const
+{
+    for ( auto set : data ) {
+        const_iterator i = set->find(id);
+        if ( i != set->end() ) return &i->second;
+    }
+    return nullptr;
+}
+
+void
+Params::getMergedParams(std::map<uint32_t, const std::string*>& merged) const
+{
+    // insert() does not overwrite, so earlier sets win
+    for ( auto set : data ) {
+        for ( const_iterator i = set->begin() ; i != set->end() ; ++i ) {
+            merged.insert(std::make_pair(i->first, &i->second));
+        }
+    }
 }
 
 size_t
 Params::size() const
 {
-    return data.size();
+    if ( data.size() == 1 ) return my_data.size();
+    size_t count = 0;
+    forEachParam([&count](uint32_t, const std::string&) { count++; });
+    return count;
 }
 
 bool
 Params::empty() const
 {
-    return data.empty();
+    for ( auto set : data ) {
+        if ( !set->empty() ) return false;
+    }
+    return true;
 }
 
 Params::Params() :
-    data(), verify_enabled(true)
-{}
+    my_data(), verify_enabled(true)
+{
+    data.push_back(&my_data);
+}
 
 Params::Params(const Params& old) :
+    my_data(old.my_data),
     data(old.data),
     allowedKeys(old.allowedKeys),
     verify_enabled(old.verify_enabled)
-{}
+{
+    data[0] = &my_data;
+}
 
 
 Params&
 Params::operator=(const Params& old) {
+    my_data = old.my_data;
     data = old.data;
+    data[0] = &my_data;
     verify_enabled = old.verify_enabled;
     allowedKeys = old.allowedKeys;
     return *this;
@@ -68,30 +103,32 @@ Params::operator=(const Params& old) {
 void
 Params::clear()
 {
-    data.clear();
+    my_data.clear();
+    data.resize(1);
 }
 
 
 size_t
 Params::count(const key_type& k)
 {
-    return data.count(getKey(k));
+    const Params* self = this;
+    return nullptr == findValue(self->getKey(k)) ? 0 : 1;
 }
 
 void
 Params::print_all_params(std::ostream &os, const std::string& prefix) const
 {
-    for (const_iterator i = data.begin() ; i != data.end() ; ++i) {
-        os << prefix << "key=" << keyMapReverse[i->first] << ", value=" << i->second << std::endl;
-    }
+    forEachParam([&](uint32_t id, const std::string& value) {
+        os << prefix << "key=" << keyMapReverse[id] << ", value=" << value << std::endl;
+    });
 }
 
 void
 Params::print_all_params(Output &out, const std::string& prefix) const
 {
-    for (const_iterator i = data.begin() ; i != data.end() ; ++i) {
-        out.output("%s%s = %s\n", prefix.c_str(), keyMapReverse[i->first].c_str(), i->second.c_str());
-    }
+    forEachParam([&](uint32_t id, const std::string& value) {
+        out.output("%s%s = %s\n", prefix.c_str(), keyMapReverse[id].c_str(), value.c_str());
+    });
 }
 
 
@@ -99,38 +136,133 @@ void
 Params::insert(const std::string& key, const std::string& value, bool overwrite)
 {
     if ( overwrite ) {
-        data[getKey(key)] = value;
+        my_data[getKey(key)] = value;
     }
     else {
         uint32_t id = getKey(key);
-        data.insert(std::make_pair(id, value));
+        my_data.insert(std::make_pair(id, value));
     }
 }
 
 void
 Params::insert(const Params& params)
 {
-    data.insert(params.data.begin(), params.data.end());
+    my_data.insert(params.my_data.begin(), params.my_data.end());
+    for ( size_t i = 1 ; i < params.data.size() ; i++ ) {
+        if ( std::find(data.begin(), data.end(), params.data[i]) == data.end() ) {
+            data.push_back(params.data[i]);
+        }
+    }
 }
 
 std::set<std::string>
 Params::getKeys() const
 {
     std::set<std::string> ret;
-    for (const_iterator i = data.begin() ; i != data.end() ; ++i) {
+    for ( auto set : data ) {
+        for (const_iterator i = set->begin() ; i != set->end() ; ++i) {
+            ret.insert(keyMapReverse[i->first]);
+        }
+    }
+    return ret;
+}
+
+std::set<std::string>
+Params::getLocalKeys() const
+{
+    std::set<std::string> ret;
+    for (const_iterator i = my_data.begin() ; i != my_data.end() ; ++i) {
         ret.insert(keyMapReverse[i->first]);
     }
     return ret;
 }
 
+void
+Params::insert_shared(const std::string& set, const key_type& key, const key_type& value, bool overwrite)
+{
+    if ( keyMapFrozen ) {
+        Output::getDefaultObject().fatal(CALL_INFO, 1, "Shared parameter set \"%s\" cannot be modified after graph construction\n",
+                                          set.c_str());
+    }
+    Params tmp;
+    uint32_t id = tmp.getKey(key);
+    if ( overwrite ) {
+        shared_params[set][id] = value;
+    }
+    else {
+        shared_params[set].insert(std::make_pair(id, value));
+    }
+}
+
+void
+Params::addSharedParamSet(const std::string& set)
+{
+    if ( keyMapFrozen && shared_params.find(set) == shared_params.end() ) {
+        Output::getDefaultObject().fatal(CALL_INFO, 1, "Unknown shared parameter set \"%s\"\n", set.c_str());
+    }
+    // Entries in std::map are never moved, so the pointer stays valid
+    const ParamSet_t* ptr = &shared_params[set];
+    if ( std::find(data.begin(), data.end(), ptr) == data.end() ) {
+        data.push_back(ptr);
+    }
+}
+
+std::vector<std::string>
+Params::getSubscribedSharedParamSets() const
+{
+    std::vector<std::string> ret;
+    for ( size_t i = 1 ; i < data.size() ; i++ ) {
+        for ( auto& set : shared_params ) {
+            if ( &set.second == data[i] ) {
+                ret.push_back(set.first);
+                break;
+            }
+        }
+    }
+    return ret;
+}
+
+std::vector<std::string>
+Params::getSharedParamSetNames()
+{
+    std::vector<std::string> ret;
+    for ( auto& set : shared_params ) {
+        ret.push_back(set.first);
+    }
+    return ret;
+}
+
+std::map<std::string, std::string>
+Params::getSharedParamSet(const std::string& set)
+{
+    std::map<std::string, std::string> ret;
+    auto it = shared_params.find(set);
+    if ( it == shared_params.end() ) return ret;
+    for ( const_iterator i = it->second.begin() ; i != it->second.end() ; ++i ) {
+        ret[keyMapReverse[i->first]] = i->second;
+    }
+    return ret;
+}
+
+void
+Params::freezeSharedData()
+{
+    std::lock_guard<SST::Core::ThreadSafe::Spinlock> lock(keyLock);
+    frozenKeyMap.clear();
+    frozenKeyMap.reserve(keyMap.size());
+    frozenKeyMap.insert(keyMap.begin(), keyMap.end());
+    lateKeys = 0;
+    keyMapFrozen = true;
+}
+
 Params
 Params::find_scoped_params(const std::string& prefix, const char* delims) const
 {
     int num_delims = ::strlen(delims);
     Params ret;
     ret.enableVerify(false);
-    for (const_iterator i = data.begin() ; i != data.end() ; ++i) {
-        auto& fullKeyName = keyMapReverse[i->first];
+    forEachParam([&](uint32_t id, const std::string& value) {
+        auto& fullKeyName = keyMapReverse[id];
         std::string key = fullKeyName.substr(0, prefix.length());
         auto start = prefix.length();
         if (key == prefix) {
@@ -143,10 +275,10 @@ Params::find_scoped_params(const std::string& prefix, const char* delims) const
             }
           }
           if (delimMatches){
-            ret.insert(keyMapReverse[i->first].substr(start +1), i->second);
+            ret.insert(fullKeyName.substr(start +1), value);
           }
         }
-    }
+    });
     ret.allowedKeys = allowedKeys;
     ret.enableVerify(verify_enabled);
     return ret;
@@ -157,12 +289,12 @@ Params::find_prefix_params(const std::string& prefix) const
 {
     Params ret;
     ret.enableVerify(false);
-    for (const_iterator i = data.begin() ; i != data.end() ; ++i) {
-        std::string key = keyMapReverse[i->first].substr(0, prefix.length());
+    forEachParam([&](uint32_t id, const std::string& value) {
+        std::string key = keyMapReverse[id].substr(0, prefix.length());
         if (key == prefix) {
-            ret.insert(keyMapReverse[i->first].substr(prefix.length()), i->second);
+            ret.insert(keyMapReverse[id].substr(prefix.length()), value);
         }
-    }
+    });
     ret.allowedKeys = allowedKeys;
     ret.enableVerify(verify_enabled);
 
@@ -172,7 +304,8 @@ Params::find_prefix_params(const std::string& prefix) const
 bool
 Params::contains(const key_type &k)
 {
-    return data.find(getKey(k)) != data.end();
+    const Params* self = this;
+    return nullptr != findValue(self->getKey(k));
 }
 
 void
@@ -212,12 +345,29 @@ Params::getParamName(uint32_t id)
 void
 Params::serialize_order(SST::Core::Serialization::serializer &ser)
 {
-    ser & data;
+    ser & my_data;
+    // Shared sets are broadcast once on their own; only the names of
+    // the subscribed sets go with each Params
+    std::vector<std::string> sets;
+    if ( ser.mode() != SST::Core::Serialization::serializer::UNPACK ) {
+        sets = getSubscribedSharedParamSets();
+    }
+    ser & sets;
+    if ( ser.mode() == SST::Core::Serialization::serializer::UNPACK ) {
+        data.clear();
+        data.push_back(&my_data);
+        for ( auto& set : sets ) addSharedParamSet(set);
+    }
 }
 
 uint32_t
 Params::getKey(const std::string& str) const
 {
+    if ( keyMapFrozen ) {
+        auto f = frozenKeyMap.find(str);
+        if ( f != frozenKeyMap.end() ) return f->second;
+        if ( lateKeys.load(std::memory_order_acquire) == 0 ) return (uint32_t)-1;
+    }
     std::lock_guard<SST::Core::ThreadSafe::Spinlock> lock(keyLock);
     std::map<std::string, uint32_t>::iterator i = keyMap.find(str);
     if ( i == keyMap.end() ) {
@@ -229,6 +379,10 @@ Params::getKey(const std::string& str) const
 uint32_t
 Params::getKey(const std::string& str)
 {
+    if ( keyMapFrozen ) {
+        auto f = frozenKeyMap.find(str);
+        if ( f != frozenKeyMap.end() ) return f->second;
+    }
     std::lock_guard<SST::Core::ThreadSafe::Spinlock> lock(keyLock);
     std::map<std::string, uint32_t>::iterator i = keyMap.find(str);
     if ( i == keyMap.end() ) {
@@ -236,6 +390,7 @@ Params::getKey(const std::string& str)
         keyMap.insert(std::make_pair(str, id));
         keyMapReverse.push_back(str);
         assert(keyMapReverse.size() == nextKeyID);
+        if ( keyMapFrozen ) lateKeys.fetch_add(1, std::memory_order_release);
         return id;
     }
     return i->second;
@@ -447,5 +602,9 @@ std::vector<std::string> Params::keyMapReverse;
 Core::ThreadSafe::Spinlock Params::keyLock;
 uint32_t Params::nextKeyID;
 bool Params::g_verify_enabled = false;
+std::unordered_map<std::string, uint32_t> Params::frozenKeyMap;
+bool Params::keyMapFrozen = false;
+std::atomic<uint32_t> Params::lateKeys(0);
+std::map<std::string, Params::ParamSet_t> Params::shared_params;
 
 }
@@ -15,12 +15,14 @@
 #include "sst/core/output.h"
 #include "sst/core/from_string.h"
 
+#include <atomic>
 #include <cassert>
 #include <inttypes.h>
 #include <iostream>
 #include <sstream>
 #include <map>
 #include <stack>
+#include <unordered_map>
 #include <stdlib.h>
 #include <utility>
 #include "sst/core/threadsafe.h"
@@ -40,6 +42,14 @@ class ConfigGraph;
  * Stores key-value pairs as std::strings and provides
  * a templated find method for finding values and converting
  * them to arbitrary types (@see find()).
+ *
+ * In addition to its own (local) values, a Params can subscribe to
+ * any number of named shared parameter sets (@see insert_shared(),
+ * addSharedParamSet()).  Lookups search the local values first, then
+ * the shared sets in the order they were subscribed, so local values
+ * act as a per-instance overlay on top of the shared ones.  Shared
+ * sets are stored once per rank and only their names travel with
+ * the Params when it is serialized.
  */
 class Params : public SST::Core::Serialization::serializable {
 private:
@@ -178,8 +188,29 @@ NO_VARIABLE:
     }
 
     typedef std::map<uint32_t, std::string>::const_iterator const_iterator; /*!< Const Iterator type */
+    typedef std::map<uint32_t, std::string> ParamSet_t;
 
     const std::string& getString(const std::string& name, bool& found) const;
+    const std::string* findValue(uint32_t id) const;
+    void getMergedParams(std::map<uint32_t, const std::string*>& merged) const;
+
+    /** Calls func(id, value) for every visible parameter in key id
+     * order.  Only builds the merged view when shared sets are
+     * subscribed. */
+    template <class FUNC>
+    void forEachParam(FUNC func) const {
+        if ( data.size() == 1 ) {
+            for ( const_iterator i = my_data.begin() ; i != my_data.end() ; ++i ) {
+                func(i->first, i->second);
+            }
+            return;
+        }
+        std::map<uint32_t, const std::string*> merged;
+        getMergedParams(merged);
+        for ( auto& i : merged ) {
+            func(i.first, *i.second);
+        }
+    }
 
     void getArrayTokens(const std::string& value, std::vector<std::string>& tokens) const;
 
@@ -484,14 +515,55 @@ public:
 
 
 
-    /** Add a key value pair into the param object.
+    /** Add a key value pair into the param object.  If overwrite is
+     * false, an existing local value is kept.  Values from subscribed
+     * shared sets are not local, so the key is still added and then
+     * overrides the shared value.
      */
     void insert(const std::string& key, const std::string& value, bool overwrite = true);
 
+    /** Add the local values of params that are not already set locally,
+     * and subscribe to the shared sets params is subscribed to. */
     void insert(const Params& params);
 
     std::set<std::string> getKeys() const;
 
+    /**
+     * Add a key value pair to the named shared parameter set.  The
+     * set is created if it does not already exist.  Shared sets may
+     * only be modified while the ConfigGraph is being built.
+     */
+    static void insert_shared(const std::string& set, const key_type& key, const key_type& value, bool overwrite = true);
+
+    /**
+     * Subscribe this Params to the named shared parameter set.
+     * Values in the shared set are visible through find() unless
+     * overridden by a local value or by a set subscribed earlier.
+     */
+    void addSharedParamSet(const std::string& set);
+
+    /** Returns the names of the shared sets this Params subscribes to,
+     * in lookup order. */
+    std::vector<std::string> getSubscribedSharedParamSets() const;
+
+    /** Returns the names of all shared parameter sets */
+    static std::vector<std::string> getSharedParamSetNames();
+
+    /** Returns the contents of the named shared parameter set */
+    static std::map<std::string, std::string> getSharedParamSet(const std::string& set);
+
+    /** Returns the keys set locally on this Params (not through any
+     * shared set) */
+    std::set<std::string> getLocalKeys() const;
+
+    /**
+     * Called once the ConfigGraph is complete (and broadcast) and
+     * before any components are built.  Shared sets become immutable
+     * and key lookups no longer take keyLock for keys known at this
+     * point.
+     */
+    static void freezeSharedData();
+
      /** Returns a new parameter object with parameters that match
      * the specified prefix.
      */
@@ -535,7 +607,10 @@ public:
     ImplementSerializable(SST::Params)
 
 private:
-    std::map<uint32_t, std::string> data;
+    /* Local values; always data[0] */
+    ParamSet_t my_data;
+    /* Lookup order: my_data followed by subscribed shared sets */
+    std::vector<const ParamSet_t*> data;
     std::vector<KeySet_t> allowedKeys;
     bool verify_enabled;
     static bool g_verify_enabled;
@@ -551,7 +626,14 @@ private:
     static SST::Core::ThreadSafe::Spinlock keyLock;
     static uint32_t nextKeyID;
 
+    /* Read-only copy of keyMap taken by freezeSharedData().  Keys
+     * created afterwards only go into keyMap and are counted in
+     * lateKeys, so a miss here is final as long as lateKeys is 0. */
+    static std::unordered_map<std::string, uint32_t> frozenKeyMap;
+    static bool keyMapFrozen;
+    static std::atomic<uint32_t> lateKeys;
 
+    static std::map<std::string, ParamSet_t> shared_params;
 };
 
 #if 0
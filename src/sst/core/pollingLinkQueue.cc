@@ -16,44 +16,71 @@
 
 namespace SST {
 
-    PollingLinkQueue::PollingLinkQueue() : ActivityQueue() {}
+    PollingLinkQueue::PollingLinkQueue() :
+        ActivityQueue(),
+        data(16, nullptr),
+        head(0),
+        count(0)
+    {}
+
     PollingLinkQueue::~PollingLinkQueue() {
     // Need to delete any events left in the queue
-    std::multiset<Activity*,Activity::less_time>::iterator it;
-    for ( it = data.begin(); it != data.end(); ++it ) {
-        delete *it;
+    for ( size_t i = 0; i < count; i++ ) {
+        delete at(i);
     }
-    data.clear();
+    count = 0;
     }
 
     bool PollingLinkQueue::empty()
     {
-    return data.empty();
+    return count == 0;
     }
 
     int PollingLinkQueue::size()
     {
-    return data.size();
+    return count;
     }
 
     void PollingLinkQueue::insert(Activity* activity)
     {
-    data.insert(activity);
+    if ( count == data.size() ) grow();
+
+    // Shift later events up one slot until the new one fits.  Usually
+    // the back is already earlier, so nothing moves.
+    SimTime_t time = activity->getDeliveryTime();
+    size_t pos = count;
+    while ( pos > 0 && at(pos - 1)->getDeliveryTime() > time ) {
+        at(pos) = at(pos - 1);
+        pos--;
+    }
+    at(pos) = activity;
+    count++;
     }
 
     Activity* PollingLinkQueue::pop()
     {
-    if ( data.size() == 0 ) return nullptr;
-    std::multiset<Activity*,Activity::less_time>::iterator it = data.begin();
-    Activity* ret_val = (*it);
-    data.erase(it);
+    if ( count == 0 ) return nullptr;
+    Activity* ret_val = data[head];
+    head = (head + 1) & (data.size() - 1);
+    count--;
     return ret_val;
     }
 
     Activity* PollingLinkQueue::front()
     {
-    if ( data.size() == 0 ) return nullptr;
-    return *data.begin();
+    if ( count == 0 ) return nullptr;
+    return data[head];
+    }
+
+    void PollingLinkQueue::grow()
+    {
+    // Unwrap into a buffer twice the size
+    std::vector<Activity*> bigger(data.size() * 2, nullptr);
+    for ( size_t i = 0; i < count; i++ ) {
+        bigger[i] = at(i);
+    }
+    data.swap(bigger);
+    head = 0;
     }
 
 
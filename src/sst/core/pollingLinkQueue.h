@@ -12,7 +12,7 @@
 #ifndef SST_CORE_POLLINGLINKQUEUE_H
 #define SST_CORE_POLLINGLINKQUEUE_H
 
-#include <set>
+#include <vector>
 
 #include "sst/core/activityQueue.h"
 
@@ -20,6 +20,13 @@ namespace SST {
 
 /**
  * A link queue which is used for polling only.
+ *
+ * Events on a link nearly always arrive in delivery time order, so the
+ * queue is a ring buffer sorted by delivery time: an in-order insert
+ * appends at the back, and an out-of-order insert is moved into place
+ * as in an insertion sort.  Events with the same delivery time stay in
+ * the order they were sent.  front() and pop() are O(1) and there is
+ * no allocation per event.
  */
 class PollingLinkQueue : public ActivityQueue {
 public:
@@ -34,8 +41,13 @@ public:
 
 
 private:
-    std::multiset<Activity*,Activity::less_time> data;
+    // Ring buffer whose size is a power of two
+    std::vector<Activity*> data;
+    size_t head;
+    size_t count;
 
+    inline Activity*& at(size_t i) { return data[(head + i) & (data.size() - 1)]; }
+    void grow();
 };
 
 } //namespace SST
@@ -13,12 +13,38 @@
 #define SST_CORE_CORE_PROFILE_H
 
 #include <chrono>
+#include <cstdint>
 #include "sst/core/warnmacros.h"
 
+#if defined(__x86_64__) || defined(__i386__)
+#include <x86intrin.h>
+#endif
+
 namespace SST {
 namespace Core {
 namespace Profile {
 
+/**
+ * Cheap, monotonically increasing timestamp used by the runtime
+ * profiler (see runtimeProfile.h).  Uses the time stamp counter where
+ * there is one; the tick rate is calibrated against steady_clock by
+ * the caller, so the unit is only meaningful as a difference.
+ * Unlike now(), this is always available.
+ */
+inline uint64_t getTicks()
+{
+#if defined(__x86_64__) || defined(__i386__)
+    return __rdtsc();
+#elif defined(__aarch64__)
+    uint64_t val;
+    asm volatile("mrs %0, cntvct_el0" : "=r"(val));
+    return val;
+#else
+    return std::chrono::duration_cast<std::chrono::nanoseconds>(
+        std::chrono::steady_clock::now().time_since_epoch()).count();
+#endif
+}
+
 
 
 #ifdef __SST_ENABLE_PROFILE__
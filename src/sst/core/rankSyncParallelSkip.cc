@@ -70,10 +70,10 @@ RankSyncParallelSkip::~RankSyncParallelSkip()
     }
     comm_recv_map.clear();
 
-    for (link_map_t::iterator i = link_map.begin() ; i != link_map.end() ; ++i) {
-        delete i->second;
+    for ( auto& peer : cut_links ) {
+        for ( Link* link : peer.second ) delete link;
     }
-    link_map.clear();
+    cut_links.clear();
 
     delete[] recv_count;
     delete[] link_send_queue;
@@ -82,7 +82,7 @@ RankSyncParallelSkip::~RankSyncParallelSkip()
         Output::getDefaultObject().verbose(CALL_INFO, 1, 0, "RankSyncParallelSkip mpiWait: %lg sec  deserializeWait:  %lg sec\n", mpiWaitTime, deserializeTime);
 }
 
-ActivityQueue* RankSyncParallelSkip::registerLink(const RankInfo& to_rank, const RankInfo& from_rank, LinkId_t link_id, Link* link)
+ActivityQueue* RankSyncParallelSkip::registerLink(const RankInfo& to_rank, const RankInfo& from_rank, LinkId_t UNUSED(link_id), Link* link)
 {
     // For sends, we track the remote rank and thread ID
     SyncQueue* queue;
@@ -107,7 +107,7 @@ ActivityQueue* RankSyncParallelSkip::registerLink(const RankInfo& to_rank, const
         comm_recv_map[remote_rank_local_thread].local_size = 4096;
     }
 
-    link_map[link_id] = link;
+    comm_recv_map[remote_rank_local_thread].links = addCutLink(to_rank.rank, link);
 #ifdef __SST_DEBUG_EVENT_TRACKING__
     link->setSendingComponentInfo("SYNC", "SYNC", "");
 #endif
@@ -116,8 +116,8 @@ ActivityQueue* RankSyncParallelSkip::registerLink(const RankInfo& to_rank, const
 
 void
 RankSyncParallelSkip::finalizeLinkConfigurations() {
-    for (link_map_t::iterator i = link_map.begin() ; i != link_map.end() ; ++i) {
-        finalizeConfiguration(i->second);
+    for ( auto& peer : cut_links ) {
+        for ( Link* link : peer.second ) finalizeConfiguration(link);
     }
 
     // Set the size of the BoundedQueue that is the work queue for
@@ -129,8 +129,8 @@ RankSyncParallelSkip::finalizeLinkConfigurations() {
 
 void
 RankSyncParallelSkip::prepareForComplete() {
-    for (link_map_t::iterator i = link_map.begin() ; i != link_map.end() ; ++i) {
-        prepareForCompleteInt(i->second);
+    for ( auto& peer : cut_links ) {
+        for ( Link* link : peer.second ) prepareForCompleteInt(link);
     }
 }
 
@@ -195,15 +195,16 @@ RankSyncParallelSkip::exchange_slave(int thread)
             // comm_recv_pair* recv = link_send_queue[thread].remove();
             my_recv_count--;
 
+            const cut_link_vec_t& links = *recv->links;
             for ( size_t i = 0; i < recv->activity_vec.size(); i++ ) {
                 Event* ev = static_cast<Event*>(recv->activity_vec[i]);
-                link_map_t::iterator link = link_map.find(ev->getLinkId());
-                if (link == link_map.end()) {
+                Link* link = findCutLink(links, ev->getLinkId());
+                if ( link == nullptr ) {
                     Simulation::getSimulationOutput().fatal(CALL_INFO,1,"Link not found in map!\n");
                 } else {
                     // Need to figure out what the "delay" is for this event.
                     SimTime_t delay = ev->getDeliveryTime() - current_cycle;
-                    link->second->send(delay,ev);
+                    link->send(delay,ev);
                 }
             }
             recv->activity_vec.clear();
@@ -339,8 +340,7 @@ RankSyncParallelSkip::exchange_master(int UNUSED(thread))
     // Need to get the local minimum, then do a global minimum
     // SimTime_t input = Simulation::getSimulation()->getNextActivityTime();
     SimTime_t input = Simulation::getLocalMinimumNextActivityTime();
-    SimTime_t min_time;
-    MPI_Allreduce( &input, &min_time, 1, MPI_UINT64_T, MPI_MIN, MPI_COMM_WORLD );
+    SimTime_t min_time = reduceNextActivityTime(input);
 
     myNextSyncTime = min_time + max_period->getFactor();
 
@@ -418,20 +418,18 @@ RankSyncParallelSkip::exchangeLinkUntimedData(int UNUSED_WO_MPI(thread), std::at
             buffer = i->second.rbuf;
         }
 
-        SST::Core::Serialization::serializer ser;
-        ser.start_unpacking(&buffer[sizeof(SyncQueue::Header)],size-sizeof(SyncQueue::Header));
-
         std::vector<Activity*> activities;
-        ser & activities;
+        SyncQueue::unpackActivities(&buffer[sizeof(SyncQueue::Header)],size-sizeof(SyncQueue::Header),activities);
 
+        const cut_link_vec_t& links = *i->second.links;
         for ( unsigned int j = 0; j < activities.size(); j++ ) {
 
             Event* ev = static_cast<Event*>(activities[j]);
-            link_map_t::iterator link = link_map.find(ev->getLinkId());
-            if (link == link_map.end()) {
+            Link* link = findCutLink(links, ev->getLinkId());
+            if ( link == nullptr ) {
                 Simulation::getSimulationOutput().fatal(CALL_INFO,1,"Link not found in map!\n");
             } else {
-                sendUntimedData_sync(link->second,ev);
+                sendUntimedData_sync(link,ev);
             }
         }
     }
@@ -461,10 +459,7 @@ RankSyncParallelSkip::deserializeMessage(comm_recv_pair* msg)
 
     auto deserialStart = SST::Core::Profile::now();
 
-    SST::Core::Serialization::serializer ser;
-
-    ser.start_unpacking(&buffer[sizeof(SyncQueue::Header)],size-sizeof(SyncQueue::Header));
-    ser & msg->activity_vec;
+    SyncQueue::unpackActivities(&buffer[sizeof(SyncQueue::Header)],size-sizeof(SyncQueue::Header),msg->activity_vec);
 
     deserializeTime += SST::Core::Profile::getElapsed(deserialStart);
 }
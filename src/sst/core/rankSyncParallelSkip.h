@@ -73,6 +73,7 @@ private:
         std::vector<Activity*> activity_vec;
         uint32_t local_size;
         bool recv_done;
+        cut_link_vec_t* links; // links to the remote rank
 #ifdef SST_CONFIG_HAVE_MPI
         MPI_Request req;
 #endif
@@ -80,12 +81,10 @@ private:
 
     typedef std::map<RankInfo, comm_send_pair > comm_send_map_t;
     typedef std::map<RankInfo, comm_recv_pair > comm_recv_map_t;
-    typedef std::map<LinkId_t, Link*> link_map_t;
 
     // TimeConverter* period;
     comm_send_map_t comm_send_map;
     comm_recv_map_t comm_recv_map;
-    link_map_t link_map;
 
     double mpiWaitTime;
     double deserializeTime;
@@ -0,0 +1,331 @@
+// Copyright 2009-2020 NTESS. Under the terms
+// of Contract DE-NA0003525 with NTESS, the U.S.
+// Government retains certain rights in this software.
+//
+// Copyright (c) 2009-2020, NTESS
+// All rights reserved.
+//
+// This file is part of the SST software package. For license
+// information, see the LICENSE file in the top level directory of the
+// distribution.
+
+#include "sst_config.h"
+#include "sst/core/rankSyncSegmentedSkip.h"
+
+#include "sst/core/serialization/serializer.h"
+
+#include "sst/core/event.h"
+#include "sst/core/link.h"
+#include "sst/core/simulation.h"
+#include "sst/core/syncQueue.h"
+#include "sst/core/timeConverter.h"
+#include "sst/core/profile.h"
+
+#include <cstring>
+
+#ifdef SST_CONFIG_HAVE_MPI
+#define UNUSED_WO_MPI(x) x
+#else
+#define UNUSED_WO_MPI(x) UNUSED(x)
+#endif
+
+
+namespace SST {
+
+// Static Data Members
+SimTime_t RankSyncSegmentedSkip::myNextSyncTime = 0;
+Core::ThreadSafe::Barrier RankSyncSegmentedSkip::serializeDoneBarrier;
+Core::ThreadSafe::Barrier RankSyncSegmentedSkip::recvDoneBarrier;
+Core::ThreadSafe::Barrier RankSyncSegmentedSkip::deliverDoneBarrier;
+
+
+RankSyncSegmentedSkip::RankSyncSegmentedSkip(RankInfo num_ranks, TimeConverter* UNUSED(minPartTC)) :
+    NewRankSync(),
+    num_threads(num_ranks.thread),
+    mpiWaitTime(0.0),
+    deserializeTime(0.0)
+{
+    serializeDoneBarrier.resize(num_ranks.thread);
+    recvDoneBarrier.resize(num_ranks.thread);
+    deliverDoneBarrier.resize(num_ranks.thread);
+    max_period = Simulation::getSimulation()->getMinPartTC();
+    myNextSyncTime = max_period->getFactor();
+}
+
+RankSyncSegmentedSkip::~RankSyncSegmentedSkip()
+{
+    for ( auto i = comm_map.begin() ; i != comm_map.end() ; ++i ) {
+        for ( auto q : i->second.squeue ) delete q;
+        delete[] i->second.rbuf;
+    }
+    comm_map.clear();
+
+    for ( auto& peer : cut_links ) {
+        for ( Link* link : peer.second ) delete link;
+    }
+    cut_links.clear();
+
+    if ( mpiWaitTime > 0.0 || deserializeTime > 0.0 )
+        Output::getDefaultObject().verbose(CALL_INFO, 1, 0, "RankSyncSegmentedSkip mpiWait: %lg sec  deserializeWait:  %lg sec\n", mpiWaitTime, deserializeTime);
+}
+
+ActivityQueue* RankSyncSegmentedSkip::registerLink(const RankInfo& to_rank, const RankInfo& UNUSED(from_rank), LinkId_t UNUSED(link_id), Link* link)
+{
+    comm_pair& comm = comm_map[to_rank.rank];
+    if ( comm.squeue.empty() ) {
+        comm.remote_rank = to_rank.rank;
+        comm.squeue.resize(num_threads, nullptr);
+        comm.segment.resize(num_threads, nullptr);
+        comm.segment_size.resize(num_threads, 0);
+        comm.remote_size = 4096;
+        comm.rbuf = new char[4096];
+        comm.local_size = 4096;
+    }
+
+    SyncQueue*& queue = comm.squeue[to_rank.thread];
+    if ( nullptr == queue ) {
+        queue = new SyncQueue();
+        send_segments.push_back(std::make_pair(&comm, to_rank.thread));
+    }
+
+    comm.links = addCutLink(to_rank.rank, link);
+#ifdef __SST_DEBUG_EVENT_TRACKING__
+    link->setSendingComponentInfo("SYNC", "SYNC", "");
+#endif
+    return queue;
+}
+
+void
+RankSyncSegmentedSkip::finalizeLinkConfigurations() {
+    for ( auto& peer : cut_links ) {
+        for ( Link* link : peer.second ) finalizeConfiguration(link);
+    }
+}
+
+void
+RankSyncSegmentedSkip::prepareForComplete() {
+    for ( auto& peer : cut_links ) {
+        for ( Link* link : peer.second ) prepareForCompleteInt(link);
+    }
+}
+
+uint64_t
+RankSyncSegmentedSkip::getDataSize() const {
+    size_t count = 0;
+    for ( auto it = comm_map.begin(); it != comm_map.end(); ++it ) {
+        for ( auto q : it->second.squeue ) {
+            if ( q ) count += q->getDataSize();
+        }
+        count += it->second.sbuf.capacity() + it->second.local_size;
+    }
+    return count;
+}
+
+void
+RankSyncSegmentedSkip::serializeSegments(int thread, int stride)
+{
+    for ( size_t i = thread; i < send_segments.size(); i += stride ) {
+        comm_pair* comm = send_segments[i].first;
+        uint32_t remote_thread = send_segments[i].second;
+        char* buffer = comm->squeue[remote_thread]->getData();
+        SyncQueue::Header* hdr = reinterpret_cast<SyncQueue::Header*>(buffer);
+        comm->segment[remote_thread] = buffer + sizeof(SyncQueue::Header);
+        comm->segment_size[remote_thread] = hdr->buffer_size - sizeof(SyncQueue::Header);
+    }
+}
+
+void
+RankSyncSegmentedSkip::sendAndReceive()
+{
+#ifdef SST_CONFIG_HAVE_MPI
+    // One receive per peer, and up to two sends (header only, then the
+    // full message) when the peer's buffer has to grow
+    sreqs.resize(2 * comm_map.size());
+    MPI_Request rreqs[comm_map.size()];
+    int sreq_count = 0;
+    int rreq_count = 0;
+
+    const size_t table_size = num_threads * sizeof(uint32_t);
+
+    for ( auto i = comm_map.begin() ; i != comm_map.end() ; ++i ) {
+        comm_pair& comm = i->second;
+
+        // Pack the segments behind the header and size table
+        size_t total = sizeof(SyncQueue::Header) + table_size;
+        for ( uint32_t t = 0; t < num_threads; t++ ) total += comm.segment_size[t];
+        if ( comm.sbuf.size() < total ) comm.sbuf.resize(total);
+
+        char* send_buffer = comm.sbuf.data();
+        memcpy(send_buffer + sizeof(SyncQueue::Header), comm.segment_size.data(), table_size);
+        size_t offset = sizeof(SyncQueue::Header) + table_size;
+        for ( uint32_t t = 0; t < num_threads; t++ ) {
+            if ( comm.segment_size[t] ) memcpy(send_buffer + offset, comm.segment[t], comm.segment_size[t]);
+            offset += comm.segment_size[t];
+        }
+
+        SyncQueue::Header* hdr = reinterpret_cast<SyncQueue::Header*>(send_buffer);
+        hdr->count = num_threads;
+        hdr->buffer_size = total;
+        int tag = 1;
+        // Check to see if remote queue is big enough for data
+        if ( comm.remote_size < hdr->buffer_size ) {
+            // not big enough, send message that will tell remote side to get larger buffer
+            hdr->mode = 1;
+            MPI_Isend(send_buffer, sizeof(SyncQueue::Header), MPI_BYTE,
+                      comm.remote_rank, tag, MPI_COMM_WORLD, &sreqs[sreq_count++]);
+            comm.remote_size = hdr->buffer_size;
+            tag = 2;
+        }
+        else {
+            hdr->mode = 0;
+        }
+        MPI_Isend(send_buffer, hdr->buffer_size, MPI_BYTE,
+                  comm.remote_rank, tag, MPI_COMM_WORLD, &sreqs[sreq_count++]);
+
+        // Post all the receives
+        MPI_Irecv(comm.rbuf, comm.local_size, MPI_BYTE,
+                  comm.remote_rank, 1, MPI_COMM_WORLD, &rreqs[rreq_count++]);
+
+        // The segments are no longer needed once packed
+        for ( uint32_t t = 0; t < num_threads; t++ ) comm.segment_size[t] = 0;
+    }
+    sreqs.resize(sreq_count);
+
+    auto waitStart = SST::Core::Profile::now();
+    MPI_Waitall(rreq_count, rreqs, MPI_STATUSES_IGNORE);
+    mpiWaitTime += SST::Core::Profile::getElapsed(waitStart);
+
+    for ( auto i = comm_map.begin() ; i != comm_map.end() ; ++i ) {
+        comm_pair& comm = i->second;
+        SyncQueue::Header* hdr = reinterpret_cast<SyncQueue::Header*>(comm.rbuf);
+        if ( hdr->mode == 1 ) {
+            // May need to resize the buffer
+            unsigned int size = hdr->buffer_size;
+            if ( size > comm.local_size ) {
+                delete[] comm.rbuf;
+                comm.rbuf = new char[size];
+                comm.local_size = size;
+            }
+            MPI_Recv(comm.rbuf, comm.local_size, MPI_BYTE,
+                     comm.remote_rank, 2, MPI_COMM_WORLD, MPI_STATUS_IGNORE);
+        }
+    }
+#endif
+}
+
+void
+RankSyncSegmentedSkip::finishSends()
+{
+#ifdef SST_CONFIG_HAVE_MPI
+    // Clear the SyncQueues used to send the data after all the sends have completed
+    auto waitStart = SST::Core::Profile::now();
+    MPI_Waitall(sreqs.size(), sreqs.data(), MPI_STATUSES_IGNORE);
+    mpiWaitTime += SST::Core::Profile::getElapsed(waitStart);
+    sreqs.clear();
+
+    for ( auto& seg : send_segments ) {
+        seg.first->squeue[seg.second]->clear();
+    }
+#endif
+}
+
+void
+RankSyncSegmentedSkip::deliverSegment(comm_pair& comm, uint32_t thread, bool untimed)
+{
+    SyncQueue::Header* hdr = reinterpret_cast<SyncQueue::Header*>(comm.rbuf);
+    const uint32_t* sizes = reinterpret_cast<const uint32_t*>(comm.rbuf + sizeof(SyncQueue::Header));
+    if ( hdr->count != num_threads ) {
+        Simulation::getSimulationOutput().fatal(CALL_INFO, 1, "Rank %" PRIu32 " sent %" PRIu32
+                                                " segments, expected %" PRIu32 "\n",
+                                                comm.remote_rank, hdr->count, num_threads);
+    }
+    if ( 0 == sizes[thread] ) return;
+
+    size_t offset = sizeof(SyncQueue::Header) + num_threads * sizeof(uint32_t);
+    for ( uint32_t t = 0; t < thread; t++ ) offset += sizes[t];
+
+    auto deserialStart = SST::Core::Profile::now();
+
+    std::vector<Activity*> activities;
+    SyncQueue::unpackActivities(comm.rbuf + offset, sizes[thread], activities);
+
+    if ( thread == 0 || untimed ) deserializeTime += SST::Core::Profile::getElapsed(deserialStart);
+
+    const cut_link_vec_t& links = *comm.links;
+    SimTime_t current_cycle = Simulation::getSimulation()->getCurrentSimCycle();
+    for ( size_t j = 0; j < activities.size(); j++ ) {
+        Event* ev = static_cast<Event*>(activities[j]);
+        Link* link = findCutLink(links, ev->getLinkId());
+        if ( link == nullptr ) {
+            Simulation::getSimulationOutput().fatal(CALL_INFO,1,"Link not found in map!\n");
+        }
+        else if ( untimed ) {
+            sendUntimedData_sync(link, ev);
+        }
+        else {
+            // Need to figure out what the "delay" is for this event.
+            SimTime_t delay = ev->getDeliveryTime() - current_cycle;
+            link->send(delay, ev);
+        }
+    }
+}
+
+void
+RankSyncSegmentedSkip::execute(int UNUSED_WO_MPI(thread))
+{
+#ifdef SST_CONFIG_HAVE_MPI
+    serializeSegments(thread, num_threads);
+    serializeDoneBarrier.wait();
+
+    if ( thread == 0 ) sendAndReceive();
+    recvDoneBarrier.wait();
+
+    // Each thread only touches its own segment and its own TimeVortex
+    for ( auto i = comm_map.begin() ; i != comm_map.end() ; ++i ) {
+        deliverSegment(i->second, thread, false);
+    }
+    deliverDoneBarrier.wait();
+
+    if ( thread != 0 ) return;
+
+    finishSends();
+
+    // Check to see when the next event is scheduled, then do an
+    // all_reduce with min operator and set next sync time to be
+    // min + max_period.
+    SimTime_t input = Simulation::getLocalMinimumNextActivityTime();
+    SimTime_t min_time = reduceNextActivityTime(input);
+
+    myNextSyncTime = min_time + max_period->getFactor();
+#endif
+}
+
+void
+RankSyncSegmentedSkip::exchangeLinkUntimedData(int UNUSED_WO_MPI(thread), std::atomic<int>& UNUSED_WO_MPI(msg_count))
+{
+#ifdef SST_CONFIG_HAVE_MPI
+    // Untimed data is rare, so thread 0 does it all, as the other rank
+    // syncs do
+    if ( thread != 0 ) {
+        return;
+    }
+
+    serializeSegments(0, 1);
+    sendAndReceive();
+    for ( auto i = comm_map.begin() ; i != comm_map.end() ; ++i ) {
+        for ( uint32_t t = 0; t < num_threads; t++ ) {
+            deliverSegment(i->second, t, true);
+        }
+    }
+    finishSends();
+
+    // Do an allreduce to see if there were any messages sent
+    int input = msg_count;
+
+    int count;
+    MPI_Allreduce( &input, &count, 1, MPI_INT, MPI_SUM, MPI_COMM_WORLD );
+    msg_count = count;
+#endif
+}
+
+} // namespace SST
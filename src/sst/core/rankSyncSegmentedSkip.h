@@ -0,0 +1,113 @@
+// Copyright 2009-2020 NTESS. Under the terms
+// of Contract DE-NA0003525 with NTESS, the U.S.
+// Government retains certain rights in this software.
+//
+// Copyright (c) 2009-2020, NTESS
+// All rights reserved.
+//
+// This file is part of the SST software package. For license
+// information, see the LICENSE file in the top level directory of the
+// distribution.
+
+#ifndef SST_CORE_RANKSYNCSEGMENTEDSKIP_H
+#define SST_CORE_RANKSYNCSEGMENTEDSKIP_H
+
+#include "sst/core/sst_types.h"
+#include "sst/core/syncManager.h"
+#include "sst/core/threadsafe.h"
+#include "sst/core/warnmacros.h"
+
+#include <map>
+#include <vector>
+
+#ifdef SST_CONFIG_HAVE_MPI
+DISABLE_WARN_MISSING_OVERRIDE
+#include <mpi.h>
+REENABLE_WARNING
+#endif
+
+namespace SST {
+
+class SyncQueue;
+class TimeConverter;
+
+/**
+ * Rank sync for ranks running several threads.
+ *
+ * Events are queued per destination rank and thread.  At each sync the
+ * threads serialize the queues between them, and thread 0 packs the
+ * segments for each rank into a single message:
+ *
+ *   SyncQueue::Header | uint32_t size[threads] | segment 0 | segment 1 | ...
+ *
+ * Once the messages have arrived, every thread deserializes only its own
+ * segment of each message and delivers the events straight into its own
+ * TimeVortex, so there are no hand-off queues between threads.
+ */
+class RankSyncSegmentedSkip : public NewRankSync {
+public:
+    /** Create a new Sync object which fires with a specified period */
+    RankSyncSegmentedSkip(RankInfo num_ranks, TimeConverter* minPartTC);
+    virtual ~RankSyncSegmentedSkip();
+
+    /** Register a Link which this Sync Object is responsible for */
+    ActivityQueue* registerLink(const RankInfo& to_rank, const RankInfo& from_rank, LinkId_t link_id, Link* link) override;
+    void execute(int thread) override;
+
+    /** Cause an exchange of Untimed Data to occur */
+    void exchangeLinkUntimedData(int thread, std::atomic<int>& msg_count) override;
+    /** Finish link configuration */
+    void finalizeLinkConfigurations() override;
+    /** Prepare for complete() stage */
+    void prepareForComplete() override;
+
+    SimTime_t getNextSyncTime() override { return myNextSyncTime; }
+
+    uint64_t getDataSize() const override;
+
+private:
+
+    static SimTime_t myNextSyncTime;
+
+    struct comm_pair {
+        uint32_t remote_rank;
+        std::vector<SyncQueue*> squeue;     // one per remote thread, nullptr if no links
+        std::vector<char*> segment;         // serialized data for each remote thread
+        std::vector<uint32_t> segment_size;
+        std::vector<char> sbuf;             // packed send message
+        uint32_t remote_size;
+        char* rbuf;                         // receive buffer
+        uint32_t local_size;
+        cut_link_vec_t* links;              // links to the remote rank
+    };
+
+    typedef std::map<uint32_t, comm_pair> comm_map_t;
+
+    uint32_t num_threads;
+    comm_map_t comm_map;
+    // (peer, remote thread) of every send queue, shared out among the
+    // threads for serialization
+    std::vector<std::pair<comm_pair*, uint32_t>> send_segments;
+
+#ifdef SST_CONFIG_HAVE_MPI
+    std::vector<MPI_Request> sreqs;
+#endif
+
+    double mpiWaitTime;
+    double deserializeTime;
+
+    // Static, like Simulation's barriers, so the object itself isn't
+    // over-aligned.  There is only one rank sync per rank.
+    static Core::ThreadSafe::Barrier serializeDoneBarrier;
+    static Core::ThreadSafe::Barrier recvDoneBarrier;
+    static Core::ThreadSafe::Barrier deliverDoneBarrier;
+
+    void serializeSegments(int thread, int stride);
+    void sendAndReceive();
+    void finishSends();
+    void deliverSegment(comm_pair& comm, uint32_t thread, bool untimed);
+};
+
+} // namespace SST
+
+#endif // SST_CORE_RANKSYNCSEGMENTEDSKIP_H
@@ -55,16 +55,16 @@ RankSyncSerialSkip::~RankSyncSerialSkip()
     }
     comm_map.clear();
 
-    for (link_map_t::iterator i = link_map.begin() ; i != link_map.end() ; ++i) {
-        delete i->second;
+    for ( auto& peer : cut_links ) {
+        for ( Link* link : peer.second ) delete link;
     }
-    link_map.clear();
+    cut_links.clear();
 
     if ( mpiWaitTime > 0.0 || deserializeTime > 0.0 )
         Output::getDefaultObject().verbose(CALL_INFO, 1, 0, "RankSyncSerialSkip mpiWait: %lg sec  deserializeWait:  %lg sec\n", mpiWaitTime, deserializeTime);
 }
 
-ActivityQueue* RankSyncSerialSkip::registerLink(const RankInfo& to_rank, const RankInfo& UNUSED(from_rank), LinkId_t link_id, Link* link)
+ActivityQueue* RankSyncSerialSkip::registerLink(const RankInfo& to_rank, const RankInfo& UNUSED(from_rank), LinkId_t UNUSED(link_id), Link* link)
 {
     SyncQueue* queue;
     if ( comm_map.count(to_rank.rank) == 0 ) {
@@ -76,7 +76,7 @@ ActivityQueue* RankSyncSerialSkip::registerLink(const RankInfo& to_rank, const R
         queue = comm_map[to_rank.rank].squeue;
     }
 
-    link_map[link_id] = link;
+    comm_map[to_rank.rank].links = addCutLink(to_rank.rank, link);
 #ifdef __SST_DEBUG_EVENT_TRACKING__
     link->setSendingComponentInfo("SYNC", "SYNC", "");
 #endif
@@ -85,15 +85,15 @@ ActivityQueue* RankSyncSerialSkip::registerLink(const RankInfo& to_rank, const R
 
 void
 RankSyncSerialSkip::finalizeLinkConfigurations() {
-    for (link_map_t::iterator i = link_map.begin() ; i != link_map.end() ; ++i) {
-        finalizeConfiguration(i->second);
+    for ( auto& peer : cut_links ) {
+        for ( Link* link : peer.second ) finalizeConfiguration(link);
     }
 }
 
 void
 RankSyncSerialSkip::prepareForComplete() {
-    for (link_map_t::iterator i = link_map.begin() ; i != link_map.end() ; ++i) {
-        prepareForCompleteInt(i->second);
+    for ( auto& peer : cut_links ) {
+        for ( Link* link : peer.second ) prepareForCompleteInt(link);
     }
 }
 
@@ -186,25 +186,22 @@ RankSyncSerialSkip::exchange(void)
 
         auto deserialStart = SST::Core::Profile::now();
 
-        SST::Core::Serialization::serializer ser;
-        ser.start_unpacking(&buffer[sizeof(SyncQueue::Header)],size-sizeof(SyncQueue::Header));
-
         std::vector<Activity*> activities;
-        activities.clear();
-        ser & activities;
+        SyncQueue::unpackActivities(&buffer[sizeof(SyncQueue::Header)],size-sizeof(SyncQueue::Header),activities);
 
         deserializeTime += SST::Core::Profile::getElapsed(deserialStart);
 
+        const cut_link_vec_t& links = *i->second.links;
         for ( unsigned int j = 0; j < activities.size(); j++ ) {
 
             Event* ev = static_cast<Event*>(activities[j]);
-            link_map_t::iterator link = link_map.find(ev->getLinkId());
-            if (link == link_map.end()) {
+            Link* link = findCutLink(links, ev->getLinkId());
+            if ( link == nullptr ) {
                 Simulation::getSimulationOutput().fatal(CALL_INFO,1,"Link not found in map!\n");
             } else {
                 // Need to figure out what the "delay" is for this event.
                 SimTime_t delay = ev->getDeliveryTime() - current_cycle;
-                link->second->send(delay,ev);
+                link->send(delay,ev);
             }
         }
 
@@ -221,9 +218,6 @@ RankSyncSerialSkip::exchange(void)
         i->second.squeue->clear();
     }
 
-    // If we have an Exit object, fire it to see if we need end simulation
-    // if ( exit != nullptr ) exit->check();
-
     // Check to see when the next event is scheduled, then do an
     // all_reduce with min operator and set next sync time to be
     // min + max_period.
@@ -231,8 +225,7 @@ RankSyncSerialSkip::exchange(void)
     // Need to get the local minimum, then do a global minimum
     // SimTime_t input = Simulation::getSimulation()->getNextActivityTime();
     SimTime_t input = Simulation::getLocalMinimumNextActivityTime();
-    SimTime_t min_time;
-    MPI_Allreduce( &input, &min_time, 1, MPI_UINT64_T, MPI_MIN, MPI_COMM_WORLD );
+    SimTime_t min_time = reduceNextActivityTime(input);
 
     myNextSyncTime = min_time + max_period->getFactor();
 #endif
@@ -302,19 +295,17 @@ RankSyncSerialSkip::exchangeLinkUntimedData(int UNUSED_WO_MPI(thread), std::atom
             buffer = i->second.rbuf;
         }
 
-        SST::Core::Serialization::serializer ser;
-        ser.start_unpacking(&buffer[sizeof(SyncQueue::Header)],size-sizeof(SyncQueue::Header));
-
         std::vector<Activity*> activities;
-        ser & activities;
+        SyncQueue::unpackActivities(&buffer[sizeof(SyncQueue::Header)],size-sizeof(SyncQueue::Header),activities);
+        const cut_link_vec_t& links = *i->second.links;
         for ( unsigned int j = 0; j < activities.size(); j++ ) {
 
             Event* ev = static_cast<Event*>(activities[j]);
-            link_map_t::iterator link = link_map.find(ev->getLinkId());
-            if (link == link_map.end()) {
+            Link* link = findCutLink(links, ev->getLinkId());
+            if ( link == nullptr ) {
                 Simulation::getSimulationOutput().fatal(CALL_INFO,1,"Link not found in map!\n");
             } else {
-                sendUntimedData_sync(link->second,ev);
+                sendUntimedData_sync(link,ev);
             }
         }
 
@@ -56,14 +56,13 @@ private:
         char* rbuf; // receive buffer
         uint32_t local_size;
         uint32_t remote_size;
+        cut_link_vec_t* links; // links to the remote rank
     };
 
     typedef std::map<int, comm_pair > comm_map_t;
-    typedef std::map<LinkId_t, Link*> link_map_t;
 
     // TimeConverter* period;
     comm_map_t comm_map;
-    link_map_t link_map;
 
     double mpiWaitTime;
     double deserializeTime;
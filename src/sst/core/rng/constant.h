@@ -55,6 +55,15 @@ class SSTConstantDistribution : public SSTRandomDistribution {
         return mean;
     }
 
+        /**
+            Fills values with the constant value specified by the user
+        */
+    void getNextDoubles(double* values, size_t count) {
+        for(size_t i = 0; i < count; i++) {
+            values[i] = mean;
+        }
+    }
+
         /**
             Gets the constant value for the distribution
             \return Constant value specified by the user when creating the class
@@ -102,6 +102,27 @@ class SSTDiscreteDistribution : public SSTRandomDistribution {
         return (double) index;
     }
 
+        /**
+            Gets the next count values in the distribution, the same values
+            count calls to getNextDouble() would return
+        */
+    void getNextDoubles(double* values, size_t count) {
+        baseDistrib->fillUniform(values, count);
+
+        for(size_t i = 0; i < count; i++) {
+            const double nextD = values[i];
+            uint32_t index = 0;
+
+            for(; index < probCount; index++) {
+                if(probabilities[index] >= nextD) {
+                    break;
+                }
+            }
+
+            values[i] = (double) index;
+        }
+    }
+
     protected:
         /**
             Sets the base random number generator for the distribution.
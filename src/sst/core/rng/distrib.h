@@ -13,6 +13,9 @@
 #ifndef _H_SST_CORE_RNG_DISTRIB
 #define _H_SST_CORE_RNG_DISTRIB
 
+#include <cstddef>
+
+#include "sstrng.h"
 
 namespace SST {
 namespace RNG {
@@ -30,6 +33,20 @@ class SSTRandomDistribution {
         */
         virtual double getNextDouble() = 0;
 
+        /**
+            Obtains the next count doubles from the distribution, the same
+            values and generator state as count calls to getNextDouble().
+            The exponential, Gaussian and Poisson distributions override it
+            to draw their uniforms in bulk.
+            \param values Array of at least count doubles to fill
+            \param count Number of samples to draw
+        */
+        virtual void getNextDoubles(double* values, size_t count) {
+            for(size_t i = 0; i < count; i++) {
+                values[i] = getNextDouble();
+            }
+        }
+
         /**
             Destroys the distribution
         */
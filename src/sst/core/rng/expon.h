@@ -74,6 +74,17 @@ class SSTExponentialDistribution : public SSTRandomDistribution {
         return log(1 - next) / ( -1 * lambda );
     }
 
+        /**
+            Gets the next count values in the distribution, the same values
+            count calls to getNextDouble() would return
+        */
+    void getNextDoubles(double* values, size_t count) {
+        baseDistrib->fillUniform(values, count);
+        for(size_t i = 0; i < count; i++) {
+            values[i] = log(1 - values[i]) / ( -1 * lambda );
+        }
+    }
+
         /**
             Gets the lambda with which the distribution was created
             \return The lambda which the user created the distribution with
@@ -107,6 +107,71 @@ class SSTGaussianDistribution : public SSTRandomDistribution {
         }
     }
 
+        /**
+            Gets the next count values in the distribution, the same values
+            count calls to getNextDouble() would return.  Every pair takes
+            at least four uniforms (u, v and the two signs), so four are
+            drawn in bulk for each pair still to make; a rejected (u, v)
+            leaves the draw short and the rest is drawn in the next round.
+            This never takes more uniforms from the base generator than the
+            single calls would.
+        */
+    void getNextDoubles(double* values, size_t count) {
+        double uniforms[256];
+        double gauss_u = 0, gauss_v = 0, sq_sum = 0;
+        size_t stage = 0;  // uniforms used so far for the current pair
+        size_t i = 0;
+
+        if(usePair && count > 0) {
+            usePair = false;
+            values[i++] = unusedPair;
+        }
+
+        while(i < count) {
+            size_t n = ((count - i + 1) / 2) * 4 - stage;
+            if(n > 256) {
+                n = 256;
+            }
+            baseDistrib->fillUniform(uniforms, n);
+
+            for(size_t j = 0; j < n; j++) {
+                const double x = uniforms[j];
+                switch(stage) {
+                case 0:
+                    gauss_u = x;
+                    stage = 1;
+                    break;
+                case 1:
+                    gauss_v = x;
+                    sq_sum = (gauss_u * gauss_u) + (gauss_v * gauss_v);
+                    stage = (sq_sum >= 1 || sq_sum == 0) ? 0 : 2;
+                    break;
+                case 2:
+                    if(x < 0.5) {
+                        gauss_u *= -1.0;
+                    }
+                    stage = 3;
+                    break;
+                default:
+                    if(x < 0.5) {
+                        gauss_v *= -1.0;
+                    }
+                    stage = 0;
+
+                    double multiplier = sqrt(-2.0 * log(sq_sum) / sq_sum);
+                    values[i++] = mean + stddev * gauss_u * multiplier;
+                    if(i < count) {
+                        values[i++] = mean + stddev * gauss_v * multiplier;
+                    } else {
+                        unusedPair = mean + stddev * gauss_v * multiplier;
+                        usePair = true;
+                    }
+                    break;
+                }
+            }
+        }
+    }
+
         /**
             Gets the mean of the distribution
             \return The mean of the Guassian distribution
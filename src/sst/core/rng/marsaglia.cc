@@ -115,6 +115,56 @@ int32_t  MarsagliaRNG::generateNextInt32() {
     return returnInt32;
 }
 
+/*
+    Bulk versions of generateNext() that keep both seeds in registers
+*/
+void MarsagliaRNG::fillUInt32(uint32_t* values, size_t count) {
+    unsigned int z = m_z, w = m_w;
+
+    for(size_t i = 0; i < count; i++) {
+        z = 36969 * (z & 65535) + (z >> 16);
+        w = 18000 * (w & 65535) + (w >> 16);
+        values[i] = (z << 16) + w;
+    }
+
+    m_z = z;
+    m_w = w;
+}
+
+void MarsagliaRNG::fill(uint64_t* values, size_t count) {
+    unsigned int z = m_z, w = m_w;
+
+    // Same layout as generateNextInt64(): first number is the lower half
+    for(size_t i = 0; i < count; i++) {
+        z = 36969 * (z & 65535) + (z >> 16);
+        w = 18000 * (w & 65535) + (w >> 16);
+        const uint32_t lower = (z << 16) + w;
+
+        z = 36969 * (z & 65535) + (z >> 16);
+        w = 18000 * (w & 65535) + (w >> 16);
+        const uint32_t upper = (z << 16) + w;
+
+        values[i] = ((uint64_t) lower) | (((uint64_t) upper) << 32);
+    }
+
+    m_z = z;
+    m_w = w;
+}
+
+void MarsagliaRNG::fillUniform(double* values, size_t count) {
+    unsigned int z = m_z, w = m_w;
+
+    for(size_t i = 0; i < count; i++) {
+        z = 36969 * (z & 65535) + (z >> 16);
+        w = 18000 * (w & 65535) + (w >> 16);
+        unsigned int next_uint = (z << 16) + w;
+        values[i] = (next_uint + 1) * 2.328306435454494e-10;
+    }
+
+    m_z = z;
+    m_w = w;
+}
+
 void MarsagliaRNG::seed(uint64_t newSeed) {
     m_z = (unsigned int) newSeed;
     m_w = (unsigned int) (((~newSeed) << 1) + 1);
@@ -72,6 +72,22 @@ public:
     */
     int32_t  generateNextInt32() override;
 
+    /**
+       Fills values with the next count unsigned 32-bit integers, tempering
+       whole runs of the current batch at a time
+    */
+    void fillUInt32(uint32_t* values, size_t count) override;
+
+    /**
+       Fills values with the next count unsigned 64-bit integers
+    */
+    void fill(uint64_t* values, size_t count) override;
+
+    /**
+       Fills values with the next count doubles between 0 and 1
+    */
+    void fillUniform(double* values, size_t count) override;
+
     /**
        Seed the XOR RNG
     */
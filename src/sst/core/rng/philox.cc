@@ -0,0 +1,168 @@
+// Copyright 2009-2020 NTESS. Under the terms
+// of Contract DE-NA0003525 with NTESS, the U.S.
+// Government retains certain rights in this software.
+//
+// Copyright (c) 2009-2020, NTESS
+// All rights reserved.
+//
+// This file is part of the SST software package. For license
+// information, see the LICENSE file in the top level directory of the
+// distribution.
+
+#include "sst_config.h"
+
+#include "philox.h"
+
+using namespace SST;
+using namespace SST::RNG;
+
+#define PHILOX_M0 0xD2511F53U
+#define PHILOX_M1 0xCD9E8D57U
+#define PHILOX_W0 0x9E3779B9U
+#define PHILOX_W1 0xBB67AE85U
+
+PhiloxRNG::PhiloxRNG(uint32_t seed, uint64_t componentId, uint32_t streamId) {
+    key[0] = seed;
+    key[1] = streamId;
+
+    counter[0] = 0;
+    counter[1] = 0;
+    counter[2] = (uint32_t) componentId;
+    counter[3] = (uint32_t) (componentId >> 32);
+
+    setPosition(0);
+}
+
+void PhiloxRNG::generateBlock(const uint32_t ctr[4], const uint32_t k[2], uint32_t out[4]) {
+    uint32_t c0 = ctr[0], c1 = ctr[1], c2 = ctr[2], c3 = ctr[3];
+    uint32_t k0 = k[0], k1 = k[1];
+
+    for(int round = 0; round < 10; round++) {
+        const uint64_t p0 = (uint64_t) PHILOX_M0 * c0;
+        const uint64_t p1 = (uint64_t) PHILOX_M1 * c2;
+
+        const uint32_t n0 = ((uint32_t) (p1 >> 32)) ^ c1 ^ k0;
+        const uint32_t n1 = (uint32_t) p1;
+        const uint32_t n2 = ((uint32_t) (p0 >> 32)) ^ c3 ^ k1;
+        const uint32_t n3 = (uint32_t) p0;
+
+        c0 = n0; c1 = n1; c2 = n2; c3 = n3;
+
+        k0 += PHILOX_W0;
+        k1 += PHILOX_W1;
+    }
+
+    out[0] = c0;
+    out[1] = c1;
+    out[2] = c2;
+    out[3] = c3;
+}
+
+/*
+    Compute the block containing the current position
+*/
+void PhiloxRNG::refill() {
+    const uint64_t blockIndex = position >> 2;
+    counter[0] = (uint32_t) blockIndex;
+    counter[1] = (uint32_t) (blockIndex >> 32);
+    generateBlock(counter, key, block);
+}
+
+void PhiloxRNG::setPosition(uint64_t newPosition) {
+    position = newPosition;
+    refill();
+}
+
+void PhiloxRNG::skipAhead(uint64_t count) {
+    setPosition(position + count);
+}
+
+uint32_t PhiloxRNG::generateNextUInt32() {
+    const uint32_t result = block[position & 3];
+    position++;
+    if((position & 3) == 0)
+        refill();
+    return result;
+}
+
+double PhiloxRNG::nextUniform() {
+    uint32_t temp = generateNextUInt32();
+    return ( (double) temp ) / (double) PHILOX_UINT32_MAX;
+}
+
+uint64_t PhiloxRNG::generateNextUInt64() {
+    // Same layout as the other generators: first number is the lower half
+    const uint64_t lowerHalf = generateNextUInt32();
+    const uint64_t upperHalf = generateNextUInt32();
+    return lowerHalf | (upperHalf << 32);
+}
+
+int64_t PhiloxRNG::generateNextInt64() {
+    return (int64_t) generateNextUInt64();
+}
+
+int32_t PhiloxRNG::generateNextInt32() {
+    return (int32_t) generateNextUInt32();
+}
+
+/*
+    Finish the current block, then generate whole blocks straight into the
+    output; blocks are independent of each other so this loop has no serial
+    dependency between iterations.
+*/
+void PhiloxRNG::fillUInt32(uint32_t* values, size_t count) {
+    while(count > 0 && (position & 3) != 0) {
+        *values++ = generateNextUInt32();
+        count--;
+    }
+
+    uint64_t blockIndex = position >> 2;
+    uint32_t ctr[4] = { 0, 0, counter[2], counter[3] };
+    while(count >= 4) {
+        ctr[0] = (uint32_t) blockIndex;
+        ctr[1] = (uint32_t) (blockIndex >> 32);
+        generateBlock(ctr, key, values);
+        blockIndex++;
+        position += 4;
+        values += 4;
+        count -= 4;
+    }
+
+    refill();
+    while(count > 0) {
+        *values++ = generateNextUInt32();
+        count--;
+    }
+}
+
+void PhiloxRNG::fill(uint64_t* values, size_t count) {
+    uint32_t halves[512];
+
+    while(count > 0) {
+        size_t run = count > 256 ? 256 : count;
+        fillUInt32(halves, 2 * run);
+
+        for(size_t i = 0; i < run; i++) {
+            values[i] = ((uint64_t) halves[2*i]) | (((uint64_t) halves[2*i + 1]) << 32);
+        }
+
+        values += run;
+        count -= run;
+    }
+}
+
+void PhiloxRNG::fillUniform(double* values, size_t count) {
+    uint32_t next[512];
+
+    while(count > 0) {
+        size_t run = count > 512 ? 512 : count;
+        fillUInt32(next, run);
+
+        for(size_t i = 0; i < run; i++) {
+            values[i] = ( (double) next[i] ) / (double) PHILOX_UINT32_MAX;
+        }
+
+        values += run;
+        count -= run;
+    }
+}
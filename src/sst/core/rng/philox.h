@@ -0,0 +1,131 @@
+// Copyright 2009-2020 NTESS. Under the terms
+// of Contract DE-NA0003525 with NTESS, the U.S.
+// Government retains certain rights in this software.
+//
+// Copyright (c) 2009-2020, NTESS
+// All rights reserved.
+//
+// This file is part of the SST software package. For license
+// information, see the LICENSE file in the top level directory of the
+// distribution.
+
+#ifndef SST_CORE_RNG_PHILOX_H
+#define SST_CORE_RNG_PHILOX_H
+
+#include <stdint.h>
+
+#include "sstrng.h"
+
+#define PHILOX_UINT32_MAX 4294967295U
+
+namespace SST {
+namespace RNG {
+/**
+    \class PhiloxRNG philox.h "sst/core/rng/philox.h"
+
+    Implements the Philox4x32-10 counter-based RNG (Salmon et al., "Parallel
+    Random Numbers: As Easy as 1, 2, 3", SC'11). Each output block is a pure
+    function of a key and a counter, so the numbers a component sees depend
+    only on (seed, component id, stream id) and not on which rank or thread
+    the component was placed on. Any position in the stream can be reached in
+    constant time, so checkpointing the generator only requires saving the
+    value returned by getPosition().
+
+    The seed and stream id form the 64-bit key; the component id fills the
+    upper half of the 128-bit counter and the block index the lower half,
+    giving every (component, stream) pair 2^64 blocks of four numbers.
+*/
+class PhiloxRNG : public SSTRandom {
+
+public:
+    /**
+        Create a new Philox RNG
+        @param[in] seed The seed shared by all streams of a simulation
+        @param[in] componentId Identifies the owner of the stream, normally the
+                   value of getId() for the component creating the generator
+        @param[in] streamId Distinguishes independent streams of one owner
+    */
+    PhiloxRNG(uint32_t seed, uint64_t componentId, uint32_t streamId = 0);
+
+    /**
+        Generates the next random number as a double value between 0 and 1.
+    */
+    double   nextUniform() override;
+
+    /**
+        Generates the next random number as an unsigned 32-bit integer
+    */
+    uint32_t generateNextUInt32() override;
+
+    /**
+        Generates the next random number as an unsigned 64-bit integer
+    */
+    uint64_t generateNextUInt64() override;
+
+    /**
+        Generates the next random number as a signed 64-bit integer
+    */
+    int64_t  generateNextInt64() override;
+
+    /**
+        Generates the next random number as a signed 32-bit integer
+    */
+    int32_t  generateNextInt32() override;
+
+    /**
+        Fills values with the next count unsigned 32-bit integers
+    */
+    void fillUInt32(uint32_t* values, size_t count) override;
+
+    /**
+        Fills values with the next count unsigned 64-bit integers
+    */
+    void fill(uint64_t* values, size_t count) override;
+
+    /**
+        Fills values with the next count doubles between 0 and 1
+    */
+    void fillUniform(double* values, size_t count) override;
+
+    /**
+        Skips the next count 32-bit outputs of the stream in constant time
+        (64-bit outputs count as two)
+    */
+    void skipAhead(uint64_t count);
+
+    /**
+        Returns the number of 32-bit outputs drawn from the stream so far
+    */
+    uint64_t getPosition() const { return position; }
+
+    /**
+        Moves the stream to a position previously returned by getPosition()
+    */
+    void setPosition(uint64_t newPosition);
+
+    /**
+        Computes one Philox4x32-10 block
+        @param[in] counter 128-bit counter as four 32-bit words, low word first
+        @param[in] key 64-bit key as two 32-bit words, low word first
+        @param[out] out The four output words
+    */
+    static void generateBlock(const uint32_t counter[4], const uint32_t key[2], uint32_t out[4]);
+
+private:
+    void refill();
+
+    uint32_t key[2];
+    uint32_t counter[4];
+    uint32_t block[4];
+
+    /**
+        Number of 32-bit outputs consumed; the low two bits index into block
+    */
+    uint64_t position;
+
+};
+
+} //namespace RNG
+} //namespace SST
+
+#endif //SST_CORE_RNG_PHILOX_H
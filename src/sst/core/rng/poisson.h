@@ -80,6 +80,40 @@ class SSTPoissonDistribution : public SSTRandomDistribution {
         return k - 1;
     }
 
+        /**
+            Gets the next count values in the distribution, the same values
+            count calls to getNextDouble() would return.  Every sample takes
+            at least one uniform, so one is drawn in bulk for each sample
+            still to make and whatever is left over is drawn in the next
+            round.  This never takes more uniforms from the base generator
+            than the single calls would.
+        */
+    void getNextDoubles(double* values, size_t count) {
+        const double L = exp(-lambda);
+        double uniforms[256];
+        double p = 1.0;
+        int k = 0;
+        size_t i = 0;
+
+        while(i < count) {
+            size_t n = count - i;
+            if(n > 256) {
+                n = 256;
+            }
+            baseDistrib->fillUniform(uniforms, n);
+
+            for(size_t j = 0; j < n; j++) {
+                k++;
+                p *= uniforms[j];
+                if(p <= L) {
+                    values[i++] = k - 1;
+                    p = 1.0;
+                    k = 0;
+                }
+            }
+        }
+    }
+
         /**
             Gets the lambda with which the distribution was created
             \return The lambda which the user created the distribution with
@@ -13,3 +13,26 @@
 #include "sst_config.h"
 #include "sstrng.h"
 
+using namespace SST::RNG;
+
+/*
+    Default bulk implementations; generators override these with loops that
+    avoid the per-number virtual call.
+*/
+void SSTRandom::fillUInt32(uint32_t* values, size_t count) {
+    for(size_t i = 0; i < count; i++) {
+        values[i] = generateNextUInt32();
+    }
+}
+
+void SSTRandom::fill(uint64_t* values, size_t count) {
+    for(size_t i = 0; i < count; i++) {
+        values[i] = generateNextUInt64();
+    }
+}
+
+void SSTRandom::fillUniform(double* values, size_t count) {
+    for(size_t i = 0; i < count; i++) {
+        values[i] = nextUniform();
+    }
+}
@@ -13,6 +13,7 @@
 #define SST_CORE_RNG_SSTRNG_H
 
 #include <stdint.h>
+#include <cstddef>
 
 namespace SST {
 namespace RNG {
@@ -52,6 +53,26 @@ class SSTRandom {
     */
         virtual int32_t  generateNextInt32() = 0;
 
+    /**
+        Fills values with the next count random numbers as unsigned 32-bit
+        integers. The numbers are the same as count calls to
+        generateNextUInt32() would return.
+    */
+    virtual void fillUInt32(uint32_t* values, size_t count);
+
+    /**
+        Fills values with the next count random numbers as unsigned 64-bit
+        integers. The numbers are the same as count calls to
+        generateNextUInt64() would return.
+    */
+    virtual void fill(uint64_t* values, size_t count);
+
+    /**
+        Fills values with the next count random numbers in the range 0 to 1.
+        The numbers are the same as count calls to nextUniform() would return.
+    */
+    virtual void fillUniform(double* values, size_t count);
+
     /**
         Destroys the random number generator
     */
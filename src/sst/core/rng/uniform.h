@@ -85,6 +85,25 @@ class SSTUniformDistribution : public SSTRandomDistribution {
 		return static_cast<double>( current_bin - 1 );
     	}
 
+    	/**
+	    Gets the next count values in the distribution, the same values
+	    count calls to getNextDouble() would return
+    	*/
+    	void getNextDoubles(double* values, size_t count) {
+		baseDistrib->fillUniform(values, count);
+
+		for( size_t i = 0; i < count; i++ ) {
+			const double nextD = values[i];
+			uint32_t current_bin = 1;
+
+			while( nextD > ( static_cast<double>( current_bin ) * probPerBin ) ) {
+				current_bin++;
+			}
+
+			values[i] = static_cast<double>( current_bin - 1 );
+		}
+    	}
+
     protected:
         /**
             Sets the base random number generator for the distribution.
@@ -103,6 +103,56 @@ int32_t  XORShiftRNG::generateNextInt32() {
     return returnInt32;
 }
 
+/*
+    Each number depends on the previous state, so a single stream cannot be
+    split across SIMD lanes without changing the sequence.  Instead the bulk
+    calls keep the state in registers for the whole run.
+*/
+void XORShiftRNG::fillUInt32(uint32_t* values, size_t count) {
+    uint32_t lx = x, ly = y, lz = z, lw = w;
+
+    for(size_t i = 0; i < count; i++) {
+        uint32_t t = lx ^ (lx << 11);
+        lx = ly; ly = lz; lz = lw;
+        lw = lw ^ (lw >> 19) ^ t ^ (t >> 8);
+        values[i] = lw;
+    }
+
+    x = lx; y = ly; z = lz; w = lw;
+}
+
+void XORShiftRNG::fill(uint64_t* values, size_t count) {
+    uint32_t lx = x, ly = y, lz = z, lw = w;
+
+    // Same layout as generateNextInt64(): first number is the lower half
+    for(size_t i = 0; i < count; i++) {
+        uint32_t t = lx ^ (lx << 11);
+        lx = ly; ly = lz; lz = lw;
+        const uint32_t lower = lw = lw ^ (lw >> 19) ^ t ^ (t >> 8);
+
+        t = lx ^ (lx << 11);
+        lx = ly; ly = lz; lz = lw;
+        const uint32_t upper = lw = lw ^ (lw >> 19) ^ t ^ (t >> 8);
+
+        values[i] = ((uint64_t) lower) | (((uint64_t) upper) << 32);
+    }
+
+    x = lx; y = ly; z = lz; w = lw;
+}
+
+void XORShiftRNG::fillUniform(double* values, size_t count) {
+    uint32_t lx = x, ly = y, lz = z, lw = w;
+
+    for(size_t i = 0; i < count; i++) {
+        uint32_t t = lx ^ (lx << 11);
+        lx = ly; ly = lz; lz = lw;
+        lw = lw ^ (lw >> 19) ^ t ^ (t >> 8);
+        values[i] = ( (double) lw ) / (double) XORSHIFT_UINT32_MAX;
+    }
+
+    x = lx; y = ly; z = lz; w = lw;
+}
+
 void XORShiftRNG::seed(uint64_t seed) {
     x = (uint32_t) seed;
     y = 0;
@@ -73,6 +73,21 @@ class XORShiftRNG : public SSTRandom {
     */
     int32_t  generateNextInt32() override;
 
+    /**
+        Fills values with the next count unsigned 32-bit integers
+    */
+    void fillUInt32(uint32_t* values, size_t count) override;
+
+    /**
+        Fills values with the next count unsigned 64-bit integers
+    */
+    void fill(uint64_t* values, size_t count) override;
+
+    /**
+        Fills values with the next count doubles between 0 and 1
+    */
+    void fillUniform(double* values, size_t count) override;
+
     /**
         Seed the XOR RNG
     */
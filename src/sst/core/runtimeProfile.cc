@@ -0,0 +1,225 @@
+// Copyright 2009-2020 NTESS. Under the terms
+// of Contract DE-NA0003525 with NTESS, the U.S.
+// Government retains certain rights in this software.
+//
+// Copyright (c) 2009-2020, NTESS
+// All rights reserved.
+//
+// This file is part of the SST software package. For license
+// information, see the LICENSE file in the top level directory of the
+// distribution.
+
+#include "sst_config.h"
+#include "sst/core/runtimeProfile.h"
+
+#include "sst/core/config.h"
+#include "sst/core/output.h"
+#include "sst/core/objectComms.h"
+
+#include <algorithm>
+#include <cinttypes>
+#include <cstring>
+#include <cxxabi.h>
+
+namespace SST {
+namespace Core {
+namespace Profile {
+
+std::mutex RuntimeProfile::totalsMutex;
+RuntimeProfile::Totals_t RuntimeProfile::totals(RuntimeProfile::NUM_CATEGORIES);
+double RuntimeProfile::runSeconds = 0.0;
+uint32_t RuntimeProfile::threadsMerged = 0;
+
+
+RuntimeProfile::RuntimeProfile() :
+    runStartTicks(0),
+    runTicks(0)
+{
+    createTicks = getTicks();
+    createTime = std::chrono::steady_clock::now();
+}
+
+Counter*
+RuntimeProfile::getCounter(Category cat, const std::string& name)
+{
+    // std::map never moves its entries, so the pointer stays valid
+    return &counters[cat][name];
+}
+
+std::string
+RuntimeProfile::handlerTypeName(const std::type_info& info)
+{
+    int status = 0;
+    char* name = abi::__cxa_demangle(info.name(), nullptr, nullptr, &status);
+    if ( 0 != status || nullptr == name ) return info.name();
+    std::string ret(name);
+    free(name);
+    return ret;
+}
+
+Event::HandlerBase*
+RuntimeProfile::wrapEventHandler(Event::HandlerBase* handler, const std::string& component)
+{
+    if ( nullptr == handler ) return handler;
+    return new ProfiledEventHandler(handler, getCounter(COMPONENT, component),
+                                    getCounter(HANDLER, "event: " + handlerTypeName(typeid(*handler))));
+}
+
+void
+RuntimeProfile::registerClockHandler(Clock::HandlerBase* handler, const std::string& component)
+{
+    clockHandlers.set(handler, { getCounter(COMPONENT, component),
+                                 getCounter(HANDLER, "clock: " + handlerTypeName(typeid(*handler))) });
+}
+
+void
+RuntimeProfile::startRun()
+{
+    runStartTicks = getTicks();
+}
+
+void
+RuntimeProfile::endRun()
+{
+    runTicks += getTicks() - runStartTicks;
+}
+
+void
+RuntimeProfile::mergeThread()
+{
+    // Calibrate over the whole life of the profile so short runs still
+    // get a sensible tick rate
+    std::chrono::duration<double> elapsed = std::chrono::steady_clock::now() - createTime;
+    uint64_t ticks = getTicks() - createTicks;
+    double secondsPerTick = ticks > 0 ? elapsed.count() / ticks : 0.0;
+
+    std::lock_guard<std::mutex> lock(totalsMutex);
+    for ( int cat = 0 ; cat < NUM_CATEGORIES ; cat++ ) {
+        for ( auto& c : counters[cat] ) {
+            auto& total = totals[cat][c.first];
+            total.first += c.second.ticks * secondsPerTick;
+            total.second += c.second.count;
+        }
+    }
+    runSeconds += runTicks * secondsPerTick;
+    threadsMerged++;
+}
+
+
+static double
+sumCategory(const std::map<std::string, std::pair<double, uint64_t>>& cat, const char* prefix, uint64_t& count)
+{
+    double seconds = 0.0;
+    count = 0;
+    size_t len = prefix ? strlen(prefix) : 0;
+    for ( auto& item : cat ) {
+        if ( len && item.first.compare(0, len, prefix) ) continue;
+        seconds += item.second.first;
+        count += item.second.second;
+    }
+    return seconds;
+}
+
+static void
+writeCategory(Output& out, const char* title, const std::map<std::string, std::pair<double, uint64_t>>& cat,
+              double runSeconds, size_t limit)
+{
+    std::vector<std::pair<std::string, std::pair<double, uint64_t>>> items(cat.begin(), cat.end());
+    std::sort(items.begin(), items.end(),
+              [](const std::pair<std::string, std::pair<double, uint64_t>>& a,
+                 const std::pair<std::string, std::pair<double, uint64_t>>& b) {
+                  return a.second.first > b.second.first;
+              });
+
+    if ( limit == 0 || limit > items.size() ) limit = items.size();
+    out.output("\n%s (%zu of %zu, by time):\n", title, limit, items.size());
+    out.output("  %12s %8s %14s %12s  %s\n", "Time (s)", "% run", "Calls", "Avg (ns)", "Name");
+    for ( size_t i = 0 ; i < limit ; i++ ) {
+        double seconds = items[i].second.first;
+        uint64_t count = items[i].second.second;
+        out.output("  %12.6f %8.2f %14" PRIu64 " %12.1f  %s\n", seconds,
+                   runSeconds > 0.0 ? 100.0 * seconds / runSeconds : 0.0,
+                   count, count ? 1.0e9 * seconds / count : 0.0, items[i].first.c_str());
+    }
+}
+
+RuntimeProfile::Totals_t
+RuntimeProfile::gatherTotals(const RankInfo& worldSize)
+{
+    Totals_t all = totals;
+
+#ifdef SST_CONFIG_HAVE_MPI
+    if ( worldSize.rank > 1 ) {
+        std::vector<Totals_t> gathered;
+        Comms::all_gather(totals, gathered);
+        all = Totals_t(NUM_CATEGORIES);
+        for ( auto& rankTotals : gathered ) {
+            for ( int cat = 0 ; cat < NUM_CATEGORIES ; cat++ ) {
+                for ( auto& item : rankTotals[cat] ) {
+                    all[cat][item.first].first += item.second.first;
+                    all[cat][item.first].second += item.second.second;
+                }
+            }
+        }
+    }
+#else
+    (void)worldSize;
+#endif
+
+    return all;
+}
+
+void
+RuntimeProfile::writeReport(Config& cfg, Output& out, const RankInfo& myRank, const RankInfo& worldSize)
+{
+    Totals_t all = gatherTotals(worldSize);
+    double allRunSeconds = runSeconds;
+    uint32_t allThreads = threadsMerged;
+
+#ifdef SST_CONFIG_HAVE_MPI
+    if ( worldSize.rank > 1 ) {
+        MPI_Allreduce(&runSeconds, &allRunSeconds, 1, MPI_DOUBLE, MPI_SUM, MPI_COMM_WORLD);
+        MPI_Allreduce(&threadsMerged, &allThreads, 1, MPI_UINT32_T, MPI_SUM, MPI_COMM_WORLD);
+    }
+#else
+    (void)worldSize;
+#endif
+
+    if ( myRank.rank != 0 ) return;
+
+    // The full report goes to the file; the console only gets the top
+    // of each list
+    Output fileOut;
+    if ( !cfg.profiling_output.empty() ) {
+        fileOut.init("", 0, 0, Output::FILE, cfg.profiling_output);
+    }
+    Output& rep = cfg.profiling_output.empty() ? out : fileOut;
+    size_t limit = cfg.profiling_output.empty() ? 20 : 0;
+
+    uint64_t eventCount, clockCount, syncCount;
+    double eventSeconds = sumCategory(all[HANDLER], "event: ", eventCount);
+    double clockSeconds = sumCategory(all[HANDLER], "clock: ", clockCount);
+    double syncSeconds = all[SYNC].count("sync manager") ? all[SYNC]["sync manager"].first : 0.0;
+    syncCount = all[SYNC].count("sync manager") ? all[SYNC]["sync manager"].second : 0;
+
+    rep.output("\n");
+    rep.output("------------------------------------------------------------\n");
+    rep.output("Simulation Profile Information:\n");
+    rep.output("Run loop time:                   %f seconds (summed over %" PRIu32 " threads)\n", allRunSeconds, allThreads);
+    rep.output("Event handlers:                  %f seconds, %" PRIu64 " events\n", eventSeconds, eventCount);
+    rep.output("Clock handlers:                  %f seconds, %" PRIu64 " calls\n", clockSeconds, clockCount);
+    rep.output("Sync:                            %f seconds, %" PRIu64 " syncs\n", syncSeconds, syncCount);
+    rep.output("Core (queue, dispatch, other):   %f seconds\n",
+               std::max(0.0, allRunSeconds - eventSeconds - clockSeconds - syncSeconds));
+
+    writeCategory(rep, "Components", all[COMPONENT], allRunSeconds, limit);
+    writeCategory(rep, "Handler types", all[HANDLER], allRunSeconds, limit);
+    writeCategory(rep, "Clocks", all[CLOCK], allRunSeconds, limit);
+    writeCategory(rep, "Sync", all[SYNC], allRunSeconds, limit);
+    rep.output("------------------------------------------------------------\n");
+    rep.output("\n");
+}
+
+} // namespace Profile
+} // namespace Core
+} // namespace SST
@@ -0,0 +1,192 @@
+// Copyright 2009-2020 NTESS. Under the terms
+// of Contract DE-NA0003525 with NTESS, the U.S.
+// Government retains certain rights in this software.
+//
+// Copyright (c) 2009-2020, NTESS
+// All rights reserved.
+//
+// This file is part of the SST software package. For license
+// information, see the LICENSE file in the top level directory of the
+// distribution.
+
+#ifndef SST_CORE_RUNTIMEPROFILE_H
+#define SST_CORE_RUNTIMEPROFILE_H
+
+#include "sst/core/sst_types.h"
+#include "sst/core/rankInfo.h"
+#include "sst/core/profile.h"
+#include "sst/core/clock.h"
+#include "sst/core/event.h"
+
+#include <chrono>
+#include <map>
+#include <mutex>
+#include <string>
+#include <typeinfo>
+#include <unordered_map>
+#include <vector>
+
+namespace SST {
+
+class Config;
+class Output;
+
+namespace Core {
+namespace Profile {
+
+/** Accumulated ticks and number of calls for one profiled item */
+struct Counter {
+    uint64_t ticks;
+    uint64_t count;
+
+    Counter() : ticks(0), count(0) {}
+
+    inline void add(uint64_t t) {
+        ticks += t;
+        count++;
+    }
+};
+
+/** Charges the ticks spent in its scope to a Counter, if there is one */
+class Scope {
+public:
+    explicit Scope(Counter* counter) : counter(counter), start(0) {
+        if ( nullptr != counter ) start = getTicks();
+    }
+    ~Scope() {
+        if ( nullptr != counter ) counter->add(getTicks() - start);
+    }
+private:
+    Counter* counter;
+    uint64_t start;
+};
+
+
+/** Event handler that times the handler it wraps.  The type counter
+ * may be nullptr. */
+class ProfiledEventHandler : public Event::HandlerBase {
+public:
+    ProfiledEventHandler(Event::HandlerBase* handler, Counter* component, Counter* type) :
+        handler(handler), component(component), type(type)
+    {}
+
+    ~ProfiledEventHandler() { delete handler; }
+
+    void operator()(Event* event) override {
+        uint64_t start = getTicks();
+        (*handler)(event);
+        uint64_t ticks = getTicks() - start;
+        component->add(ticks);
+        if ( nullptr != type ) type->add(ticks);
+    }
+
+private:
+    Event::HandlerBase* handler;
+    Counter* component;
+    Counter* type;
+};
+
+
+/**
+ * Counters charged for each call of a clock handler, kept beside the
+ * handlers (keyed by handler) rather than in Clock::HandlerBase.  Clock
+ * looks up each handler it calls while profiling.
+ */
+class ClockHandlerCounters {
+public:
+    /** Charge each call of handler to counters, replacing any earlier set */
+    void set(const Clock::HandlerBase* handler, const std::vector<Counter*>& list) {
+        counters[handler] = list;
+    }
+
+    /** Charge one call of handler, if it has counters */
+    void charge(const Clock::HandlerBase* handler, uint64_t ticks) const {
+        auto it = counters.find(handler);
+        if ( it == counters.end() ) return;
+        for ( Counter* c : it->second ) c->add(ticks);
+    }
+
+private:
+    std::unordered_map<const Clock::HandlerBase*, std::vector<Counter*>> counters;
+};
+
+
+/**
+ * Runtime profile enabled with --enable-profiling.
+ *
+ * Each Simulation (i.e. each thread) owns one RuntimeProfile and only
+ * that thread touches its counters, so no synchronization is needed
+ * while the simulation runs.  At the end of the run loop each thread
+ * converts its ticks to seconds and folds them into the rank totals,
+ * which are then combined across ranks and reported by rank 0.
+ *
+ * Time is attributed per component (by name), per event or clock
+ * handler type, per clock, and to the sync phases.  A component's
+ * time is the sum of the time spent in its event and clock handlers.
+ */
+class RuntimeProfile {
+public:
+    enum Category { COMPONENT = 0, HANDLER, CLOCK, SYNC, NUM_CATEGORIES };
+
+    RuntimeProfile();
+
+    /** Returns the counter for the named item.  The pointer stays
+     * valid for the life of the RuntimeProfile. */
+    Counter* getCounter(Category cat, const std::string& name);
+
+    /**
+     * Wraps an event handler so that each delivery is charged to the
+     * component and to the handler's type.  The returned handler owns
+     * the original.
+     */
+    Event::HandlerBase* wrapEventHandler(Event::HandlerBase* handler, const std::string& component);
+
+    /** Charge each call of a clock handler to the component that owns
+     * it and to the handler's type */
+    void registerClockHandler(Clock::HandlerBase* handler, const std::string& component);
+
+    /** Counters for the registered clock handlers, for Clock */
+    const ClockHandlerCounters* getClockHandlerCounters() const { return &clockHandlers; }
+
+    /** Bracket the main run loop */
+    void startRun();
+    void endRun();
+
+    /** Fold this thread's counters into the rank totals */
+    void mergeThread();
+
+    /**
+     * Combine the totals across ranks and write the report on rank 0,
+     * to the --output-profile file if given, otherwise to out.  Must
+     * be called by every rank.
+     */
+    static void writeReport(Config& cfg, Output& out, const RankInfo& myRank, const RankInfo& worldSize);
+
+private:
+    /** Per-category name -> (seconds, count) */
+    typedef std::vector<std::map<std::string, std::pair<double, uint64_t>>> Totals_t;
+
+    static std::string handlerTypeName(const std::type_info& info);
+    static Totals_t gatherTotals(const RankInfo& worldSize);
+
+    std::map<std::string, Counter> counters[NUM_CATEGORIES];
+    ClockHandlerCounters clockHandlers;
+
+    /* Used to calibrate ticks against wall time */
+    uint64_t createTicks;
+    std::chrono::steady_clock::time_point createTime;
+
+    uint64_t runStartTicks;
+    uint64_t runTicks;
+
+    static std::mutex totalsMutex;
+    static Totals_t totals;
+    static double runSeconds;
+    static uint32_t threadsMerged;
+};
+
+} // namespace Profile
+} // namespace Core
+} // namespace SST
+
+#endif // SST_CORE_RUNTIMEPROFILE_H
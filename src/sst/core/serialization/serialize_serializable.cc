@@ -12,6 +12,7 @@
 #include "sst_config.h"
 #include "sst/core/serialization/serialize_serializable.h"
 
+#include <algorithm>
 #include <iostream>
 
 namespace SST {
@@ -21,8 +22,50 @@ namespace pvt {
 
 static const long null_ptr_id = -1;
 
+// Compact class tags: 0 is a null pointer, 1..N an entry in the class
+// table, and N+1 a new class whose id follows
+void
+serialize_class_tag(serializable*& s, serializer& ser){
+  std::vector<uint32_t>& table = *ser.class_table();
+  if ( ser.mode() == serializer::UNPACK ) {
+    uint64_t tag;
+    ser.varint(tag);
+    if ( tag == 0 ) {
+      s = nullptr;
+      return;
+    }
+    if ( tag > table.size() ) {
+      uint32_t cls_id = 0;
+      ser.primitive(cls_id);
+      table.push_back(cls_id);
+      tag = table.size();
+    }
+    s = SST::Core::Serialization::serializable_factory::get_serializable(table[tag - 1]);
+    return;
+  }
+
+  if ( !s ) {
+    uint64_t tag = 0;
+    ser.varint(tag);
+    return;
+  }
+  uint32_t cls_id = s->cls_id();
+  auto it = std::find(table.begin(), table.end(), cls_id);
+  uint64_t tag = (it - table.begin()) + 1;
+  ser.varint(tag);
+  if ( it == table.end() ) {
+    ser.primitive(cls_id);
+    table.push_back(cls_id);
+  }
+}
+
 void
 size_serializable(serializable* s, serializer& ser){
+  if ( ser.class_table() ) {
+    serialize_class_tag(s, ser);
+    if (s) s->serialize_order(ser);
+    return;
+  }
   long dummy = 0;
   ser.size(dummy);
   if (s) {
@@ -32,6 +75,11 @@ size_serializable(serializable* s, serializer& ser){
 
 void
 pack_serializable(serializable* s, serializer& ser){
+    if ( ser.class_table() ) {
+      serialize_class_tag(s, ser);
+      if (s) s->serialize_order(ser);
+      return;
+    }
     if (s) {
     // debug_printf(dbg::serialize,
     //   "object with class id %ld: %s",
@@ -49,6 +97,11 @@ pack_serializable(serializable* s, serializer& ser){
 
 void
 unpack_serializable(serializable*& s, serializer& ser){
+  if ( ser.class_table() ) {
+    serialize_class_tag(s, ser);
+    if (s) s->serialize_order(ser);
+    return;
+  }
   long cls_id;
   ser.unpack(cls_id);
   if (cls_id == null_ptr_id) {
@@ -32,6 +32,12 @@ pack_serializable(serializable* s, serializer& ser);
 void
 unpack_serializable(serializable*& s, serializer& ser);
 
+/** In compact mode (see serializer::set_class_table), writes the class
+ * tag of s or, when unpacking, reads it and sets s to a new object of
+ * that class (nullptr for a null pointer) */
+void
+serialize_class_tag(serializable*& s, serializer& ser);
+
 }
 
 template <>
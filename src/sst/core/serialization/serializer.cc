@@ -94,6 +94,41 @@ serializer::string(std::string& str)
   }
 }
 
+void
+serializer::varint(uint64_t& v)
+{
+  switch(mode_)
+  {
+  case SIZER: {
+    size_t bytes = 1;
+    for ( uint64_t x = v >> 7; x != 0; x >>= 7 ) bytes++;
+    sizer_.add(bytes);
+    break;
+  }
+  case PACK: {
+    uint64_t x = v;
+    while ( x >= 0x80 ) {
+      *packer_.next_str(1) = static_cast<char>(x | 0x80);
+      x >>= 7;
+    }
+    *packer_.next_str(1) = static_cast<char>(x);
+    break;
+  }
+  case UNPACK: {
+    uint64_t x = 0;
+    uint8_t byte;
+    int shift = 0;
+    do {
+      byte = static_cast<uint8_t>(*unpacker_.next_str(1));
+      x |= static_cast<uint64_t>(byte & 0x7f) << shift;
+      shift += 7;
+    } while ( (byte & 0x80) && shift < 64 );
+    v = x;
+    break;
+  }
+  }
+}
+
 } // end of namespace sprockit
 }
 }
@@ -41,7 +41,9 @@ public:
 
 public:
     serializer() :
-        mode_(SIZER) //just sizing by default
+        mode_(SIZER), //just sizing by default
+        class_table_(nullptr),
+        skip_event_header_(false)
         {
         }
 
@@ -180,6 +182,58 @@ public:
     void
     string(std::string& str);
 
+    /** Unsigned integer in a variable length encoding (7 bits per byte,
+     * high bit set on all but the last byte) */
+    void
+    varint(uint64_t& v);
+
+    /** size bytes copied as is, with no length prefix */
+    void
+    raw(void* buf, size_t size){
+        switch (mode_) {
+        case SIZER:
+            sizer_.add(size);
+            break;
+        case PACK:
+            ::memcpy(packer_.next_str(size), buf, size);
+            break;
+        case UNPACK:
+            ::memcpy(buf, unpacker_.next_str(size), size);
+            break;
+        }
+    }
+
+    /**
+     * Compact mode, used for events sent between ranks.  Polymorphic
+     * objects are tagged with an index into the class table instead of
+     * their full class id.  The table must start out empty for each
+     * sizing, packing and unpacking pass over the same objects.
+     */
+    void
+    set_class_table(std::vector<uint32_t>* table) {
+        class_table_ = table;
+    }
+
+    std::vector<uint32_t>*
+    class_table() const {
+        return class_table_;
+    }
+
+    /** Tells Event::serialize_order() that the caller writes the
+     * Activity and Event fields of the next event itself */
+    void
+    skip_event_header() {
+        skip_event_header_ = true;
+    }
+
+    /** Returns and clears the flag set by skip_event_header() */
+    bool
+    take_skip_event_header() {
+        bool ret = skip_event_header_;
+        skip_event_header_ = false;
+        return ret;
+    }
+
     void
     start_packing(char* buffer, size_t size){
         packer_.init(buffer, size);
@@ -215,6 +269,8 @@ protected:
     pvt::ser_unpacker unpacker_;
     pvt::ser_sizer sizer_;
     SERIALIZE_MODE mode_;
+    std::vector<uint32_t>* class_table_;
+    bool skip_event_header_;
 
 };
 
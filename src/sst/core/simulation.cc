@@ -14,6 +14,7 @@
 #include "sst/core/simulation.h"
 #include "sst/core/warnmacros.h"
 
+#include <algorithm>
 #include <utility>
 
 #include "sst/core/clock.h"
@@ -24,8 +25,11 @@
 #include "sst/core/factory.h"
 #include "sst/core/linkMap.h"
 #include "sst/core/linkPair.h"
+#include "sst/core/linkTelemetry.h"
+#include "sst/core/memuse.h"
 #include "sst/core/sharedRegionImpl.h"
 #include "sst/core/output.h"
+#include "sst/core/runtimeProfile.h"
 #include "sst/core/stopAction.h"
 #include "sst/core/stringize.h"
 #include "sst/core/syncBase.h"
@@ -75,6 +79,15 @@ Simulation::~Simulation()
     // Clear out Components
     compInfoMap.clear();
 
+    delete runtimeProfile;
+    delete linkTelemetry;
+
+    // The LinkMaps are gone, so the port tables can go too
+    for ( auto &pt : portTables ) {
+        delete pt.second;
+    }
+    portTables.clear();
+
     // // Delete any remaining links.  This should never happen now, but
     // // when we add an API to have components build subcomponents, user
     // // error could cause LinkMaps to be left.
@@ -118,6 +131,7 @@ void Simulation::shutdown()
 
 Simulation::Simulation( Config* cfg, RankInfo my_rank, RankInfo num_ranks, SimTime_t min_part) :
     runMode(cfg->runMode),
+    rankSyncType(cfg->rank_sync),
     timeVortex(nullptr),
     interThreadMinLatency(MAX_SIMTIME_T),
     threadSync(nullptr),
@@ -130,11 +144,16 @@ Simulation::Simulation( Config* cfg, RankInfo my_rank, RankInfo num_ranks, SimTi
     untimed_phase(0),
     lastRecvdSignal(0),
     shutdown_mode(SHUTDOWN_CLEAN),
-    wireUpFinished(false)
+    wireUpFinished(false),
+    runtimeProfile(nullptr),
+    linkTelemetry(nullptr)
 {
     sim_output.init(cfg->output_core_prefix, cfg->getVerboseLevel(), 0, Output::STDOUT);
     output_directory = "";
 
+    if ( cfg->profilingEnabled() ) runtimeProfile = new Core::Profile::RuntimeProfile();
+    if ( !cfg->output_partition_weights.empty() ) linkTelemetry = new Core::Profile::LinkTelemetry();
+
     Params p;
     //params get passed twice - both the params and a ctor argument
     timeVortex = factory->Create<TimeVortex>(cfg->timeVortex,p,p);
@@ -223,8 +242,8 @@ Simulation::processGraphInfo( ConfigGraph& graph, const RankInfo& UNUSED(myRank)
     int cross_thread_links = 0;
     if ( num_ranks.thread > 1 ) {
         // Need to determine the lookahead for the thread synchronization
-        ConfigComponentMap_t comps = graph.getComponentMap();
-        ConfigLinkMap_t links = graph.getLinkMap();
+        ConfigComponentMap_t& comps = graph.getComponentMap();
+        ConfigLinkMap_t& links = graph.getLinkMap();
         // Find the minimum latency across a partition
         for ( auto iter = links.begin(); iter != links.end(); ++iter ) {
             ConfigLink &clink = *iter;
@@ -267,7 +286,9 @@ Simulation::processGraphInfo( ConfigGraph& graph, const RankInfo& UNUSED(myRank)
     // Create the SyncManager for this rank.  It gets created even if
     // we are single rank/single thread because it also manages the
     // Exit and Heartbeat actions.
-    syncManager = new SyncManager(my_rank, num_ranks, minPartTC = minPartToTC(min_part), min_part, interThreadLatencies);
+    Core::MemAccounting::Scope mem_scope(Core::MemAccounting::LINKS);
+    syncManager = new SyncManager(my_rank, num_ranks, minPartTC = minPartToTC(min_part), min_part, interThreadLatencies,
+                                  rankSyncType);
 
     // Determine if this thread is independent.  That means there is
     // no need to synchronize with any other threads or ranks.
@@ -279,6 +300,13 @@ Simulation::processGraphInfo( ConfigGraph& graph, const RankInfo& UNUSED(myRank)
     }
 }
 
+PortTable* Simulation::getPortTable(const std::string& type)
+{
+    PortTable*& table = portTables[type];
+    if ( table == nullptr ) table = new PortTable();
+    return table;
+}
+
 int Simulation::performWireUp( ConfigGraph& graph, const RankInfo& myRank, SimTime_t UNUSED(min_part))
 {
     // Create the Statistics Engine
@@ -288,6 +316,7 @@ int Simulation::performWireUp( ConfigGraph& graph, const RankInfo& myRank, SimTi
     // Params objects should now start verifying parameters
     Params::enableVerify();
 
+    Core::MemAccounting::Scope mem_scope(Core::MemAccounting::COMPONENTS);
 
     // First, go through all the components that are in this rank and
     // create the ComponentInfo object for it
@@ -297,13 +326,14 @@ int Simulation::performWireUp( ConfigGraph& graph, const RankInfo& myRank, SimTi
     {
         ConfigComponent* ccomp = &(*iter);
         if ( ccomp->rank == myRank ) {
-            compInfoMap.insert(new ComponentInfo(ccomp, ccomp->name, nullptr, new LinkMap()));
+            compInfoMap.insert(new ComponentInfo(ccomp, ccomp->name, nullptr, ComponentInfo::createLinkMap(ccomp->type)));
         }
     }
 
     // We will go through all the links and create LinkPairs for each
     // link.  We will also create a LinkMap for each component and put
     // them into a map with ComponentID as the key.
+    Core::MemAccounting::setThreadTag(Core::MemAccounting::LINKS);
     for( ConfigLinkMap_t::iterator iter = graph.links.begin();
             iter != graph.links.end(); ++iter )
     {
@@ -339,6 +369,12 @@ int Simulation::performWireUp( ConfigGraph& graph, const RankInfo& myRank, SimTi
             }
             cinfo->getLinkMap()->insertLink(clink.port[1],lp.getRight());
 
+            if ( linkTelemetry ) {
+                Core::Profile::LinkCounter* counter =
+                    linkTelemetry->getLinkCounter(clink.name, Core::Profile::LinkTelemetry::LOCAL);
+                lp.getLeft()->telemetry = counter;
+                lp.getRight()->telemetry = counter;
+            }
         }
         // If the components are not in the same thread, then the
         // SyncManager will handle things
@@ -368,6 +404,13 @@ int Simulation::performWireUp( ConfigGraph& graph, const RankInfo& myRank, SimTi
             }
             cinfo->getLinkMap()->insertLink(clink.port[local],lp.getLeft());
 
+            // Only the local side sends from this thread; the other
+            // direction is counted by the thread that owns it
+            if ( linkTelemetry ) {
+                lp.getLeft()->telemetry = linkTelemetry->getLinkCounter(clink.name,
+                        rank[0].rank == rank[1].rank ? Core::Profile::LinkTelemetry::THREAD : Core::Profile::LinkTelemetry::RANK);
+            }
+
             // Need to register with both of the syncs (the ones for
             // both local and remote thread)
 
@@ -379,10 +422,16 @@ int Simulation::performWireUp( ConfigGraph& graph, const RankInfo& myRank, SimTi
             lp.getRight()->untimedQueue = sync_q;
         }
 
+        // Nothing needs the names once the link is wired up.  Threads
+        // wire up in order, so the highest thread on this rank that
+        // has an end of the link is the last to use them.
+        if ( rank[0].rank != rank[1].rank || std::max(rank[0].thread, rank[1].thread) == myRank.thread ) {
+            Core::MemAccounting::Scope graph_scope(Core::MemAccounting::CONFIG_GRAPH);
+            clink.releaseNames();
+        }
     }
 
-    // Done with that edge, delete it.
-//    graph.links.clear();
+    Core::MemAccounting::setThreadTag(Core::MemAccounting::COMPONENTS);
 
     // Now, build all the components
     for ( auto iter = graph.comps.begin(); iter != graph.comps.end(); ++iter )
@@ -399,15 +448,24 @@ int Simulation::performWireUp( ConfigGraph& graph, const RankInfo& myRank, SimTi
                 printf("WARNING: Building component \"%s\" with no links assigned.\n",ccomp->name.c_str());
             }
 
-            tmp = createComponent( ccomp->id, ccomp->type, ccomp->params );
+            {
+                Core::MemAccounting::ComponentScope comp_mem_scope(ccomp->type, true);
+                tmp = createComponent( ccomp->id, ccomp->type, ccomp->params );
+            }
 
             cinfo->setComponent(tmp);
+
+            // The component has copied what it needs, so free its
+            // configuration now and let the components built after it
+            // reuse the memory.  Only the params of SubComponents that
+            // are not loaded yet are kept, since they can still be
+            // loaded from init(), setup() or later.  Other threads only
+            // read the rank, which is kept.
+            Core::MemAccounting::Scope graph_scope(Core::MemAccounting::CONFIG_GRAPH);
+            cinfo->releaseConfigGraph();
+            ccomp->releaseConfiguration();
         }
     } // end for all vertex
-    // Done with vertices, delete them;
-    /*  TODO:  THREADING:  Clear only once everybody is done.
-    graph.comps.clear();
-    */
     wireUpFinished = true;
     // std::cout << "Done with performWireUp" << std::endl;
     return 0;
@@ -415,6 +473,8 @@ int Simulation::performWireUp( ConfigGraph& graph, const RankInfo& myRank, SimTi
 
 void Simulation::initialize() {
     bool done = false;
+    // All threads are wired up, so the links to other ranks are final
+    syncManager->indexCutLinks();
     initBarrier.wait();
     if ( my_rank.thread == 0 ) sharedRegionManager->updateState(false);
 
@@ -425,6 +485,7 @@ void Simulation::initialize() {
 
         for ( auto iter = compInfoMap.begin(); iter != compInfoMap.end(); ++iter ) {
             // printf("Calling init on %s: %p\n",(*iter)->getName().c_str(),(*iter)->getComponent());
+            Core::MemAccounting::ComponentScope mem_scope((*iter)->getType());
             (*iter)->getComponent()->init(untimed_phase);
         }
 
@@ -443,14 +504,6 @@ void Simulation::initialize() {
     for ( auto &i : compInfoMap ) {
         i->finalizeLinkConfiguration();
     }
-#if 0
-    for ( auto i = compInfoMap.begin(); i != compInfoMap.end(); ++i) {
-        std::map<std::string,Link*>& map = (*i)->getLinkMap()->getLinkMap();
-        for ( std::map<std::string,Link*>::iterator j = map.begin(); j != map.end(); ++j ) {
-            (*j).second->finalizeConfiguration();
-        }
-    }
-#endif
     syncManager->finalizeLinkConfigurations();
 
 }
@@ -495,6 +548,7 @@ void Simulation::setup() {
     setupBarrier.wait();
 
     for ( auto iter = compInfoMap.begin(); iter != compInfoMap.end(); ++iter ) {
+        Core::MemAccounting::ComponentScope mem_scope((*iter)->getType());
         (*iter)->getComponent()->setup();
     }
 
@@ -535,6 +589,10 @@ void Simulation::run() {
     header += ", ";
     header += SST::to_string(my_rank.thread);
     header += ":  ";
+    if ( runtimeProfile ) runtimeProfile->startRun();
+    // Anything the core does not tag itself while running comes from
+    // the event and clock handlers
+    SST_MEM_ACCOUNTING_SCOPE(COMPONENTS);
     while( LIKELY( ! endSim ) ) {
         currentSimCycle = timeVortex->front()->getDeliveryTime();
         currentPriority = timeVortex->front()->getPriority();
@@ -562,6 +620,12 @@ void Simulation::run() {
             lastRecvdSignal = 0;
         }
     }
+    if ( runtimeProfile ) {
+        runtimeProfile->endRun();
+        runtimeProfile->mergeThread();
+    }
+    if ( linkTelemetry ) linkTelemetry->mergeThread();
+
     /* We shouldn't need to do this, but to be safe... */
     ThreadSync::disable();
 
@@ -723,6 +787,15 @@ TimeConverter* Simulation::registerClock(TimeConverter *tcFreq, Clock::HandlerBa
     if ( clockMap.find( mapKey ) == clockMap.end() ) {
         Clock* ce = new Clock( tcFreq, priority );
         clockMap[ mapKey ] = ce;
+        if ( runtimeProfile ) {
+            std::string name = (timeLord.getTimeBase() * tcFreq->getFactor()).toStringBestSI() +
+                ", priority " + std::to_string(priority);
+            ce->setProfileCounter(runtimeProfile->getCounter(Core::Profile::RuntimeProfile::CLOCK, name));
+            ce->addHandlerCounters(runtimeProfile->getClockHandlerCounters());
+        }
+        if ( linkTelemetry ) {
+            ce->addHandlerCounters(linkTelemetry->getClockHandlerCounters());
+        }
 
         ce->schedule();
     }
@@ -768,20 +841,31 @@ TimeConverter* Simulation::registerOneShot(const std::string& timeDelay, OneShot
 TimeConverter* Simulation::registerOneShot(const UnitAlgebra& timeDelay, OneShot::HandlerBase* handler, int priority)
 {
     TimeConverter* tcTimeDelay = timeLord.getTimeConverter(timeDelay);
-    clockMap_t::key_type mapKey = std::make_pair(tcTimeDelay->getFactor(), priority);
+
+    // Add the handler to the OneShots list of handlers, Also the
+    // registerHandler will schedule the oneShot to fire in the future
+    getOneShot(tcTimeDelay, priority)->registerHandler(handler);
+    return tcTimeDelay;
+}
+
+OneShot::Handle Simulation::registerCancelableOneShot(const UnitAlgebra& timeDelay, OneShot::HandlerBase* handler, int priority)
+{
+    OneShot* oneShot = getOneShot(timeLord.getTimeConverter(timeDelay), priority);
+    return OneShot::Handle(oneShot, oneShot->registerHandler(handler));
+}
+
+OneShot* Simulation::getOneShot(TimeConverter* tcTimeDelay, int priority)
+{
+    oneShotMap_t::key_type mapKey = std::make_pair(tcTimeDelay->getFactor(), priority);
 
     // Search the oneShot map for a oneShot with the associated timeDelay factor
-    if (oneShotMap.find( mapKey ) == oneShotMap.end()) {
+    auto it = oneShotMap.find( mapKey );
+    if ( it == oneShotMap.end() ) {
         // OneShot with the specific timeDelay not found,
         // create a new one and add it to the map of OneShots
-        OneShot* ose = new OneShot(tcTimeDelay, priority);
-        oneShotMap[ mapKey ] = ose;
+        it = oneShotMap.emplace(mapKey, new OneShot(tcTimeDelay, priority)).first;
     }
-
-    // Add the handler to the OneShots list of handlers, Also the
-    // registerHandler will schedule the oneShot to fire in the future
-    oneShotMap[ mapKey ]->registerHandler(handler);
-    return tcTimeDelay;
+    return it->second;
 }
 
 void Simulation::insertActivity(SimTime_t time, Activity* ev) {
@@ -51,6 +51,7 @@ class SimulatorHeartbeat;
 //class Graph;
 class LinkMap;
 class Params;
+class PortTable;
 class SyncBase;
 class SyncManager;
 class ThreadSync;
@@ -63,6 +64,12 @@ namespace Statistics {
     class StatisticOutput;
     class StatisticProcessingEngine;
 }
+namespace Core {
+namespace Profile {
+    class RuntimeProfile;
+    class LinkTelemetry;
+}
+}
 
 
 
@@ -165,6 +172,14 @@ public:
     /** Return the exit event */
     Exit* getExit() const { return m_exit; }
 
+    /** Return this thread's runtime profile, or nullptr if profiling
+     * is not enabled */
+    Core::Profile::RuntimeProfile* getRuntimeProfile() const { return runtimeProfile; }
+
+    /** Return this thread's link telemetry, or nullptr if partition
+     * weights are not being written */
+    Core::Profile::LinkTelemetry* getLinkTelemetry() const { return linkTelemetry; }
+
 
     /** Signifies that an event type is required for this simulation
      *  Causes the Factory to verify that the required event type can be found.
@@ -246,7 +261,7 @@ public:
 
     /** Register a OneShot event to be called after a time delay
         Note: OneShot cannot be canceled, and will always callback after
-              the timedelay.
+              the timedelay.  See registerCancelableOneShot().
     */
 #if !SST_BUILDING_CORE
     TimeConverter* registerOneShot(const std::string& timeDelay, OneShot::HandlerBase* handler, int priority) __attribute__ ((deprecated("this function was not intended to be used outside of SST core and will be removed in SST 11.")));
@@ -260,6 +275,11 @@ public:
     TimeConverter* registerOneShot(const UnitAlgebra& timeDelay, OneShot::HandlerBase* handler, int priority);
 #endif
 
+    /** Register a OneShot event to be called after a time delay
+        @return handle whose cancel() stops the call
+    */
+    OneShot::Handle registerCancelableOneShot(const UnitAlgebra& timeDelay, OneShot::HandlerBase* handler, int priority);
+
 #if !SST_BUILDING_CORE
     const std::vector<SimTime_t>& getInterThreadLatencies() const __attribute__ ((deprecated("this function was not intended to be used outside of SST core and will be removed in SST 11."))) { return interThreadLatencies; }
 #else
@@ -292,6 +312,10 @@ public:
         }
     }
 
+    /** Returns the port name table shared by all components of the
+     * given type on this thread, creating it if needed */
+    PortTable* getPortTable(const std::string& type);
+
     /** Returns reference to the Component Info Map */
 #if !SST_BUILDING_CORE
     const ComponentInfoMap& getComponentInfoMap(void) __attribute__ ((deprecated("this function was not intended to be used outside of SST core and will be removed in SST 11."))) { return compInfoMap; }
@@ -511,6 +535,9 @@ private:
     void endSimulation(void) { endSimulation(currentSimCycle); }
     void endSimulation(SimTime_t end);
 
+    /** Find or create the OneShot for a delay and priority */
+    OneShot* getOneShot(TimeConverter* tcTimeDelay, int priority);
+
     typedef enum {
         SHUTDOWN_CLEAN,     /* Normal shutdown */
         SHUTDOWN_SIGNAL,    /* SIGINT or SIGTERM received */
@@ -520,6 +547,7 @@ private:
     friend class SyncManager;
 
     Mode_t   runMode;
+    std::string      rankSyncType;
     TimeVortex*      timeVortex;
     TimeConverter*   threadMinPartTC;
     Activity*        current_activity;
@@ -530,6 +558,7 @@ private:
     SyncManager*     syncManager;
     ThreadSync*      threadSync;
     ComponentInfoMap compInfoMap;
+    std::unordered_map<std::string, PortTable*> portTables;
     clockMap_t       clockMap;
     oneShotMap_t     oneShotMap;
     SimTime_t        currentSimCycle;
@@ -548,6 +577,8 @@ private:
     std::string      output_directory;
     static SharedRegionManager* sharedRegionManager;
     bool             wireUpFinished;
+    Core::Profile::RuntimeProfile* runtimeProfile;
+    Core::Profile::LinkTelemetry* linkTelemetry;
 
     static std::unordered_map<std::thread::id, Simulation*> instanceMap;
     static std::vector<Simulation*> instanceVec;
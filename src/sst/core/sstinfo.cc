@@ -179,6 +179,15 @@ static void processSSTElementFiles()
         addELI(loader, l, g_configuration.processAllElements());
     }
 
+    // If asked, refresh the library indexes that let sst find its
+    // libraries without scanning the search path
+    if ( g_configuration.doWriteIndex() ) {
+        std::stringstream err_sstr;
+        if ( !loader.writeIndexes(err_sstr) ) {
+            std::cerr << err_sstr.str();
+        }
+    }
+
 
     // Do we output in Human Readable form
     if (g_configuration.getOptionBits() & CFG_OUTPUTHUMAN) {
@@ -303,6 +312,7 @@ void SSTInfoConfig::outputUsage()
     cout << "  -o, --outputxml=FILE     File path to XML file. Default is SSTInfo.xml\n";
     cout << "  -l, --libs=LIBS          {all, <elementname>} - Element Library(s) to process\n";
     cout << "  -q, --quiet              Quiet/print summary only\n";
+    cout << "  -i, --write-index        Write an index of the element libraries into each library directory\n";
     cout << endl;
 }
 
@@ -322,6 +332,7 @@ int SSTInfoConfig::parseCmdLine(int argc, char* argv[])
         {"nodisplay",   no_argument,        nullptr, 'n'},
         {"xml",         no_argument,        nullptr, 'x'},
         {"quiet",       no_argument,        nullptr, 'q'},
+        {"write-index", no_argument,        nullptr, 'i'},
         {"outputxml",   required_argument,  nullptr, 'o'},
         {"libs",        required_argument,  nullptr, 'l'},
         {"elemenfilt",  required_argument,  nullptr, 0},
@@ -329,7 +340,7 @@ int SSTInfoConfig::parseCmdLine(int argc, char* argv[])
     };
     while (1) {
         int opt_idx = 0;
-        const int intC = getopt_long(argc, argv, "hvqdnxo:l:", longOpts, &opt_idx);
+        const int intC = getopt_long(argc, argv, "hvqdnxio:l:", longOpts, &opt_idx);
         if ( intC == -1 )
             break;
 
@@ -354,6 +365,9 @@ int SSTInfoConfig::parseCmdLine(int argc, char* argv[])
         case 'x':
             m_optionBits |= CFG_OUTPUTXML;
             break;
+        case 'i':
+            m_optionBits |= CFG_WRITEINDEX;
+            break;
         case 'o':
             m_XMLFilePath = optarg;
             break;
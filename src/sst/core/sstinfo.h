@@ -28,6 +28,7 @@ namespace SST {
 #define CFG_OUTPUTHUMAN 0x00000001
 #define CFG_OUTPUTXML   0x00000002
 #define CFG_VERBOSE     0x00000004
+#define CFG_WRITEINDEX  0x00000008
 
 /**
  * The SSTInfo Configuration class.
@@ -70,6 +71,7 @@ public:
     bool                      debugEnabled() const { return m_debugEnabled; }
     bool                      processAllElements() const { return m_filters.empty(); }
     bool                      doVerbose() const { return m_optionBits & CFG_VERBOSE; }
+    bool                      doWriteIndex() const { return m_optionBits & CFG_WRITEINDEX; }
 
 private:
     void outputUsage();
@@ -23,6 +23,7 @@
 #include <unistd.h>
 #include <sys/stat.h>
 #include <sys/types.h>
+#include <sys/wait.h>
 
 #include "sst/core/env/envconfig.h"
 #include "sst/core/env/envquery.h"
@@ -30,6 +31,7 @@
 //Function declarations
 static void print_usage();
 void sstRegister(char* argv[]);
+void sstIndex();
 void sstUnregister(const std::string& element);
 std::vector<std::string> listModels(int option);
 void sstUnregisterMultiple(std::vector<std::string> elementsArray);
@@ -139,6 +141,24 @@ void sstRegister(char* argv[]){
     database->writeTo(cfgFile);
 
     fclose(cfgFile);
+
+    if(key.size() > 6 && key.substr(key.size() - 6) == "LIBDIR") {
+        sstIndex();
+    }
+}
+
+//sstIndex
+//Runs sst-info over all of the registered libraries, which writes an
+//index of the element libraries into each library directory so that
+//sst does not have to search for them
+void sstIndex(){
+    pid_t pid = fork();
+    if(0 == pid) {
+        execl(SST_INSTALL_PREFIX "/bin/sst-info", "sst-info", "-n", "-q", "-i", (char*) nullptr);
+        _exit(-1);
+    } else if(pid > 0) {
+        waitpid(pid, nullptr, 0);
+    }
 }
 
 //sstUnregister
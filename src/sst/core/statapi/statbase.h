@@ -16,6 +16,7 @@
 
 #include "sst/core/sst_types.h"
 #include "sst/core/warnmacros.h"
+#include "sst/core/memuse.h"
 #include "sst/core/params.h"
 #include "sst/core/oneshot.h"
 #include "sst/core/statapi/statfieldinfo.h"
@@ -373,6 +374,7 @@ class Statistic : public StatisticBase, public StatisticCollector<T>
         // Call the Derived Statistic's implementation
         //  of addData and increment the count
         if (isEnabled()) {
+            SST_MEM_ACCOUNTING_SCOPE(STATISTICS);
             addData_impl(std::forward<InArgs>(args)...);
             incrementCollectionCount(1);
         }
@@ -384,6 +386,7 @@ class Statistic : public StatisticBase, public StatisticCollector<T>
         // Call the Derived Statistic's implementation
         //  of addData and increment the count
         if (isEnabled()) {
+            SST_MEM_ACCOUNTING_SCOPE(STATISTICS);
             addData_impl_Ntimes(N, std::forward<InArgs>(args)...);
             incrementCollectionCount(N);
         }
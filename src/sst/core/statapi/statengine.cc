@@ -15,6 +15,7 @@
 #include "sst/core/warnmacros.h"
 #include "sst/core/output.h"
 #include "sst/core/factory.h"
+#include "sst/core/memuse.h"
 #include "sst/core/timeLord.h"
 #include "sst/core/timeConverter.h"
 #include "sst/core/simulation.h"
@@ -452,6 +453,7 @@ void StatisticProcessingEngine::performStatisticOutput(StatisticBase* stat, bool
 
 void StatisticProcessingEngine::performStatisticOutputImpl(StatisticBase* stat, bool endOfSimFlag /*=false*/)
 {
+    SST_MEM_ACCOUNTING_SCOPE(STATISTICS);
 
     StatisticOutput* statOutput = getOutputForStatistic(stat);
 
@@ -481,6 +483,7 @@ void StatisticProcessingEngine::performStatisticOutputImpl(StatisticBase* stat,
 
 void StatisticProcessingEngine::performStatisticGroupOutputImpl(StatisticGroup &group, bool endOfSimFlag /*=false*/)
 {
+    SST_MEM_ACCOUNTING_SCOPE(STATISTICS);
 
     StatisticOutput* statOutput = group.output;
 
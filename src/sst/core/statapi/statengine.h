@@ -81,6 +81,7 @@ public:
 
     bool registerStatisticWithEngine(StatisticBase* stat, fieldType_t fieldType, uint8_t comp_stat_level)
     {
+        std::lock_guard<std::mutex> lock(m_registerLock);
         bool ok;
         if ((ok = registerStatisticCore(stat,comp_stat_level))) {
             addStatisticToCompStatMap(stat, fieldType);
@@ -92,6 +93,7 @@ public:
                                                    const std::string& statName, const std::string& statSubId,
                                                    fieldType_t fieldId)
     {
+      std::lock_guard<std::mutex> lock(m_registerLock);
       return isStatisticInCompStatMap(compName, compId, statName, statSubId, fieldId);
     }
 
@@ -157,6 +159,7 @@ private:
     StatisticGroup                            m_defaultGroup;
     std::vector<StatisticGroup>               m_statGroups;
     Core::ThreadSafe::Barrier                 m_barrier;
+    std::mutex                                m_registerLock;         /*!< Components on several threads may register statistics at once */
 
 };
 
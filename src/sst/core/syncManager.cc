@@ -15,6 +15,7 @@
 #include "sst/core/warnmacros.h"
 
 #include "sst/core/exit.h"
+#include "sst/core/memuse.h"
 #include "sst/core/simulation.h"
 #include "sst/core/syncBase.h"
 #include "sst/core/threadSyncQueue.h"
@@ -22,7 +23,8 @@
 
 #include "sst/core/rankSyncSerialSkip.h"
 #include "sst/core/rankSyncParallelSkip.h"
-#include "sst/core/rankSyncParallelSkip.h"
+#include "sst/core/rankSyncSegmentedSkip.h"
+#include "sst/core/runtimeProfile.h"
 #include "sst/core/threadSyncSimpleSkip.h"
 
 #ifdef SST_CONFIG_HAVE_MPI
@@ -34,14 +36,53 @@ REENABLE_WARNING
 #define UNUSED_WO_MPI(x) UNUSED(x)
 #endif
 
+#include <algorithm>
+
 namespace SST {
 
 // Static data members
 NewRankSync* SyncManager::rankSync = nullptr;
-Core::ThreadSafe::Barrier SyncManager::RankExecBarrier[6];
+Core::ThreadSafe::Barrier SyncManager::RankExecBarrier[5];
 Core::ThreadSafe::Barrier SyncManager::LinkUntimedBarrier[3];
 SimTime_t SyncManager::next_rankSync = MAX_SIMTIME_T;
 
+void
+NewRankSync::indexCutLinks()
+{
+    for ( auto& peer : cut_links ) {
+        cut_link_vec_t& links = peer.second;
+        // Both ranks see the same set of links between them, so ordering
+        // by global id gives both sides the same index for each link
+        std::sort(links.begin(), links.end(),
+                  [](const Link* a, const Link* b) { return a->id < b->id; });
+        for ( size_t i = 0; i < links.size(); i++ ) {
+            // Events are stamped with the id of the sending link, which
+            // is the component side of the pair
+            links[i]->pair_link->id = static_cast<LinkId_t>(i);
+        }
+    }
+}
+
+SimTime_t
+NewRankSync::reduceNextActivityTime(SimTime_t UNUSED_WO_MPI(local_next))
+{
+#ifdef SST_CONFIG_HAVE_MPI
+    Exit* exit = Simulation::getSimulation()->getExit();
+
+    // All three reduce with MAX: the time is inverted to get its minimum
+    uint64_t input[3], output[3];
+    input[0] = MAX_SIMTIME_T - local_next;
+    input[1] = exit->getRefCount() > 0 ? 1 : 0;
+    input[2] = exit->getEndTime();
+    MPI_Allreduce( input, output, 3, MPI_UINT64_T, MPI_MAX, MPI_COMM_WORLD );
+
+    exit->setGlobalState(output[1], output[2]);
+    return MAX_SIMTIME_T - output[0];
+#else
+    return local_next;
+#endif
+}
+
 class EmptyRankSync : public NewRankSync {
 public:
     EmptyRankSync() {
@@ -102,21 +143,44 @@ public:
 };
 
 
-SyncManager::SyncManager(const RankInfo& rank, const RankInfo& num_ranks, TimeConverter* minPartTC, SimTime_t min_part, const std::vector<SimTime_t>& UNUSED(interThreadLatencies)) :
+SyncManager::SyncManager(const RankInfo& rank, const RankInfo& num_ranks, TimeConverter* minPartTC, SimTime_t min_part, const std::vector<SimTime_t>& UNUSED(interThreadLatencies),
+                         const std::string& rankSyncType) :
     Action(),
     rank(rank),
     num_ranks(num_ranks),
     threadSync(nullptr),
-    min_part(min_part)
+    min_part(min_part),
+    profileSync(nullptr),
+    profileBarrier(nullptr),
+    profileRankSync(nullptr),
+    profileThreadSync(nullptr)
 {
     sim = Simulation::getSimulation();
 
+    Core::Profile::RuntimeProfile* profile = sim->getRuntimeProfile();
+    if ( nullptr != profile ) {
+        typedef Core::Profile::RuntimeProfile RP;
+        profileSync = profile->getCounter(RP::SYNC, "sync manager");
+        profileBarrier = profile->getCounter(RP::SYNC, "barrier wait");
+        profileRankSync = profile->getCounter(RP::SYNC, "rank sync");
+        profileThreadSync = profile->getCounter(RP::SYNC, "thread sync");
+    }
+
 
     if ( rank.thread == 0  ) {
         for ( auto &b : RankExecBarrier ) { b.resize(num_ranks.thread); }
         for ( auto &b : LinkUntimedBarrier ) { b.resize(num_ranks.thread); }
         if ( min_part != MAX_SIMTIME_T ) {
-            if ( num_ranks.thread == 1 ) {
+            // The serial sync only works with one thread per rank
+            if ( rankSyncType == "serial" && num_ranks.thread > 1 ) {
+                Simulation::getSimulationOutput().fatal(CALL_INFO, 1,
+                    "--rank-sync=serial can only be used with one thread per rank (running %" PRIu32 " threads)\n",
+                    num_ranks.thread);
+            }
+            if ( rankSyncType == "segmented" ) {
+                rankSync = new RankSyncSegmentedSkip(num_ranks, minPartTC);
+            }
+            else if ( num_ranks.thread == 1 && rankSyncType != "parallel" ) {
                 rankSync = new RankSyncSerialSkip(/*num_ranks,*/ minPartTC);
             }
             else {
@@ -173,15 +237,24 @@ SyncManager::registerLink(const RankInfo& to_rank, const RankInfo& from_rank, Li
     }
 }
 
+void
+SyncManager::waitExecBarrier(int index)
+{
+    Core::Profile::Scope wait(profileBarrier);
+    RankExecBarrier[index].wait();
+}
+
 void
 SyncManager::execute(void)
 {
+    Core::Profile::Scope sync(profileSync);
+    SST_MEM_ACCOUNTING_SCOPE(LINKS);
     switch ( next_sync_type ) {
     case RANK:
         // Need to make sure all threads have reached the sync to
         // guarantee that all events have been sent to the appropriate
         // queues.
-        RankExecBarrier[0].wait();
+        waitExecBarrier(0);
 
         // For a rank sync, we will force a thread sync first.  This
         // will ensure that all events sent between threads will be
@@ -192,30 +265,32 @@ SyncManager::execute(void)
 
         // Need to make sure everyone has made it through the mutex
         // and the min time computation is complete
-        RankExecBarrier[1].wait();
+        waitExecBarrier(1);
 
         // Now call the actual RankSync
-        rankSync->execute(rank.thread);
+        {
+            Core::Profile::Scope rs(profileRankSync);
+            rankSync->execute(rank.thread);
+        }
 
-        RankExecBarrier[2].wait();
+        waitExecBarrier(2);
 
         // Now call the threadSync after() call
         threadSync->after();
 
-        RankExecBarrier[3].wait();
-
-        if ( exit != nullptr && rank.thread == 0 ) exit->check();
-
-        RankExecBarrier[4].wait();
+        waitExecBarrier(3);
 
+        // The rank sync brought the Exit state up to date
         if ( exit->getGlobalCount() == 0 ) {
             endSimulation(exit->getEndTime());
         }
 
         break;
     case THREAD:
-
-        threadSync->execute();
+        {
+            Core::Profile::Scope ts(profileThreadSync);
+            threadSync->execute();
+        }
 
         if ( /*num_ranks.rank == 1*/ min_part == MAX_SIMTIME_T ) {
             if ( exit->getRefCount() == 0 ) {
@@ -228,7 +303,7 @@ SyncManager::execute(void)
         break;
     }
     computeNextInsert();
-    RankExecBarrier[5].wait();
+    waitExecBarrier(4);
 }
 
 /** Cause an exchange of Untimed Data to occur */
@@ -256,6 +331,13 @@ SyncManager::finalizeLinkConfigurations()
     computeNextInsert();
 }
 
+void
+SyncManager::indexCutLinks()
+{
+    // rankSync is shared by all the threads
+    if ( rank.thread == 0 ) rankSync->indexCutLinks();
+}
+
 /** Prepare for complete() phase */
 void
 SyncManager::prepareForComplete()
@@ -19,6 +19,7 @@
 #include "sst/core/rankInfo.h"
 #include "sst/core/threadsafe.h"
 
+#include <map>
 #include <vector>
 #include <unordered_map>
 
@@ -29,6 +30,11 @@ class Simulation;
 class SyncBase;
 class ThreadSyncQueue;
 class TimeConverter;
+namespace Core {
+namespace Profile {
+    struct Counter;
+}
+}
 
 class NewRankSync {
 public:
@@ -50,10 +56,46 @@ public:
 
     virtual uint64_t getDataSize() const = 0;
 
+    /** Replace the global ids carried by events on the links to each
+     * remote rank with a dense index into that rank's cut links.  Must
+     * be called once, after all threads are wired up and before any
+     * event is sent. */
+    void indexCutLinks();
+
 protected:
     SimTime_t nextSyncTime;
     TimeConverter* max_period;
 
+    /**
+     * Global minimum of the ranks' next activity times.  The Exit
+     * state (whether any rank still has primary components, and when
+     * the last one unregistered) is reduced in the same collective, so
+     * ending the simulation needs no collectives of its own.  Called by
+     * one thread per rank at each sync.
+     */
+    SimTime_t reduceNextActivityTime(SimTime_t local_next);
+
+    typedef std::vector<Link*> cut_link_vec_t;
+
+    /** Sync side of the links to each remote rank.  After
+     * indexCutLinks(), the position of a link in its vector is the id
+     * carried by the events that arrive for it. */
+    std::map<uint32_t, cut_link_vec_t> cut_links;
+
+    /** Record a link to remote_rank; returns the vector to look the
+     * link up in when its events arrive */
+    cut_link_vec_t* addCutLink(uint32_t remote_rank, Link* link) {
+        cut_link_vec_t& links = cut_links[remote_rank];
+        links.push_back(link);
+        return &links;
+    }
+
+    /** Find the link for an incoming event, nullptr if there is none */
+    static Link* findCutLink(const cut_link_vec_t& links, LinkId_t index) {
+        if ( UNLIKELY(static_cast<uint32_t>(index) >= links.size()) ) return nullptr;
+        return links[index];
+    }
+
     void finalizeConfiguration(Link* link) {
         link->finalizeConfiguration();
     }
@@ -112,7 +154,8 @@ private:
 
 class SyncManager : public Action {
 public:
-    SyncManager(const RankInfo& rank, const RankInfo& num_ranks, TimeConverter* minPartTC, SimTime_t min_part, const std::vector<SimTime_t>& interThreadLatencies);
+    SyncManager(const RankInfo& rank, const RankInfo& num_ranks, TimeConverter* minPartTC, SimTime_t min_part, const std::vector<SimTime_t>& interThreadLatencies,
+                const std::string& rankSyncType);
     virtual ~SyncManager();
 
     /** Register a Link which this Sync Object is responsible for */
@@ -124,6 +167,8 @@ public:
     /** Finish link configuration */
     void finalizeLinkConfigurations();
     void prepareForComplete();
+    /** Switch the links to other ranks over to dense ids */
+    void indexCutLinks();
 
     void print(const std::string& header, Output &out) const override;
 
@@ -134,7 +179,7 @@ private:
 
     RankInfo rank;
     RankInfo num_ranks;
-    static Core::ThreadSafe::Barrier RankExecBarrier[6];
+    static Core::ThreadSafe::Barrier RankExecBarrier[5];
     static Core::ThreadSafe::Barrier LinkUntimedBarrier[3];
     // static SimTime_t min_next_time;
     // static int min_count;
@@ -148,7 +193,14 @@ private:
     sync_type_t      next_sync_type;
     SimTime_t min_part;
 
+    /* Runtime profile counters; nullptr unless profiling is enabled */
+    Core::Profile::Counter* profileSync;
+    Core::Profile::Counter* profileBarrier;
+    Core::Profile::Counter* profileRankSync;
+    Core::Profile::Counter* profileThreadSync;
+
     void computeNextInsert();
+    void waitExecBarrier(int index);
 
 };
 
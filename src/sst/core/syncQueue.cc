@@ -14,15 +14,29 @@
 #include "sst/core/syncQueue.h"
 
 #include "sst/core/serialization/serializer.h"
+#include "sst/core/serialization/serialize_serializable.h"
 #include "sst/core/event.h"
+#include "sst/core/link.h"
+#include "sst/core/linkTelemetry.h"
 #include "sst/core/simulation.h"
 
+#include <algorithm>
+
 
 namespace SST {
 
 using namespace Core::ThreadSafe;
 using namespace Core::Serialization;
 
+std::atomic<uint64_t> SyncQueue::wire_events(0);
+std::atomic<uint64_t> SyncQueue::wire_bytes(0);
+std::atomic<uint64_t> SyncQueue::wire_generic_bytes(0);
+
+// What the generic serialization writes for each event before its own
+// data: class id, queue order, delivery time, priority and link id
+static const size_t generic_event_header =
+    sizeof(long) + sizeof(uint64_t) + sizeof(SimTime_t) + sizeof(int) + sizeof(LinkId_t);
+
 SyncQueue::SyncQueue() :
     ActivityQueue(), buffer(nullptr), buf_size(0)
 {
@@ -85,10 +99,27 @@ SyncQueue::getData()
     std::lock_guard<Spinlock> lock(slock);
 
     serializer ser;
+    std::vector<uint32_t> classes;
+    ser.set_class_table(&classes);
+
+    // Delivery times are sent relative to the earliest one in the batch
+    SimTime_t base = activities.empty() ? 0 : MAX_SIMTIME_T;
+    for ( Activity* act : activities ) base = std::min(base, act->getDeliveryTime());
+    uint64_t count = activities.size();
 
     ser.start_sizing();
 
-    ser & activities;
+    ser & base;
+    ser.varint(count);
+    size_t header_bytes = ser.size();
+    for ( Activity* act : activities ) {
+        Event* ev = static_cast<Event*>(act);
+        const size_t start = ser.size();
+        header_bytes += serializeEvent(ser, ev, base);
+        // The sizing pass gives the link telemetry its byte counts
+        Core::Profile::LinkCounter* counter = getLinkCounter(ev);
+        if ( UNLIKELY(nullptr != counter) ) Core::Profile::LinkTelemetry::recordBytes(counter, ser.size() - start);
+    }
 
     size_t size = ser.size();
 
@@ -101,9 +132,15 @@ SyncQueue::getData()
         buffer = new char[buf_size];
     }
 
+    classes.clear();
     ser.start_packing(buffer + sizeof(SyncQueue::Header), size);
 
-    ser & activities;
+    ser & base;
+    ser.varint(count);
+    for ( Activity* act : activities ) {
+        Event* ev = static_cast<Event*>(act);
+        serializeEvent(ser, ev, base);
+    }
 
     // Delete all the events
     for ( unsigned int i = 0; i < activities.size(); i++ ) {
@@ -114,7 +151,106 @@ SyncQueue::getData()
     // Set the size field in the header
     static_cast<SyncQueue::Header*>(static_cast<void*>(buffer))->buffer_size = size + sizeof(SyncQueue::Header);
 
+    wire_events += count;
+    wire_bytes += size + sizeof(SyncQueue::Header);
+    // The generic format writes a vector length and then the full
+    // header of each event
+    wire_generic_bytes += sizeof(SyncQueue::Header) + sizeof(size_t) + (size - header_bytes) +
+        count * generic_event_header;
+
     return buffer;
 }
 
+void
+SyncQueue::unpackActivities(char* data, size_t size, std::vector<Activity*>& activities)
+{
+    serializer ser;
+    std::vector<uint32_t> classes;
+    ser.set_class_table(&classes);
+    ser.start_unpacking(data, size);
+
+    SimTime_t base;
+    uint64_t count;
+    ser & base;
+    ser.varint(count);
+
+    activities.reserve(activities.size() + count);
+    for ( uint64_t i = 0; i < count; i++ ) {
+        Event* ev = nullptr;
+        serializeEvent(ser, ev, base);
+        activities.push_back(ev);
+    }
+}
+
+// Handles one event for every serializer mode; returns the bytes used
+// for everything but the event's own data
+size_t
+SyncQueue::serializeEvent(serializer& ser, Event*& ev, SimTime_t base)
+{
+    const size_t start = ser.size();
+
+    serializable* obj = ev;
+    pvt::serialize_class_tag(obj, ser);
+    if ( nullptr == obj ) {
+        Simulation::getSimulationOutput().fatal(CALL_INFO, 1, "Null event in sync data\n");
+    }
+    ev = static_cast<Event*>(obj);
+    Activity* act = ev;
+
+    uint64_t delta = 0;
+    uint64_t link = 0;
+    uint64_t prio = 0;
+    if ( ser.mode() != serializer::UNPACK ) {
+        delta = act->delivery_time - base;
+        link = static_cast<uint32_t>(ev->getLinkId());
+        // zigzag, so small negative priorities stay small
+        prio = (static_cast<uint64_t>(act->priority) << 1) ^ static_cast<uint64_t>(act->priority >> 31);
+    }
+    ser.varint(delta);
+    ser.varint(link);
+    ser.varint(prio);
+    if ( ser.mode() == serializer::UNPACK ) {
+        act->delivery_time = base + delta;
+        ev->setDeliveryLink(static_cast<LinkId_t>(link), nullptr);
+        act->priority = static_cast<int>((prio >> 1) ^ (~(prio & 1) + 1));
+    }
+
+    const size_t header = ser.size() - start;
+
+    size_t data_size = 0;
+    void* data = nullptr;
+#ifndef __SST_DEBUG_EVENT_TRACKING__
+    // The tracking strings are only written by serialize_order()
+    data = ev->getTrivialSyncData(data_size);
+#endif
+    if ( nullptr != data ) {
+        ser.raw(data, data_size);
+    }
+    else {
+        ser.skip_event_header();
+        ev->serialize_order(ser);
+        // In case the class did not call Event::serialize_order()
+        ser.take_skip_event_header();
+    }
+    return header;
+}
+
+// Events are queued here by the sync side of a cut link; the paired
+// link is the one the component sent on and holds the traffic counter
+Core::Profile::LinkCounter*
+SyncQueue::getLinkCounter(Event* ev)
+{
+    Link* link = ev->getDeliveryLink();
+    if ( nullptr == link || nullptr == link->pair_link ) return nullptr;
+    return link->pair_link->telemetry;
+}
+
+void
+SyncQueue::getWireStats(uint64_t& events, uint64_t& bytes, uint64_t& generic_bytes)
+{
+    events = wire_events;
+    bytes = wire_bytes;
+    generic_bytes = wire_generic_bytes;
+}
+
 } // namespace SST
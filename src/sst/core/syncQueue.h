@@ -12,6 +12,7 @@
 #ifndef SST_CORE_SYNCQUEUE_H
 #define SST_CORE_SYNCQUEUE_H
 
+#include <atomic>
 #include <vector>
 
 #include "sst/core/activityQueue.h"
@@ -19,12 +20,39 @@
 
 namespace SST {
 
+class Event;
+
+namespace Core {
+namespace Serialization {
+class serializer;
+}
+namespace Profile {
+struct LinkCounter;
+}
+}
+
 /**
  * \class SyncQueue
  *
  * Internal API
  *
  * Activity Queue for use by Sync Objects
+ *
+ * getData() packs the queued events in a compact wire format behind the
+ * Header:
+ *
+ *   uint64_t base time | varint count | event 0 | event 1 | ...
+ *
+ * and each event is
+ *
+ *   class tag | varint (delivery time - base) | varint link index |
+ *   varint priority (zigzag) | data
+ *
+ * The class tag is an index into a class table built up as the message
+ * is written, so a class id is only sent the first time the class
+ * appears in a message.  The data is the block returned by
+ * Event::getTrivialSyncData() if the class provides one, and otherwise
+ * whatever serialize_order() writes after the Event fields.
  */
 class SyncQueue : public ActivityQueue {
 public:
@@ -50,11 +78,27 @@ public:
     /** Accessor method to the internal queue */
     char* getData();
 
+    /** Unpack the events from the data returned by getData(), less the
+     * Header, and append them to activities */
+    static void unpackActivities(char* data, size_t size, std::vector<Activity*>& activities);
+
+    /** Totals for the messages packed by all SyncQueues on this rank:
+     * events, bytes sent and the approximate bytes the generic
+     * serialization of the same events would have taken */
+    static void getWireStats(uint64_t& events, uint64_t& bytes, uint64_t& generic_bytes);
+
     uint64_t getDataSize() {
         return buf_size + (activities.capacity() * sizeof(Activity*));
     }
 
 private:
+    static size_t serializeEvent(Core::Serialization::serializer& ser, Event*& ev, SimTime_t base);
+    static Core::Profile::LinkCounter* getLinkCounter(Event* ev);
+
+    static std::atomic<uint64_t> wire_events;
+    static std::atomic<uint64_t> wire_bytes;
+    static std::atomic<uint64_t> wire_generic_bytes;
+
     char* buffer;
     size_t buf_size;
     std::vector<Activity*> activities;
@@ -0,0 +1,151 @@
+// Copyright 2009-2020 NTESS. Under the terms
+// of Contract DE-NA0003525 with NTESS, the U.S.
+// Government retains certain rights in this software.
+//
+// Copyright (c) 2009-2020, NTESS
+// All rights reserved.
+//
+// Portions are copyright of other developers:
+// See the file CONTRIBUTORS.TXT in the top level directory
+// the distribution for more information.
+//
+// This file is part of the SST software package. For license
+// information, see the LICENSE file in the top level directory of the
+// distribution.
+
+#include "sst_config.h"
+
+#include "sst/core/testElements/coreTest_CircularBufferComponent.h"
+#include "sst/core/interprocess/circularBuffer.h"
+
+#include <cstdlib>
+#include <new>
+#include <thread>
+#include <vector>
+
+using namespace SST::Core::Interprocess;
+
+namespace SST {
+namespace CoreTestCircularBufferComponent {
+
+typedef CircularBuffer<uint64_t> Buffer_t;
+
+// The ring's storage follows the object, as in the IPCTunnel's region
+static Buffer_t* createBuffer(size_t size)
+{
+    void* mem = calloc(1, sizeof(Buffer_t) + size * sizeof(uint64_t));
+    Buffer_t* buffer = new (mem) Buffer_t();
+    buffer->setBufferSize(size);
+    return buffer;
+}
+
+static void destroyBuffer(Buffer_t* buffer)
+{
+    buffer->~Buffer_t();
+    free(buffer);
+}
+
+coreTestCircularBufferComponent::coreTestCircularBufferComponent(ComponentId_t id, Params& params) :
+  Component(id)
+{
+    count = params.find<uint64_t>("count", 100000);
+}
+
+coreTestCircularBufferComponent::coreTestCircularBufferComponent() :
+    Component(-1)
+{
+
+}
+
+void coreTestCircularBufferComponent::report(const char* what, bool ok)
+{
+    printf("%s %s: %s\n", getName().c_str(), what, ok ? "ok" : "WRONG");
+}
+
+void coreTestCircularBufferComponent::setup()
+{
+    uint64_t values[16];
+
+    // Batches of 1 to 7 through an 8 slot ring, read back 3 at a time,
+    // so both sides wrap around at every offset
+    {
+        Buffer_t* buffer = createBuffer(8);
+        uint64_t next_write = 0;
+        uint64_t next_read = 0;
+        bool ok = true;
+        for ( int round = 0; round < 50; round++ ) {
+            size_t n = 1 + round % 7;
+            for ( size_t i = 0; i < n; i++ ) values[i] = next_write++;
+            buffer->writeMany(values, n);
+
+            size_t got;
+            while ( (got = buffer->readMany(values, 3)) > 0 ) {
+                if ( got > 3 ) ok = false;
+                for ( size_t i = 0; i < got; i++ ) {
+                    if ( values[i] != next_read++ ) ok = false;
+                }
+            }
+        }
+        report("wraparound", ok && next_read == next_write);
+        destroyBuffer(buffer);
+    }
+
+    // One slot is kept free, so an 8 slot ring holds 7 messages
+    {
+        Buffer_t* buffer = createBuffer(8);
+        bool ok = true;
+        for ( int round = 0; round < 3; round++ ) {
+            for ( size_t i = 0; i < 7; i++ ) values[i] = round * 7 + i;
+            buffer->writeMany(values, 7);
+            if ( buffer->readMany(values, 16) != 7 ) ok = false;
+            for ( size_t i = 0; i < 7; i++ ) {
+                if ( values[i] != round * 7 + i ) ok = false;
+            }
+            uint64_t extra;
+            if ( buffer->readNB(&extra) ) ok = false;
+        }
+        report("full ring", ok);
+        destroyBuffer(buffer);
+    }
+
+    // A producer thread writing batches larger than the ring, and a
+    // consumer mixing bulk and single reads.  Both sides block, so the
+    // waits fall back to the futex once spinning gives up.
+    {
+        Buffer_t* buffer = createBuffer(64);
+        buffer->setBlockingWait(true);
+        uint64_t total = count;
+
+        std::thread producer([buffer, total]() {
+            std::vector<uint64_t> batch(100);
+            uint64_t next = 0;
+            while ( next < total ) {
+                size_t n = (total - next < batch.size()) ? total - next : batch.size();
+                for ( size_t i = 0; i < n; i++ ) batch[i] = next++;
+                buffer->writeMany(batch.data(), n);
+            }
+        });
+
+        bool ok = true;
+        uint64_t next = 0;
+        while ( next < total ) {
+            // readMany() doesn't wait, so block in read() when it's empty
+            size_t got = buffer->readMany(values, 16);
+            if ( got == 0 ) {
+                values[0] = buffer->read();
+                got = 1;
+            }
+            for ( size_t i = 0; i < got; i++ ) {
+                if ( values[i] != next++ ) ok = false;
+            }
+        }
+        producer.join();
+
+        uint64_t extra;
+        report("threads", ok && !buffer->readNB(&extra));
+        destroyBuffer(buffer);
+    }
+}
+
+} // namespace CoreTestCircularBufferComponent
+} // namespace SST
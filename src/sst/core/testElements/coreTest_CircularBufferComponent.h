@@ -0,0 +1,76 @@
+// Copyright 2009-2020 NTESS. Under the terms
+// of Contract DE-NA0003525 with NTESS, the U.S.
+// Government retains certain rights in this software.
+//
+// Copyright (c) 2009-2020, NTESS
+// All rights reserved.
+//
+// Portions are copyright of other developers:
+// See the file CONTRIBUTORS.TXT in the top level directory
+// the distribution for more information.
+//
+// This file is part of the SST software package. For license
+// information, see the LICENSE file in the top level directory of the
+// distribution.
+
+#ifndef _CORETEST_CIRCULARBUFFER_COMPONENT_H
+#define _CORETEST_CIRCULARBUFFER_COMPONENT_H
+
+#include <sst/core/component.h>
+
+namespace SST {
+namespace CoreTestCircularBufferComponent {
+
+/**
+ * Checks the interprocess CircularBuffer used by IPCTunnel: bulk reads
+ * and writes that wrap around the end of the ring, a full ring, and a
+ * producer and consumer on separate threads with blocking waits.
+ */
+class coreTestCircularBufferComponent : public SST::Component
+{
+public:
+
+    // REGISTER THIS COMPONENT INTO THE ELEMENT LIBRARY
+    SST_ELI_REGISTER_COMPONENT(
+        coreTestCircularBufferComponent,
+        "coreTestElement",
+        "coreTestCircularBufferComponent",
+        SST_ELI_ELEMENT_VERSION(1,0,0),
+        "Interprocess CircularBuffer Check Component",
+        COMPONENT_CATEGORY_UNCATEGORIZED
+    )
+
+    SST_ELI_DOCUMENT_PARAMS(
+        { "count", "Number of messages to pass between the threads", "100000" }
+    )
+
+    // Optional since there is nothing to document
+    SST_ELI_DOCUMENT_STATISTICS(
+    )
+
+    // Optional since there is nothing to document
+    SST_ELI_DOCUMENT_PORTS(
+    )
+
+    // Optional since there is nothing to document
+    SST_ELI_DOCUMENT_SUBCOMPONENT_SLOTS(
+    )
+
+    coreTestCircularBufferComponent(SST::ComponentId_t id, SST::Params& params);
+    void setup();
+    void finish() { }
+
+private:
+    coreTestCircularBufferComponent();  // for serialization only
+    coreTestCircularBufferComponent(const coreTestCircularBufferComponent&); // do not implement
+    void operator=(const coreTestCircularBufferComponent&); // do not implement
+
+    void report(const char* what, bool ok);
+
+    uint64_t count;
+};
+
+} // namespace CoreTestCircularBufferComponent
+} // namespace SST
+
+#endif /* _CORETEST_CIRCULARBUFFER_COMPONENT_H */
@@ -51,6 +51,7 @@ coreTestClockerComponent::coreTestClockerComponent(ComponentId_t id, Params& par
     // Create the OneShot Callback Handlers
     callback1Handler = new OneShot::Handler<coreTestClockerComponent, uint32_t>(this, &coreTestClockerComponent::Oneshot1Callback, 456);
     callback2Handler = new OneShot::Handler<coreTestClockerComponent>(this, &coreTestClockerComponent::Oneshot2Callback);
+    callback3Handler = new OneShot::Handler<coreTestClockerComponent>(this, &coreTestClockerComponent::Oneshot3Callback);
 }
 
 coreTestClockerComponent::coreTestClockerComponent() :
@@ -96,6 +97,23 @@ bool coreTestClockerComponent::Clock3Tick(SST::Cycle_t CycleNum, uint32_t Param)
         registerOneShot("18ns", callback2Handler);
     }
 
+    // Cancel a OneShot on the next tick (it is due 3ns later), and one
+    // straight away
+    if (CycleNum == 1) {
+        canceledOneShot = registerCancelableOneShot(UnitAlgebra("18ns"), callback3Handler);
+    }
+    if (CycleNum == 2 || CycleNum == 4) {
+        if (CycleNum == 4) {
+            canceledOneShot = registerCancelableOneShot(UnitAlgebra("18ns"), callback3Handler);
+        }
+        if ( !cancelOneShot(canceledOneShot) ) {
+            std::cout << "*** FAILED TO CANCEL ONESHOT " << std::endl;
+        }
+        if ( cancelOneShot(canceledOneShot) ) {
+            std::cout << "*** CANCELED ONESHOT TWICE " << std::endl;
+        }
+    }
+
     // return false so we keep going or true to stop
     if (CycleNum == 15) {
         return true;
@@ -114,6 +132,11 @@ void coreTestClockerComponent::Oneshot2Callback()
     std::cout << "-------- ONESHOT #2 CALLBACK" << std::endl;
 }
 
+void coreTestClockerComponent::Oneshot3Callback()
+{
+    std::cout << "-------- ONESHOT #3 CALLBACK (WAS CANCELED)" << std::endl;
+}
+
 // Serialization
 } // namespace coreTestClockerComponent
 } // namespace SST
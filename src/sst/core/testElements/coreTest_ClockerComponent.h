@@ -68,6 +68,7 @@ private:
 
     virtual void Oneshot1Callback(uint32_t);
     virtual void Oneshot2Callback();
+    virtual void Oneshot3Callback();
 
     TimeConverter*      tc;
     Clock::HandlerBase* Clock3Handler;
@@ -75,6 +76,9 @@ private:
     // Variables to store OneShot Callback Handlers
     OneShot::HandlerBase* callback1Handler;
     OneShot::HandlerBase* callback2Handler;
+    // Only registered to be canceled, so it must never be called
+    OneShot::HandlerBase* callback3Handler;
+    OneShot::Handle canceledOneShot;
 
     std::string clock_frequency_str;
     int clock_count;
@@ -60,6 +60,11 @@ coreTestParamComponent::coreTestParamComponent(ComponentId_t id, Params& params)
 	const std::string strv = params.find<std::string>("string-param");
 	printf("string       value = \"%s\"\n", strv.c_str());
 
+	// A non-overwriting insert keeps local values but overrides shared ones
+	Params copy(params);
+	copy.insert("string-param", "inserted", false);
+	printf("insert       value = \"%s\"\n", copy.find<std::string>("string-param").c_str());
+
 }
 
 coreTestParamComponent::coreTestParamComponent() :
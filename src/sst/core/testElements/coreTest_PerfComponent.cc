@@ -0,0 +1,149 @@
+// Copyright 2009-2020 NTESS. Under the terms
+// of Contract DE-NA0003525 with NTESS, the U.S.
+// Government retains certain rights in this software.
+//
+// Copyright (c) 2009-2020, NTESS
+// All rights reserved.
+//
+// Portions are copyright of other developers:
+// See the file CONTRIBUTORS.TXT in the top level directory
+// the distribution for more information.
+//
+// This file is part of the SST software package. For license
+// information, see the LICENSE file in the top level directory of the
+// distribution.
+
+#include "sst_config.h"
+
+#include <cinttypes>
+
+#include "sst/core/testElements/coreTest_PerfComponent.h"
+
+using namespace SST;
+using namespace SST::CoreTestPerfComponent;
+
+coreTestPerfSubComponent::coreTestPerfSubComponent(ComponentId_t id, Params& UNUSED(params)) :
+    SubComponent(id)
+{
+    child = loadUserSubComponent<coreTestPerfSubComponent>("child");
+}
+
+coreTestPerfComponent::coreTestPerfComponent(ComponentId_t id, Params& params) :
+    Component(id),
+    received(0),
+    sent(0),
+    ticks(0)
+{
+    output = new Output("PerfComponent: ", 1, 0, Output::STDOUT);
+
+    int numPorts = params.find<int>("num_ports", 1);
+    initialEvents = params.find<uint64_t>("initial_events", 0);
+    payload = params.find<uint32_t>("payload", 0);
+    clockSends = params.find<bool>("clock_sends", false);
+    clockLimit = params.find<uint64_t>("clock_limit", 0);
+    poll = params.find<bool>("poll", false);
+    sendJitter = params.find<uint32_t>("send_jitter", 0);
+    // xorshift cannot take a zero seed
+    rng = new SST::RNG::XORShiftRNG(params.find<uint32_t>("seed", 1) + id + 1);
+
+    std::string fwd = params.find<std::string>("forward", "none");
+    if ( fwd == "reply" ) forward = REPLY;
+    else if ( fwd == "random" ) forward = RANDOM;
+    else if ( fwd == "none" ) forward = NONE;
+    else output->fatal(CALL_INFO, -1, "Unknown forward mode '%s'\n", fwd.c_str());
+
+    for ( int i = 0; i < numPorts; i++ ) {
+        std::string port = "port" + std::to_string(i);
+        Link* link = configureLink(port, "1ps", poll ? nullptr :
+                                   new Event::Handler<coreTestPerfComponent, int>(this,
+                                   &coreTestPerfComponent::handleEvent, (int)links.size()));
+        if ( link ) links.push_back(link);
+    }
+
+    child = loadUserSubComponent<coreTestPerfSubComponent>("child");
+
+    // Run until the stop time given in the model
+    registerAsPrimaryComponent();
+    primaryComponentDoNotEndSim();
+
+    std::string clock = params.find<std::string>("clock", "");
+    if ( poll && clock.empty() ) {
+        output->fatal(CALL_INFO, -1, "Polling links need a clock to drain them\n");
+    }
+    if ( !clock.empty() ) {
+        registerClock(clock, new Clock::Handler<coreTestPerfComponent>(this,
+                      &coreTestPerfComponent::clockTic));
+    }
+}
+
+coreTestPerfComponent::~coreTestPerfComponent()
+{
+    delete rng;
+    delete output;
+}
+
+coreTestPerfComponent::coreTestPerfComponent() :
+    Component(-1)
+{
+    // for serialization only
+}
+
+void coreTestPerfComponent::setup()
+{
+    if ( links.empty() ) return;
+    for ( uint64_t i = 0; i < initialEvents; i++ ) {
+        send(i % links.size(), new coreTestPerfEvent());
+    }
+}
+
+void coreTestPerfComponent::finish()
+{
+    output->output("%s: received %" PRIu64 " events, sent %" PRIu64 " events, %" PRIu64 " clock ticks\n",
+                   getName().c_str(), received, sent, ticks);
+}
+
+void coreTestPerfComponent::send(int port, coreTestPerfEvent* ev)
+{
+    if ( ev->payload.size() != payload ) ev->payload.resize(payload);
+    if ( sendJitter ) links[port]->send(rng->generateNextUInt32() % (sendJitter + 1), ev);
+    else links[port]->send(ev);
+    sent++;
+}
+
+void coreTestPerfComponent::handleEvent(Event *ev, int port)
+{
+    received++;
+    coreTestPerfEvent* event = static_cast<coreTestPerfEvent*>(ev);
+    switch ( forward ) {
+    case REPLY:
+        send(port, event);
+        break;
+    case RANDOM:
+        send(rng->generateNextUInt32() % links.size(), event);
+        break;
+    default:
+        delete event;
+        break;
+    }
+}
+
+void coreTestPerfComponent::pollLinks()
+{
+    for ( size_t i = 0; i < links.size(); i++ ) {
+        while ( Event* ev = links[i]->recv() ) {
+            handleEvent(ev, i);
+        }
+    }
+}
+
+bool coreTestPerfComponent::clockTic(Cycle_t)
+{
+    ticks++;
+    if ( poll ) pollLinks();
+    if ( clockSends ) {
+        for ( size_t i = 0; i < links.size(); i++ ) {
+            send(i, new coreTestPerfEvent());
+        }
+    }
+    return clockLimit != 0 && ticks >= clockLimit;
+}
@@ -0,0 +1,162 @@
+// Copyright 2009-2020 NTESS. Under the terms
+// of Contract DE-NA0003525 with NTESS, the U.S.
+// Government retains certain rights in this software.
+//
+// Copyright (c) 2009-2020, NTESS
+// All rights reserved.
+//
+// Portions are copyright of other developers:
+// See the file CONTRIBUTORS.TXT in the top level directory
+// the distribution for more information.
+//
+// This file is part of the SST software package. For license
+// information, see the LICENSE file in the top level directory of the
+// distribution.
+
+#ifndef _CORETESTPERFCOMPONENT_H
+#define _CORETESTPERFCOMPONENT_H
+
+#include "sst/core/component.h"
+#include "sst/core/subcomponent.h"
+#include "sst/core/link.h"
+#include "sst/core/rng/xorshift.h"
+
+#include <vector>
+
+namespace SST {
+namespace CoreTestPerfComponent {
+
+class coreTestPerfEvent : public SST::Event
+{
+public:
+    coreTestPerfEvent() : SST::Event() { }
+    std::vector<char> payload;
+
+    void serialize_order(SST::Core::Serialization::serializer &ser)  override {
+        Event::serialize_order(ser);
+        ser & payload;
+    }
+
+    ImplementSerializable(SST::CoreTestPerfComponent::coreTestPerfEvent);
+};
+
+/**
+ * Subcomponent loaded by coreTestPerfComponent in its "child" slot.  It
+ * only loads its own child, if it has one, so chains of them measure the
+ * cost of building subcomponent trees at start-up.
+ */
+class coreTestPerfSubComponent : public SST::SubComponent
+{
+public:
+
+    SST_ELI_REGISTER_SUBCOMPONENT_API(SST::CoreTestPerfComponent::coreTestPerfSubComponent)
+
+    SST_ELI_REGISTER_SUBCOMPONENT_DERIVED(
+        coreTestPerfSubComponent,
+        "coreTestElement",
+        "coreTestPerfSubComponent",
+        SST_ELI_ELEMENT_VERSION(1,0,0),
+        "Core start-up benchmark subcomponent",
+        SST::CoreTestPerfComponent::coreTestPerfSubComponent
+    )
+
+    SST_ELI_DOCUMENT_SUBCOMPONENT_SLOTS(
+        {"child", "Optional next subcomponent in the chain", "SST::CoreTestPerfComponent::coreTestPerfSubComponent" }
+    )
+
+    coreTestPerfSubComponent(SST::ComponentId_t id, SST::Params& params);
+    ~coreTestPerfSubComponent() {}
+
+private:
+    coreTestPerfSubComponent* child;
+};
+
+/**
+ * Synthetic component used by the core benchmarks (tests/benchmarks).
+ *
+ * It does no work of its own, so the run time is spent in the core:
+ * delivering events, running clocks and synchronizing.  Wiring and
+ * parameters select the pattern: ping-pong chains reply on the port an
+ * event arrived on, a torus forwards to a random neighbor, an idle grid
+ * only runs clocks, a fan-out root broadcasts on every clock tick, and a
+ * polling ring drains polling links on every clock tick.
+ */
+class coreTestPerfComponent : public SST::Component
+{
+public:
+
+    // REGISTER THIS COMPONENT INTO THE ELEMENT LIBRARY
+    SST_ELI_REGISTER_COMPONENT(
+        coreTestPerfComponent,
+        "coreTestElement",
+        "coreTestPerfComponent",
+        SST_ELI_ELEMENT_VERSION(1,0,0),
+        "Core event engine benchmark component",
+        COMPONENT_CATEGORY_UNCATEGORIZED
+    )
+
+    SST_ELI_DOCUMENT_PARAMS(
+        { "num_ports",      "Number of ports (port0 .. portN-1) to look for", "1" },
+        { "initial_events", "Events to send, round robin over the connected ports, during setup", "0" },
+        { "forward",        "What to do with a received event: reply (on the same port), random (any port) or none", "none" },
+        { "payload",        "Payload size in bytes of each event sent", "0" },
+        { "clock",          "Clock frequency (empty for no clock)", "" },
+        { "clock_sends",    "Send an event on every connected port on each clock tick", "0" },
+        { "clock_limit",    "Number of clock ticks before the clock is stopped (0 for no limit)", "0" },
+        { "seed",           "Seed for the random port choice", "1" },
+        { "poll",           "Use polling links, drained on every clock tick, instead of event handlers", "0" },
+        { "send_jitter",    "Add a random extra delay of up to this many ps to each event sent", "0" }
+    )
+
+    // Optional since there is nothing to document
+    SST_ELI_DOCUMENT_STATISTICS(
+    )
+
+    SST_ELI_DOCUMENT_PORTS(
+        {"port%(num_ports)d", "Ports to send and receive on", { "coreTestPerfComponent.coreTestPerfEvent", "" } }
+    )
+
+    SST_ELI_DOCUMENT_SUBCOMPONENT_SLOTS(
+        {"child", "Optional chain of subcomponents, used to benchmark start-up", "SST::CoreTestPerfComponent::coreTestPerfSubComponent" }
+    )
+
+    coreTestPerfComponent(SST::ComponentId_t id, SST::Params& params);
+    ~coreTestPerfComponent();
+
+    void setup();
+    void finish();
+
+private:
+    enum Forward { NONE, REPLY, RANDOM };
+
+    coreTestPerfComponent();  // for serialization only
+    coreTestPerfComponent(const coreTestPerfComponent&); // do not implement
+    void operator=(const coreTestPerfComponent&); // do not implement
+
+    void handleEvent(SST::Event *ev, int port);
+    void pollLinks();
+    bool clockTic(SST::Cycle_t);
+    void send(int port, coreTestPerfEvent* ev);
+
+    Output* output;
+    Forward forward;
+    uint64_t initialEvents;
+    uint32_t payload;
+    bool clockSends;
+    uint64_t clockLimit;
+    bool poll;
+    uint32_t sendJitter;
+
+    SST::RNG::XORShiftRNG* rng;
+    std::vector<SST::Link*> links;
+    coreTestPerfSubComponent* child;
+
+    uint64_t received;
+    uint64_t sent;
+    uint64_t ticks;
+};
+
+} // namespace CoreTestPerfComponent
+} // namespace SST
+
+#endif /* _CORETESTPERFCOMPONENT_H */
@@ -0,0 +1,97 @@
+// Copyright 2009-2020 NTESS. Under the terms
+// of Contract DE-NA0003525 with NTESS, the U.S.
+// Government retains certain rights in this software.
+//
+// Copyright (c) 2009-2020, NTESS
+// All rights reserved.
+//
+// Portions are copyright of other developers:
+// See the file CONTRIBUTORS.TXT in the top level directory
+// the distribution for more information.
+//
+// This file is part of the SST software package. For license
+// information, see the LICENSE file in the top level directory of the
+// distribution.
+
+#include "sst_config.h"
+
+#include "sst/core/testElements/coreTest_PollingLinkComponent.h"
+#include "sst/core/interfaces/stringEvent.h"
+
+using namespace SST::Interfaces;
+
+namespace SST {
+namespace CoreTestPollingLinkComponent {
+
+// Sends events out of order, and several with the same delivery time,
+// on a polling self link and prints the order they are received in.
+// All events on one link share the same enforce_link_order, so events
+// with equal delivery times must come out in the order they were sent.
+coreTestPollingLinkComponent::coreTestPollingLinkComponent(ComponentId_t id, Params& UNUSED(params)) :
+  Component(id),
+  pending(0)
+{
+    selfLink = configureSelfLink("self", "1ns");
+
+    registerClock("1GHz", new Clock::Handler<coreTestPollingLinkComponent>(this, &coreTestPollingLinkComponent::tick));
+
+    registerAsPrimaryComponent();
+    primaryComponentDoNotEndSim();
+}
+
+coreTestPollingLinkComponent::coreTestPollingLinkComponent() :
+    Component(-1)
+{
+
+}
+
+void coreTestPollingLinkComponent::send(SimTime_t delay, const std::string& label)
+{
+    selfLink->send(delay, new StringEvent(label));
+    pending++;
+}
+
+void coreTestPollingLinkComponent::setup()
+{
+    // Out of order
+    send(5, "a5");
+    send(3, "b3");
+    send(1, "c1");
+    send(4, "d4");
+    send(2, "e2");
+
+    // Equal times, with later and earlier events in between
+    send(8, "g8");
+    send(6, "f6.0");
+    send(6, "f6.1");
+    send(7, "h7");
+    send(6, "f6.2");
+    send(6, "f6.3");
+
+    // Reverse order, enough to make the queue grow
+    for ( SimTime_t delay = 40; delay > 16; delay-- ) {
+        send(delay, "r" + std::to_string(delay));
+    }
+}
+
+bool coreTestPollingLinkComponent::tick(Cycle_t cycle)
+{
+    while ( Event* ev = selfLink->recv() ) {
+        StringEvent* event = static_cast<StringEvent*>(ev);
+        printf("%s tick %" PRIu64 ": %s\n", getName().c_str(), cycle, event->getString().c_str());
+        delete event;
+        pending--;
+    }
+
+    // Sent while d4 is already queued for the same time, so comes after it
+    if ( cycle == 3 ) send(1, "i4");
+
+    if ( pending == 0 ) {
+        primaryComponentOKToEndSim();
+        return true;
+    }
+    return false;
+}
+
+} // namespace CoreTestPollingLinkComponent
+} // namespace SST
@@ -0,0 +1,73 @@
+// Copyright 2009-2020 NTESS. Under the terms
+// of Contract DE-NA0003525 with NTESS, the U.S.
+// Government retains certain rights in this software.
+//
+// Copyright (c) 2009-2020, NTESS
+// All rights reserved.
+//
+// Portions are copyright of other developers:
+// See the file CONTRIBUTORS.TXT in the top level directory
+// the distribution for more information.
+//
+// This file is part of the SST software package. For license
+// information, see the LICENSE file in the top level directory of the
+// distribution.
+
+#ifndef _CORETEST_POLLINGLINK_COMPONENT_H
+#define _CORETEST_POLLINGLINK_COMPONENT_H
+
+#include <sst/core/component.h>
+#include <sst/core/link.h>
+
+namespace SST {
+namespace CoreTestPollingLinkComponent {
+
+class coreTestPollingLinkComponent : public SST::Component
+{
+public:
+
+    // REGISTER THIS COMPONENT INTO THE ELEMENT LIBRARY
+    SST_ELI_REGISTER_COMPONENT(
+        coreTestPollingLinkComponent,
+        "coreTestElement",
+        "coreTestPollingLinkComponent",
+        SST_ELI_ELEMENT_VERSION(1,0,0),
+        "Polling Link Delivery Order Check Component",
+        COMPONENT_CATEGORY_UNCATEGORIZED
+    )
+
+    SST_ELI_DOCUMENT_PARAMS(
+    )
+
+    // Optional since there is nothing to document
+    SST_ELI_DOCUMENT_STATISTICS(
+    )
+
+    // Optional since there is nothing to document
+    SST_ELI_DOCUMENT_PORTS(
+    )
+
+    // Optional since there is nothing to document
+    SST_ELI_DOCUMENT_SUBCOMPONENT_SLOTS(
+    )
+
+    coreTestPollingLinkComponent(SST::ComponentId_t id, SST::Params& params);
+    void setup();
+    void finish() { }
+
+private:
+    coreTestPollingLinkComponent();  // for serialization only
+    coreTestPollingLinkComponent(const coreTestPollingLinkComponent&); // do not implement
+    void operator=(const coreTestPollingLinkComponent&); // do not implement
+
+    void send(SST::SimTime_t delay, const std::string& label);
+    bool tick(SST::Cycle_t cycle);
+
+    SST::Link* selfLink;
+    int pending;
+};
+
+} // namespace CoreTestPollingLinkComponent
+} // namespace SST
+
+#endif /* _CORETEST_POLLINGLINK_COMPONENT_H */
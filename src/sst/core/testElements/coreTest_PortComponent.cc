@@ -0,0 +1,100 @@
+// Copyright 2009-2020 NTESS. Under the terms
+// of Contract DE-NA0003525 with NTESS, the U.S.
+// Government retains certain rights in this software.
+//
+// Copyright (c) 2009-2020, NTESS
+// All rights reserved.
+//
+// Portions are copyright of other developers:
+// See the file CONTRIBUTORS.TXT in the top level directory
+// the distribution for more information.
+//
+// This file is part of the SST software package. For license
+// information, see the LICENSE file in the top level directory of the
+// distribution.
+
+#include "sst_config.h"
+
+#include "sst/core/testElements/coreTest_PortComponent.h"
+#include "sst/core/interfaces/stringEvent.h"
+
+using namespace SST::Interfaces;
+
+namespace SST {
+namespace CoreTestPortComponent {
+
+// Components of the same type share one port name table, so every lookup
+// here also checks that ports connected only on other instances are
+// reported as unconnected on this one.
+coreTestPortComponent::coreTestPortComponent(ComponentId_t id, Params& params) :
+  Component(id)
+{
+    int num_ports = params.find<int>("num_ports", 8);
+
+    std::string connected;
+    for ( int i = 0; i < num_ports; i++ ) {
+        std::string port = "port" + std::to_string(i);
+        Link* link = nullptr;
+        if ( isPortConnected(port) ) {
+            link = configureLink(port, "1ns", new Event::Handler<coreTestPortComponent, int>(this, &coreTestPortComponent::handleEvent, i));
+            if ( link == nullptr ) {
+                printf("%s %s is connected but configureLink failed\n", getName().c_str(), port.c_str());
+            }
+            connected += " " + std::to_string(i);
+        }
+        else if ( configureLink(port, "1ns") != nullptr ) {
+            printf("%s %s is not connected but configureLink succeeded\n", getName().c_str(), port.c_str());
+        }
+        links.push_back(link);
+    }
+    printf("%s connected ports:%s\n", getName().c_str(), connected.c_str());
+    // One event on each connected port plus one on the self link
+    pending = 1;
+    for ( Link* link : links ) {
+        if ( link != nullptr ) pending++;
+    }
+
+    // Self ports are interned into the same shared table
+    selfLink = configureSelfLink("self", "1ns", new Event::Handler<coreTestPortComponent>(this, &coreTestPortComponent::handleSelf));
+    if ( !isPortConnected("self") ) {
+        printf("%s self link is not connected\n", getName().c_str());
+    }
+
+    registerAsPrimaryComponent();
+    primaryComponentDoNotEndSim();
+}
+
+coreTestPortComponent::coreTestPortComponent() :
+    Component(-1)
+{
+
+}
+
+void coreTestPortComponent::setup()
+{
+    for ( size_t i = 0; i < links.size(); i++ ) {
+        if ( links[i] != nullptr ) {
+            links[i]->send(new StringEvent(getName() + ".port" + std::to_string(i)));
+        }
+    }
+    selfLink->send(new StringEvent(getName() + ".self"));
+}
+
+void coreTestPortComponent::handleEvent(Event* ev, int port)
+{
+    StringEvent* event = static_cast<StringEvent*>(ev);
+    printf("%s port%d received from %s\n", getName().c_str(), port, event->getString().c_str());
+    delete event;
+    if ( --pending == 0 ) primaryComponentOKToEndSim();
+}
+
+void coreTestPortComponent::handleSelf(Event* ev)
+{
+    StringEvent* event = static_cast<StringEvent*>(ev);
+    printf("%s self received from %s\n", getName().c_str(), event->getString().c_str());
+    delete event;
+    if ( --pending == 0 ) primaryComponentOKToEndSim();
+}
+
+} // namespace CoreTestPortComponent
+} // namespace SST
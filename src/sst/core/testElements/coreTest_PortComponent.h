@@ -0,0 +1,78 @@
+// Copyright 2009-2020 NTESS. Under the terms
+// of Contract DE-NA0003525 with NTESS, the U.S.
+// Government retains certain rights in this software.
+//
+// Copyright (c) 2009-2020, NTESS
+// All rights reserved.
+//
+// Portions are copyright of other developers:
+// See the file CONTRIBUTORS.TXT in the top level directory
+// the distribution for more information.
+//
+// This file is part of the SST software package. For license
+// information, see the LICENSE file in the top level directory of the
+// distribution.
+
+#ifndef _CORETEST_PORT_COMPONENT_H
+#define _CORETEST_PORT_COMPONENT_H
+
+#include <sst/core/component.h>
+#include <sst/core/link.h>
+
+#include <vector>
+
+namespace SST {
+namespace CoreTestPortComponent {
+
+class coreTestPortComponent : public SST::Component
+{
+public:
+
+    // REGISTER THIS COMPONENT INTO THE ELEMENT LIBRARY
+    SST_ELI_REGISTER_COMPONENT(
+        coreTestPortComponent,
+        "coreTestElement",
+        "coreTestPortComponent",
+        SST_ELI_ELEMENT_VERSION(1,0,0),
+        "Port Lookup Check Component",
+        COMPONENT_CATEGORY_UNCATEGORIZED
+    )
+
+    SST_ELI_DOCUMENT_PARAMS(
+        { "num_ports", "Number of port%d ports to look up", "8" }
+    )
+
+    // Optional since there is nothing to document
+    SST_ELI_DOCUMENT_STATISTICS(
+    )
+
+    SST_ELI_DOCUMENT_PORTS(
+        {"port%d", "Ports that may or may not be connected", { "sst.Interfaces.StringEvent" } }
+    )
+
+    // Optional since there is nothing to document
+    SST_ELI_DOCUMENT_SUBCOMPONENT_SLOTS(
+    )
+
+    coreTestPortComponent(SST::ComponentId_t id, SST::Params& params);
+    void setup();
+    void finish() { }
+
+private:
+    coreTestPortComponent();  // for serialization only
+    coreTestPortComponent(const coreTestPortComponent&); // do not implement
+    void operator=(const coreTestPortComponent&); // do not implement
+
+    void handleEvent(SST::Event* ev, int port);
+    void handleSelf(SST::Event* ev);
+
+    // Indexed by port number, nullptr for unconnected ports
+    std::vector<SST::Link*> links;
+    SST::Link* selfLink;
+    int pending;
+};
+
+} // namespace CoreTestPortComponent
+} // namespace SST
+
+#endif /* _CORETEST_PORT_COMPONENT_H */
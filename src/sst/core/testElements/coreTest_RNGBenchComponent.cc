@@ -0,0 +1,249 @@
+// Copyright 2009-2020 NTESS. Under the terms
+// of Contract DE-NA0003525 with NTESS, the U.S.
+// Government retains certain rights in this software.
+//
+// Copyright (c) 2009-2020, NTESS
+// All rights reserved.
+//
+// Portions are copyright of other developers:
+// See the file CONTRIBUTORS.TXT in the top level directory
+// the distribution for more information.
+//
+// This file is part of the SST software package. For license
+// information, see the LICENSE file in the top level directory of the
+// distribution.
+
+#include "sst_config.h"
+
+#include <chrono>
+#include <vector>
+
+#include "sst/core/testElements/coreTest_RNGBenchComponent.h"
+
+#include "sst/core/rng/mersenne.h"
+#include "sst/core/rng/marsaglia.h"
+#include "sst/core/rng/xorshift.h"
+#include "sst/core/rng/philox.h"
+#include "sst/core/rng/expon.h"
+#include "sst/core/rng/gaussian.h"
+#include "sst/core/rng/poisson.h"
+
+using namespace SST;
+using namespace SST::RNG;
+using namespace SST::CoreTestRNGBenchComponent;
+
+static double nsPerSample(std::chrono::steady_clock::time_point start, uint64_t count)
+{
+    std::chrono::duration<double, std::nano> elapsed = std::chrono::steady_clock::now() - start;
+    return elapsed.count() / (double) count;
+}
+
+coreTestRNGBenchComponent::coreTestRNGBenchComponent(ComponentId_t id, Params& params) :
+  Component(id)
+{
+    output = new Output("RNGBench: ", 1, 0, Output::STDOUT);
+
+    rng_type = params.find<std::string>("rng", "mersenne");
+    distrib_type = params.find<std::string>("distrib", "none");
+    seed = (uint32_t) params.find<int64_t>("seed", 1447);
+    count = params.find<uint64_t>("count", 1000000);
+    batch = params.find<uint64_t>("batch", 1024);
+    timing = params.find<bool>("timing", true);
+
+    if ( batch == 0 ) {
+        output->fatal(CALL_INFO, -1, "batch must be greater than zero\n");
+    }
+
+    // tell the simulator not to end without us
+    registerAsPrimaryComponent();
+    primaryComponentDoNotEndSim();
+
+    registerClock("1GHz", new Clock::Handler<coreTestRNGBenchComponent>(this,
+                               &coreTestRNGBenchComponent::tick));
+}
+
+coreTestRNGBenchComponent::~coreTestRNGBenchComponent() {
+    delete output;
+}
+
+coreTestRNGBenchComponent::coreTestRNGBenchComponent() :
+    Component(-1)
+{
+    // for serialization only
+}
+
+SSTRandom* coreTestRNGBenchComponent::createRNG()
+{
+    if ( rng_type == "marsaglia" ) return new MarsagliaRNG(seed, seed ^ 0x5a5a5a5a);
+    if ( rng_type == "xorshift" ) return new XORShiftRNG(seed);
+    if ( rng_type == "philox" ) return new PhiloxRNG(seed, getId());
+    if ( rng_type != "mersenne" ) {
+        output->fatal(CALL_INFO, -1, "Generator: %s is unknown\n", rng_type.c_str());
+    }
+    return new MersenneRNG(seed);
+}
+
+SSTRandomDistribution* coreTestRNGBenchComponent::createDistrib(SSTRandom* base)
+{
+    if ( distrib_type == "gaussian" ) return new SSTGaussianDistribution(1.0, 0.2, base);
+    if ( distrib_type == "exponential" ) return new SSTExponentialDistribution(1.0, base);
+    if ( distrib_type == "poisson" ) return new SSTPoissonDistribution(3.0, base);
+    output->fatal(CALL_INFO, -1, "Distribution: %s is unknown\n", distrib_type.c_str());
+    return nullptr;
+}
+
+void coreTestRNGBenchComponent::report(const char* kind, double single_ns, double bulk_ns)
+{
+    if ( !timing ) return;
+    output->output("%s %s single: %.3f ns/sample bulk: %.3f ns/sample speedup: %.2fx\n",
+                   rng_type.c_str(), kind, single_ns, bulk_ns, single_ns / bulk_ns);
+}
+
+void coreTestRNGBenchComponent::benchGenerator()
+{
+    std::vector<uint64_t> u64(batch);
+    std::vector<double> uni(batch);
+
+    /* Correctness: a bulk fill must match the same number of single calls */
+    SSTRandom* single = createRNG();
+    SSTRandom* bulk = createRNG();
+    bool u64_match = true;
+    bool uni_match = true;
+    for ( uint64_t done = 0 ; done < count ; done += batch ) {
+        bulk->fill(u64.data(), batch);
+        bulk->fillUniform(uni.data(), batch);
+        for ( uint64_t i = 0 ; i < batch ; i++ ) {
+            if ( u64[i] != single->generateNextUInt64() ) u64_match = false;
+        }
+        for ( uint64_t i = 0 ; i < batch ; i++ ) {
+            if ( uni[i] != single->nextUniform() ) uni_match = false;
+        }
+    }
+    output->output("%s uint64 bulk matches single: %s\n", rng_type.c_str(), u64_match ? "yes" : "no");
+    output->output("%s uniform bulk matches single: %s\n", rng_type.c_str(), uni_match ? "yes" : "no");
+    /* Both generators must have consumed exactly the same numbers */
+    output->output("%s state bulk matches single: %s\n", rng_type.c_str(),
+                   bulk->generateNextUInt64() == single->generateNextUInt64() ? "yes" : "no");
+    delete single;
+    delete bulk;
+
+    /* Timing */
+    SSTRandom* rng = createRNG();
+    volatile uint64_t sink = 0;
+    volatile double dsink = 0;
+
+    auto start = std::chrono::steady_clock::now();
+    for ( uint64_t i = 0 ; i < count ; i++ ) sink = sink + rng->generateNextUInt64();
+    double single_ns = nsPerSample(start, count);
+
+    start = std::chrono::steady_clock::now();
+    for ( uint64_t done = 0 ; done < count ; done += batch ) {
+        rng->fill(u64.data(), batch);
+        sink = sink + u64[batch - 1];
+    }
+    report("uint64", single_ns, nsPerSample(start, count));
+
+    start = std::chrono::steady_clock::now();
+    for ( uint64_t i = 0 ; i < count ; i++ ) dsink = dsink + rng->nextUniform();
+    single_ns = nsPerSample(start, count);
+
+    start = std::chrono::steady_clock::now();
+    for ( uint64_t done = 0 ; done < count ; done += batch ) {
+        rng->fillUniform(uni.data(), batch);
+        dsink = dsink + uni[batch - 1];
+    }
+    report("uniform", single_ns, nsPerSample(start, count));
+
+    delete rng;
+}
+
+void coreTestRNGBenchComponent::benchDistrib()
+{
+    std::vector<double> values(batch);
+
+    SSTRandom* single_rng = createRNG();
+    SSTRandom* bulk_rng = createRNG();
+    SSTRandomDistribution* single = createDistrib(single_rng);
+    SSTRandomDistribution* bulk = createDistrib(bulk_rng);
+
+    /* A bulk fill must return the same samples as single calls and leave
+       the base generator in the same state */
+    bool match = true;
+    for ( uint64_t done = 0 ; done < count ; done += batch ) {
+        bulk->getNextDoubles(values.data(), batch);
+        for ( uint64_t i = 0 ; i < batch ; i++ ) {
+            if ( values[i] != single->getNextDouble() ) match = false;
+        }
+    }
+    output->output("%s %s bulk matches single: %s\n", rng_type.c_str(), distrib_type.c_str(), match ? "yes" : "no");
+    output->output("%s %s state bulk matches single: %s\n", rng_type.c_str(), distrib_type.c_str(),
+                   bulk_rng->generateNextUInt64() == single_rng->generateNextUInt64() ? "yes" : "no");
+
+    volatile double sink = 0;
+    auto start = std::chrono::steady_clock::now();
+    for ( uint64_t i = 0 ; i < count ; i++ ) sink = sink + single->getNextDouble();
+    double single_ns = nsPerSample(start, count);
+
+    start = std::chrono::steady_clock::now();
+    for ( uint64_t done = 0 ; done < count ; done += batch ) {
+        bulk->getNextDoubles(values.data(), batch);
+        sink = sink + values[batch - 1];
+    }
+    report(distrib_type.c_str(), single_ns, nsPerSample(start, count));
+
+    delete single;
+    delete bulk;
+    delete single_rng;
+    delete bulk_rng;
+}
+
+void coreTestRNGBenchComponent::checkPhiloxPosition()
+{
+    /* skipAhead(n) must land exactly where n sequential draws do, for skips
+       inside a block, onto a block boundary, across blocks and from an
+       unaligned start */
+    const uint64_t starts[] = { 0, 1, 3 };
+    const uint64_t skips[] = { 0, 1, 2, 3, 4, 5, 7, 8, 9, 1023, 4097, 100003 };
+    bool skip_match = true;
+    for ( uint64_t start : starts ) {
+        for ( uint64_t skip : skips ) {
+            PhiloxRNG seq(seed, getId());
+            PhiloxRNG jump(seed, getId());
+            for ( uint64_t i = 0 ; i < start ; i++ ) {
+                seq.generateNextUInt32();
+                jump.generateNextUInt32();
+            }
+            for ( uint64_t i = 0 ; i < skip ; i++ ) seq.generateNextUInt32();
+            jump.skipAhead(skip);
+            if ( jump.getPosition() != seq.getPosition() ) skip_match = false;
+            for ( int i = 0 ; i < 9 ; i++ ) {
+                if ( jump.generateNextUInt32() != seq.generateNextUInt32() ) skip_match = false;
+            }
+        }
+    }
+    output->output("philox skipAhead matches sequential: %s\n", skip_match ? "yes" : "no");
+
+    /* setPosition() back to a saved position must replay the same numbers */
+    PhiloxRNG rng(seed, getId());
+    rng.generateNextUInt32();
+    rng.generateNextUInt64();
+    const uint64_t saved = rng.getPosition();
+    std::vector<uint64_t> first(batch);
+    rng.fill(first.data(), batch);
+    rng.setPosition(saved);
+    bool replay_match = true;
+    for ( uint64_t i = 0 ; i < batch ; i++ ) {
+        if ( rng.generateNextUInt64() != first[i] ) replay_match = false;
+    }
+    output->output("philox setPosition replays stream: %s\n", replay_match ? "yes" : "no");
+}
+
+bool coreTestRNGBenchComponent::tick( Cycle_t )
+{
+    if ( rng_type == "philox" && distrib_type == "none" ) checkPhiloxPosition();
+    if ( distrib_type == "none" ) benchGenerator();
+    else benchDistrib();
+
+    primaryComponentOKToEndSim();
+    return true;
+}
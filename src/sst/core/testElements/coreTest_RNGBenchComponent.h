@@ -0,0 +1,100 @@
+// Copyright 2009-2020 NTESS. Under the terms
+// of Contract DE-NA0003525 with NTESS, the U.S.
+// Government retains certain rights in this software.
+//
+// Copyright (c) 2009-2020, NTESS
+// All rights reserved.
+//
+// Portions are copyright of other developers:
+// See the file CONTRIBUTORS.TXT in the top level directory
+// the distribution for more information.
+//
+// This file is part of the SST software package. For license
+// information, see the LICENSE file in the top level directory of the
+// distribution.
+
+#ifndef _CORETESTRNGBENCHCOMPONENT_H
+#define _CORETESTRNGBENCHCOMPONENT_H
+
+#include "sst/core/component.h"
+#include "sst/core/rng/sstrng.h"
+#include "sst/core/rng/distrib.h"
+
+using namespace SST;
+using namespace SST::RNG;
+
+namespace SST {
+namespace CoreTestRNGBenchComponent {
+
+/**
+ * Compares the per-sample cost of the one-at-a-time RNG calls against the
+ * bulk fill interface, and checks that both produce the same numbers.
+ */
+class coreTestRNGBenchComponent : public SST::Component
+{
+public:
+
+    // REGISTER THIS COMPONENT INTO THE ELEMENT LIBRARY
+    SST_ELI_REGISTER_COMPONENT(
+        coreTestRNGBenchComponent,
+        "coreTestElement",
+        "coreTestRNGBenchComponent",
+        SST_ELI_ELEMENT_VERSION(1,0,0),
+        "Random number generation benchmark component",
+        COMPONENT_CATEGORY_UNCATEGORIZED
+    )
+
+    SST_ELI_DOCUMENT_PARAMS(
+        { "rng",     "The random number generator to benchmark (mersenne, marsaglia, xorshift or philox)", "mersenne"},
+        { "distrib", "Distribution to benchmark on top of the generator (none, gaussian, exponential, poisson)", "none"},
+        { "seed",    "The seed to use for the random number generator", "1447" },
+        { "count",   "The number of random numbers to generate per measurement", "1000000" },
+        { "batch",   "The number of random numbers requested per bulk call", "1024" },
+        { "timing",  "Report timings (set to 0 to only report correctness results)", "1" }
+    )
+
+    // Optional since there is nothing to document
+    SST_ELI_DOCUMENT_STATISTICS(
+    )
+
+    // Optional since there is nothing to document
+    SST_ELI_DOCUMENT_PORTS(
+    )
+
+    // Optional since there is nothing to document
+    SST_ELI_DOCUMENT_SUBCOMPONENT_SLOTS(
+    )
+
+    coreTestRNGBenchComponent(SST::ComponentId_t id, SST::Params& params);
+    ~coreTestRNGBenchComponent();
+    void setup()  { }
+    void finish() { }
+
+private:
+    coreTestRNGBenchComponent();  // for serialization only
+    coreTestRNGBenchComponent(const coreTestRNGBenchComponent&); // do not implement
+    void operator=(const coreTestRNGBenchComponent&); // do not implement
+
+    virtual bool tick(SST::Cycle_t);
+
+    SSTRandom* createRNG();
+    SSTRandomDistribution* createDistrib(SSTRandom* base);
+
+    void benchGenerator();
+    void benchDistrib();
+    void checkPhiloxPosition();
+    void report(const char* kind, double single_ns, double bulk_ns);
+
+    Output* output;
+    std::string rng_type;
+    std::string distrib_type;
+    uint32_t seed;
+    uint64_t count;
+    uint64_t batch;
+    bool timing;
+};
+
+} // namespace CoreTestRNGBenchComponent
+} // namespace SST
+
+#endif /* _CORETESTRNGBENCHCOMPONENT_H */
@@ -22,6 +22,7 @@
 #include "sst/core/rng/mersenne.h"
 #include "sst/core/rng/marsaglia.h"
 #include "sst/core/rng/xorshift.h"
+#include "sst/core/rng/philox.h"
 
 using namespace SST;
 using namespace SST::RNG;
@@ -59,6 +60,11 @@ coreTestRNGComponent::coreTestRNGComponent(ComponentId_t id, Params& params) :
 	uint32_t seed = (uint32_t) params.find<int64_t>("seed", 57);
 	output->verbose(CALL_INFO, 1, 0, "Using XORShift Generator with seed: %" PRIu32 "\n", seed);
 	rng = new XORShiftRNG(seed);
+    } else if (rngType == "philox") {
+	uint32_t seed = (uint32_t) params.find<int64_t>("seed", 1447);
+	uint32_t stream = (uint32_t) params.find<int64_t>("stream", 0);
+	output->verbose(CALL_INFO, 1, 0, "Using Philox Generator with seed: %" PRIu32 ", stream: %" PRIu32 "\n", seed, stream);
+	rng = new PhiloxRNG(seed, getId(), stream);
     } else {
 	output->verbose(CALL_INFO, 1, 0, "Generator: %s is unknown, using Mersenne with standard seed\n",
 		rngType.c_str());
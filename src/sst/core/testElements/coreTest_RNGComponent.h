@@ -43,7 +43,8 @@ public:
         { "seed_w",  "The seed to use for the random number generator", "7" },
         { "seed_z",  "The seed to use for the random number generator", "5" },
         { "seed",    "The seed to use for the random number generator.", "11" },
-        { "rng",     "The random number generator to use (Marsaglia or Mersenne), default is Mersenne", "Mersenne"},
+        { "stream",  "The stream id to use for the Philox generator", "0" },
+        { "rng",     "The random number generator to use (Marsaglia, Mersenne, XORShift or Philox), default is Mersenne", "Mersenne"},
         { "count",   "The number of random numbers to generate, default is 1000", "1000" },
         { "verbose", "Sets the output verbosity of the component", "0" }
     )
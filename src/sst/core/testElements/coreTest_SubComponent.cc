@@ -23,6 +23,8 @@
 
 #include <sst/core/timeConverter.h>
 
+#include <iostream>
+
 using namespace SST;
 using namespace SST::CoreTestSubComponent;
 
@@ -33,7 +35,8 @@ using namespace SST::CoreTestSubComponent;
  ***********************************************************************/
 
 SubComponentLoader::SubComponentLoader(ComponentId_t id, Params &params) :
-    Component(id)
+    Component(id),
+    setupSubComp(nullptr)
 {
     std::string freq = params.find<std::string>("clock", "1GHz");
 
@@ -64,6 +67,14 @@ SubComponentLoader::SubComponentLoader(ComponentId_t id, Params &params) :
 }
 
 
+void SubComponentLoader::setup()
+{
+    // Loading a user subcomponent after construction must still see
+    // the params from the input file
+    setupSubComp = loadUserSubComponent<SubCompInterface>("setupSubComp");
+}
+
+
 bool SubComponentLoader::tick(Cycle_t cyc)
 {
     for ( auto sub : subComps ) {
@@ -189,3 +200,15 @@ void SubCompReceiver::handleEvent(Event *ev)
     if ( nMsgReceived ) nMsgReceived->addData(1);
     delete ev;
 }
+
+
+/************************************************************************
+ *
+ *    SubCompParamPrinter
+ *
+ ***********************************************************************/
+SubCompParamPrinter::SubCompParamPrinter(ComponentId_t id, Params &params) :
+    SubCompInterface(id)
+{
+    std::cout << "SubCompParamPrinter: message = " << params.find<std::string>("message", "") << std::endl;
+}
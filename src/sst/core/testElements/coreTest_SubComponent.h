@@ -106,15 +106,19 @@ public:
     )
 
     SST_ELI_DOCUMENT_SUBCOMPONENT_SLOTS(
-        {"mySubComp", "Test slot", "SST::CoreTestSubComponent::SubCompInterface" }
+        {"mySubComp", "Test slot", "SST::CoreTestSubComponent::SubCompInterface" },
+        {"setupSubComp", "Optional slot that is loaded in setup() rather than in the constructor", "SST::CoreTestSubComponent::SubCompInterface" }
     )
 
     SubComponentLoader(ComponentId_t id, SST::Params& params);
 
+    void setup() override;
+
 private:
 
     bool tick(SST::Cycle_t);
     std::vector<SubCompInterface*> subComps;
+    SubCompInterface* setupSubComp;
 };
 
 
@@ -268,6 +272,43 @@ public:
 
 };
 
+
+class SubCompParamPrinter : public SubCompInterface
+{
+
+public:
+
+    // REGISTER THIS SUB-COMPONENT INTO THE ELEMENT LIBRARY
+    SST_ELI_REGISTER_SUBCOMPONENT_DERIVED(
+        SubCompParamPrinter,
+        "coreTestElement",
+        "SubCompParamPrinter",
+        SST_ELI_ELEMENT_VERSION(1,0,0),
+        "Subcomponent that prints its params when it is loaded",
+        SST::CoreTestSubComponent::SubCompInterface
+    )
+
+    SST_ELI_DOCUMENT_PARAMS(
+        {"message", "Message to print", "" },
+    )
+
+    // Optional since there is nothing to document
+    SST_ELI_DOCUMENT_STATISTICS(
+    )
+
+    // Optional since there is nothing to document
+    SST_ELI_DOCUMENT_PORTS(
+    )
+
+    // Optional since there is nothing to document
+    SST_ELI_DOCUMENT_SUBCOMPONENT_SLOTS(
+    )
+
+    SubCompParamPrinter(ComponentId_t id, Params &params);
+    ~SubCompParamPrinter() {}
+
+};
+
 } // namespace CoreTestSubComponent
 } // namespace SST
 
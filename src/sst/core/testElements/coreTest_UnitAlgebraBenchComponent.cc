@@ -0,0 +1,239 @@
+// Copyright 2009-2020 NTESS. Under the terms
+// of Contract DE-NA0003525 with NTESS, the U.S.
+// Government retains certain rights in this software.
+//
+// Copyright (c) 2009-2020, NTESS
+// All rights reserved.
+//
+// Portions are copyright of other developers:
+// See the file CONTRIBUTORS.TXT in the top level directory
+// the distribution for more information.
+//
+// This file is part of the SST software package. For license
+// information, see the LICENSE file in the top level directory of the
+// distribution.
+
+#include "sst_config.h"
+
+#include <chrono>
+
+#include "sst/core/testElements/coreTest_UnitAlgebraBenchComponent.h"
+
+#include "sst/core/binary_fixedpoint.h"
+#include "sst/core/decimal_fixedpoint.h"
+#include "sst/core/timeConverter.h"
+#include "sst/core/unitAlgebra.h"
+
+using namespace SST;
+using namespace SST::CoreTestUnitAlgebraBenchComponent;
+
+static double nsPerOp(std::chrono::steady_clock::time_point start, uint64_t count)
+{
+    std::chrono::duration<double, std::nano> elapsed = std::chrono::steady_clock::now() - start;
+    return elapsed.count() / (double) count;
+}
+
+coreTestUnitAlgebraBenchComponent::coreTestUnitAlgebraBenchComponent(ComponentId_t id, Params& params) :
+  Component(id)
+{
+    output = new Output("UnitAlgebraBench: ", 1, 0, Output::STDOUT);
+
+    count = params.find<uint64_t>("count", 100000);
+    timing = params.find<bool>("timing", true);
+
+    // tell the simulator not to end without us
+    registerAsPrimaryComponent();
+    primaryComponentDoNotEndSim();
+
+    registerClock("1GHz", new Clock::Handler<coreTestUnitAlgebraBenchComponent>(this,
+                               &coreTestUnitAlgebraBenchComponent::tick));
+}
+
+coreTestUnitAlgebraBenchComponent::~coreTestUnitAlgebraBenchComponent() {
+    delete output;
+}
+
+coreTestUnitAlgebraBenchComponent::coreTestUnitAlgebraBenchComponent() :
+    Component(-1)
+{
+    // for serialization only
+}
+
+void coreTestUnitAlgebraBenchComponent::check(const char* what, const std::string& result, const char* expected)
+{
+    output->output("%s = %s: %s\n", what, result.c_str(), result == expected ? "ok" : "WRONG");
+}
+
+void coreTestUnitAlgebraBenchComponent::report(const char* what, double ns)
+{
+    if ( !timing ) return;
+    output->output("%s: %.1f ns/op\n", what, ns);
+}
+
+static const char* fixedPointValues[] = {
+    "0", "1", "2.5", "-3.25", "0.1", "4096", "1e-12", "1e-24", "64e9", "1.5e-16",
+    "123456789.987654321", "3.141592653589793238462643", "999999999999999999999999"
+};
+
+void coreTestUnitAlgebraBenchComponent::compareFixedPoint()
+{
+    typedef decimal_fixedpoint<3,3> dec_t;
+    typedef binary_fixedpoint<3,3> bin_t;
+
+    // Both types hold the same values, so everything except division
+    // (the decimal version divides with a Newton iteration) must agree
+    // to the last digit
+    int mismatches = 0;
+    for ( const char* a : fixedPointValues ) {
+        dec_t da(a);
+        bin_t ba(a);
+        if ( da.toString(0) != ba.toString(0) ) mismatches++;
+        if ( da.toLong() != ba.toLong() ) mismatches++;
+        if ( dec_t(da.toString(0)).toString(0) != bin_t(ba.toString(0)).toString(0) ) mismatches++;
+
+        for ( const char* b : fixedPointValues ) {
+            dec_t db(b);
+            bin_t bb(b);
+            if ( (da + db).toString(0) != (ba + bb).toString(0) ) mismatches++;
+            if ( (da - db).toString(0) != (ba - bb).toString(0) ) mismatches++;
+            if ( (da < db) != (ba < bb) ) mismatches++;
+            // Keep products within range
+            if ( da.toDouble() * db.toDouble() < 1e23 ) {
+                if ( (da * db).toString(0) != (ba * bb).toString(0) ) mismatches++;
+            }
+            // The decimal inverse starts from a double estimate, so it
+            // only holds for positive divisors in double's range
+            if ( b[0] != '-' && db.toDouble() >= 1e-12 &&
+                 da.toDouble() / db.toDouble() < 1e23 && da.toDouble() / db.toDouble() > 1e-12 ) {
+                if ( (da / db).toString(12) != (ba / bb).toString(12) ) mismatches++;
+            }
+        }
+    }
+    check("binary/decimal fixed point mismatches", std::to_string(mismatches), "0");
+}
+
+template <typename T>
+void coreTestUnitAlgebraBenchComponent::benchFixedPoint(const char* name)
+{
+    if ( !timing ) return;
+
+    volatile uint64_t sink = 0;
+    T a("64e9");
+    T b("2.5e-9");
+    std::string what;
+
+    auto start = std::chrono::steady_clock::now();
+    for ( uint64_t i = 0 ; i < count ; i++ ) {
+        T v("1.5e-9");
+        sink = sink + v.isZero();
+    }
+    report((what = std::string(name) + " parse").c_str(), nsPerOp(start, count));
+
+    start = std::chrono::steady_clock::now();
+    for ( uint64_t i = 0 ; i < count ; i++ ) {
+        T v = a + b;
+        sink = sink + v.isZero();
+    }
+    report((what = std::string(name) + " add").c_str(), nsPerOp(start, count));
+
+    start = std::chrono::steady_clock::now();
+    for ( uint64_t i = 0 ; i < count ; i++ ) {
+        T v = a * b;
+        sink = sink + v.isZero();
+    }
+    report((what = std::string(name) + " multiply").c_str(), nsPerOp(start, count));
+
+    start = std::chrono::steady_clock::now();
+    for ( uint64_t i = 0 ; i < count ; i++ ) {
+        T v = a / b;
+        sink = sink + v.isZero();
+    }
+    report((what = std::string(name) + " divide").c_str(), nsPerOp(start, count));
+
+    start = std::chrono::steady_clock::now();
+    for ( uint64_t i = 0 ; i < count ; i++ ) {
+        sink = sink + (a > b);
+    }
+    report((what = std::string(name) + " compare").c_str(), nsPerOp(start, count));
+
+    start = std::chrono::steady_clock::now();
+    for ( uint64_t i = 0 ; i < count ; i++ ) {
+        sink = sink + a.toString().length();
+    }
+    report((what = std::string(name) + " toString").c_str(), nsPerOp(start, count));
+}
+
+bool coreTestUnitAlgebraBenchComponent::tick( Cycle_t )
+{
+    /* Correctness */
+    UnitAlgebra freq("1GHz");
+    UnitAlgebra bw("64B/ns");
+    UnitAlgebra size("4KiB");
+    check("1GHz", freq.toStringBestSI(), "1 GHz");
+    check("64B/ns", bw.toStringBestSI(), "64 GB/s");
+    check("4KiB / 64B/ns", (size / bw).toStringBestSI(), "64 ns");
+    check("64B/ns * 2.5ns", (bw * UnitAlgebra("2.5ns")).toStringBestSI(), "160 B");
+    check("1/1GHz", UnitAlgebra(freq).invert().toStringBestSI(), "1 ns");
+    check("3 * 1GHz", (freq * 3).toStringBestSI(), "3 GHz");
+    check("2.5ns cycles", std::to_string(getTimeConverter(UnitAlgebra("2.5ns"))->getFactor()), "2500");
+    check("1GHz cycles", std::to_string(getTimeConverter(freq)->getFactor()), "1000");
+    check("4KiB / 64B/ns cycles", std::to_string(getTimeConverter(size / bw)->getFactor()), "64000");
+
+    /* Timing */
+    volatile uint64_t sink = 0;
+
+    auto start = std::chrono::steady_clock::now();
+    for ( uint64_t i = 0 ; i < count ; i++ ) {
+        UnitAlgebra ua("64B/ns");
+        sink = sink + ua.isValueZero();
+    }
+    report("parse 64B/ns", nsPerOp(start, count));
+
+    start = std::chrono::steady_clock::now();
+    for ( uint64_t i = 0 ; i < count ; i++ ) {
+        UnitAlgebra ua("1GHz");
+        sink = sink + ua.isValueZero();
+    }
+    report("parse 1GHz", nsPerOp(start, count));
+
+    start = std::chrono::steady_clock::now();
+    for ( uint64_t i = 0 ; i < count ; i++ ) {
+        UnitAlgebra delay = size / bw;
+        sink = sink + delay.isValueZero();
+    }
+    report("size / bandwidth", nsPerOp(start, count));
+
+    start = std::chrono::steady_clock::now();
+    for ( uint64_t i = 0 ; i < count ; i++ ) {
+        UnitAlgebra bytes = bw * freq.invert();
+        sink = sink + bytes.isValueZero();
+    }
+    report("bandwidth * time", nsPerOp(start, count));
+
+    start = std::chrono::steady_clock::now();
+    for ( uint64_t i = 0 ; i < count ; i++ ) {
+        sink = sink + (size / bw == size / bw);
+    }
+    report("compare", nsPerOp(start, count));
+
+    UnitAlgebra delay = size / bw;
+    start = std::chrono::steady_clock::now();
+    for ( uint64_t i = 0 ; i < count ; i++ ) {
+        sink = sink + getTimeConverter(delay)->getFactor();
+    }
+    report("to core cycles", nsPerOp(start, count));
+
+    start = std::chrono::steady_clock::now();
+    for ( uint64_t i = 0 ; i < count ; i++ ) {
+        sink = sink + delay.getRoundedValue();
+    }
+    report("getRoundedValue", nsPerOp(start, count));
+
+    /* Fixed point types */
+    compareFixedPoint();
+    benchFixedPoint<decimal_fixedpoint<3,3> >("decimal");
+    benchFixedPoint<binary_fixedpoint<3,3> >("binary");
+
+    primaryComponentOKToEndSim();
+    return true;
+}
@@ -0,0 +1,90 @@
+// Copyright 2009-2020 NTESS. Under the terms
+// of Contract DE-NA0003525 with NTESS, the U.S.
+// Government retains certain rights in this software.
+//
+// Copyright (c) 2009-2020, NTESS
+// All rights reserved.
+//
+// Portions are copyright of other developers:
+// See the file CONTRIBUTORS.TXT in the top level directory
+// the distribution for more information.
+//
+// This file is part of the SST software package. For license
+// information, see the LICENSE file in the top level directory of the
+// distribution.
+
+#ifndef _CORETESTUNITALGEBRABENCHCOMPONENT_H
+#define _CORETESTUNITALGEBRABENCHCOMPONENT_H
+
+#include "sst/core/component.h"
+
+using namespace SST;
+
+namespace SST {
+namespace CoreTestUnitAlgebraBenchComponent {
+
+/**
+ * Measures the cost of the UnitAlgebra operations components use on
+ * their hot paths (parsing literals, bandwidth and delay arithmetic,
+ * conversion to core cycles) and checks their results.  Also compares
+ * the binary and decimal fixed-point types behind sst_big_num.
+ */
+class coreTestUnitAlgebraBenchComponent : public SST::Component
+{
+public:
+
+    // REGISTER THIS COMPONENT INTO THE ELEMENT LIBRARY
+    SST_ELI_REGISTER_COMPONENT(
+        coreTestUnitAlgebraBenchComponent,
+        "coreTestElement",
+        "coreTestUnitAlgebraBenchComponent",
+        SST_ELI_ELEMENT_VERSION(1,0,0),
+        "UnitAlgebra benchmark component",
+        COMPONENT_CATEGORY_UNCATEGORIZED
+    )
+
+    SST_ELI_DOCUMENT_PARAMS(
+        { "count",   "The number of operations per measurement", "100000" },
+        { "timing",  "Report timings (set to 0 to only report correctness results)", "1" }
+    )
+
+    // Optional since there is nothing to document
+    SST_ELI_DOCUMENT_STATISTICS(
+    )
+
+    // Optional since there is nothing to document
+    SST_ELI_DOCUMENT_PORTS(
+    )
+
+    // Optional since there is nothing to document
+    SST_ELI_DOCUMENT_SUBCOMPONENT_SLOTS(
+    )
+
+    coreTestUnitAlgebraBenchComponent(SST::ComponentId_t id, SST::Params& params);
+    ~coreTestUnitAlgebraBenchComponent();
+    void setup()  { }
+    void finish() { }
+
+private:
+    coreTestUnitAlgebraBenchComponent();  // for serialization only
+    coreTestUnitAlgebraBenchComponent(const coreTestUnitAlgebraBenchComponent&); // do not implement
+    void operator=(const coreTestUnitAlgebraBenchComponent&); // do not implement
+
+    virtual bool tick(SST::Cycle_t);
+
+    void check(const char* what, const std::string& result, const char* expected);
+    void report(const char* what, double ns);
+
+    void compareFixedPoint();
+    template <typename T>
+    void benchFixedPoint(const char* name);
+
+    Output* output;
+    uint64_t count;
+    bool timing;
+};
+
+} // namespace CoreTestUnitAlgebraBenchComponent
+} // namespace SST
+
+#endif /* _CORETESTUNITALGEBRABENCHCOMPONENT_H */
@@ -25,6 +25,7 @@
 #include <thread>
 #include <atomic>
 #include <condition_variable>
+#include <functional>
 #include <mutex>
 
 #include <vector>
@@ -146,6 +147,60 @@ public:
 
 
 
+/*
+ * Insert-only hash table with lock-free lookups.  Entries are
+ * published with a release store and are never removed while the
+ * table exists, so readers take no lock.  Inserts must be serialized
+ * by the caller.
+ */
+template<typename Key, typename T, size_t num_buckets = 256>
+class InsertOnlyHashMap {
+    struct Node {
+        Key key;
+        T value;
+        Node* next;
+    };
+    std::atomic<Node*> buckets[num_buckets];
+    size_t count;
+
+    static size_t bucket(const Key& key) { return std::hash<Key>()(key) % num_buckets; }
+
+public:
+    InsertOnlyHashMap() : count(0) {
+        for ( auto& b : buckets ) b.store(nullptr, std::memory_order_relaxed);
+    }
+
+    ~InsertOnlyHashMap() {
+        for ( auto& b : buckets ) {
+            Node* n = b.load(std::memory_order_relaxed);
+            while ( n ) {
+                Node* next = n->next;
+                delete n;
+                n = next;
+            }
+        }
+    }
+
+    /** Returns the value for key, or nullptr if it is not in the table */
+    const T* find(const Key& key) const {
+        for ( Node* n = buckets[bucket(key)].load(std::memory_order_acquire); n != nullptr; n = n->next ) {
+            if ( n->key == key ) return &n->value;
+        }
+        return nullptr;
+    }
+
+    /** Add an entry.  The caller must hold a lock and have checked that key is not present. */
+    void insert(const Key& key, const T& value) {
+        std::atomic<Node*>& b = buckets[bucket(key)];
+        b.store(new Node{key, value, b.load(std::memory_order_relaxed)}, std::memory_order_release);
+        count++;
+    }
+
+    /** Number of entries.  Only meaningful while holding the insert lock. */
+    size_t size() const { return count; }
+};
+
+
 template<typename T>
 class BoundedQueue {
 
@@ -28,43 +28,60 @@ using Core::ThreadSafe::Spinlock;
 
 TimeConverter* TimeLord::getTimeConverter(const std::string& ts) {
     // See if this is in the cache
-    std::lock_guard<std::recursive_mutex> lock(slock);
-    if ( parseCache.find(ts) == parseCache.end() ) {
-        TimeConverter* tc = getTimeConverter(UnitAlgebra(ts));
-        parseCache[ts] = tc;
-        return tc;
+    TimeConverter* const* cached = parseCache.find(ts);
+    if ( nullptr != cached ) return *cached;
+
+    // Parse outside the lock; only the insert is serialized
+    SimTime_t simCycles = getFactor(UnitAlgebra(ts));
+    std::lock_guard<std::mutex> lock(slock);
+    cached = parseCache.find(ts);
+    if ( nullptr != cached ) return *cached;
+
+    cached = tcMap.find(simCycles);
+    TimeConverter* tc = cached ? *cached : nullptr;
+    if ( nullptr == tc ) {
+        tc = new TimeConverter(simCycles);
+        tcList.push_back(tc);
+        tcMap.insert(simCycles, tc);
     }
-    return parseCache[ts];
+    parseCache.insert(ts, tc);
+    return tc;
 }
 
 TimeConverter* TimeLord::getTimeConverter(SimTime_t simCycles) {
     // Check to see if we already have a TimeConverter with this value
-    std::lock_guard<std::recursive_mutex> lock(slock);
-    if ( tcMap.find(simCycles) == tcMap.end() ) {
-        TimeConverter *tc = new TimeConverter(simCycles);
-        tcMap[simCycles] = tc;
-        return tc;
-    }
-    return tcMap[simCycles];
+    TimeConverter* const* cached = tcMap.find(simCycles);
+    if ( nullptr != cached ) return *cached;
+
+    std::lock_guard<std::mutex> lock(slock);
+    cached = tcMap.find(simCycles);
+    if ( nullptr != cached ) return *cached;
+
+    TimeConverter* tc = new TimeConverter(simCycles);
+    tcList.push_back(tc);
+    tcMap.insert(simCycles, tc);
+    return tc;
 }
 
 TimeConverter* TimeLord::getTimeConverter(const UnitAlgebra& ts) {
+    return getTimeConverter(getFactor(ts));
+}
+
+SimTime_t TimeLord::getFactor(const UnitAlgebra& ts) const {
     Output &abort = Output::getDefaultObject();
     if ( !initialized ) {
         abort.fatal(CALL_INFO, 1, "Time Lord has not yet been initialized!");
     }
-    SimTime_t simCycles;
-    UnitAlgebra period = ts;
     UnitAlgebra uaFactor;
     // Need to differentiate between Hz and s.
-    if ( period.hasUnits("s") ) {
+    if ( ts.hasSameUnits(seconds) ) {
         // simCycles = (period / timeBase).getRoundedValue();
-        uaFactor = period / timeBase;
+        if ( invTimeBaseExact ) uaFactor = ts * invTimeBase;
+        else uaFactor = ts / timeBase;
     }
-    else if ( period.hasUnits("Hz") ) {
-        UnitAlgebra temp = timeBase;
-        // simCycles = (temp.invert() / period).getRoundedValue();
-        uaFactor = temp.invert() / period;
+    else if ( ts.hasSameUnits(hertz) ) {
+        // simCycles = (1 / timeBase / period).getRoundedValue();
+        uaFactor = invTimeBase / ts;
     }
     else {
         abort.fatal(CALL_INFO,1,"Error:  TimeConverter creation requires "
@@ -83,9 +100,7 @@ TimeConverter* TimeLord::getTimeConverter(const UnitAlgebra& ts) {
                     "which has too small of a period to be represented by the timebase (%s)\n",
                     ts.toStringBestSI().c_str(),timeBase.toStringBestSI().c_str());
     }
-    simCycles = uaFactor.getRoundedValue();
-    TimeConverter* tc = getTimeConverter(simCycles);
-    return tc;
+    return uaFactor.getRoundedValue();
 }
 
 void TimeLord::init(const std::string& _timeBaseString)
@@ -94,33 +109,29 @@ void TimeLord::init(const std::string& _timeBaseString)
     timeBaseString = _timeBaseString;
     timeBase = UnitAlgebra(timeBaseString);
 
+    seconds = UnitAlgebra("1s");
+    hertz = UnitAlgebra("1Hz");
+    invTimeBase = timeBase;
+    invTimeBase.invert();
+    invTimeBaseExact = ( (invTimeBase * timeBase).getValue() == 1 );
+
     nano = getTimeConverter("1ns");
     micro = getTimeConverter("1us");
     milli = getTimeConverter("1ms");
 }
 
 TimeLord::~TimeLord() {
-    // Delete all the TimeConverter objects
-    std::map<ComponentId_t,LinkMap*>::iterator it;
-    for ( TimeConverterMap_t::iterator it = tcMap.begin(); it != tcMap.end(); ++it ) {
-        delete it->second;
+    // Delete all the TimeConverter objects; the caches free their own
+    // entries
+    for ( TimeConverter* tc : tcList ) {
+        delete tc;
     }
-    tcMap.clear();
-
-    // Clear the contents of the cache
-    parseCache.clear();
+    tcList.clear();
 }
 
 SimTime_t TimeLord::getSimCycles(const std::string& ts, const std::string& UNUSED(where))
 {
-    // See if this is in the cache
-    std::lock_guard<std::recursive_mutex> lock(slock);
-    if ( parseCache.find(ts) == parseCache.end() ) {
-        TimeConverter* tc = getTimeConverter(UnitAlgebra(ts));
-        parseCache[ts] = tc;
-        return tc->getFactor();
-    }
-    return parseCache[ts]->getFactor();
+    return getTimeConverter(ts)->getFactor();
 }
 
 } // namespace SST
@@ -16,8 +16,8 @@
 
 #include "sst/core/sst_types.h"
 
-#include <map>
 #include <string>
+#include <vector>
 
 #include "sst/core/simulation.h"
 #include "sst/core/unitAlgebra.h"
@@ -34,9 +34,6 @@ class UnitAlgebra;
       Class for creating and managing TimeConverter objects
    */
 class TimeLord {
-    typedef std::map<SimTime_t,TimeConverter*> TimeConverterMap_t;
-    typedef std::map<std::string,TimeConverter*> StringToTCMap_t;
-
  public:
   /**
       Create a new TimeConverter object using specified SI Units. For
@@ -85,6 +82,9 @@ class TimeLord {
     // TimeConverter object.
     TimeConverter *getTimeConverter(SimTime_t simCycles);
 
+    // Number of core cycles in a period or frequency
+    SimTime_t getFactor(const UnitAlgebra& ts) const;
+
     TimeLord() : initialized(false) { }
     ~TimeLord();
 
@@ -92,15 +92,25 @@ class TimeLord {
     void operator=(TimeLord const&);    // Don't Implement
 
     bool initialized;
-    std::recursive_mutex slock;
+    // Only taken to add a new TimeConverter or string
+    std::mutex slock;
 
     // Variables that need to be saved when serialized
     std::string timeBaseString;
-    TimeConverterMap_t tcMap;
     UnitAlgebra timeBase;
 
-    // double sec_factor;
-    StringToTCMap_t parseCache;
+    // Precomputed for getFactor(): the units it accepts, and 1/timeBase
+    // when it is exact so that a period converts with one multiply
+    UnitAlgebra seconds;
+    UnitAlgebra hertz;
+    UnitAlgebra invTimeBase;
+    bool invTimeBaseExact;
+
+    // Every TimeConverter, found by factor and by the strings that
+    // have been parsed to it
+    std::vector<TimeConverter*> tcList;
+    Core::ThreadSafe::InsertOnlyHashMap<SimTime_t, TimeConverter*> tcMap;
+    Core::ThreadSafe::InsertOnlyHashMap<std::string, TimeConverter*> parseCache;
 
     TimeConverter* nano;
     TimeConverter* micro;
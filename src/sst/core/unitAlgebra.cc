@@ -24,20 +24,6 @@ using namespace std;
 using namespace SST;
 
 // Helper functions and data structures used only in this file
-static void split(const std::string& input, const std::string& delims, vector<string>& tokens) {
-    if ( input.length() == 0 ) return;
-    size_t start = 0;
-    size_t stop = 0;;
-    vector<string> ret;
-
-    do {
-        stop = input.find_first_of(delims,start);
-        tokens.push_back(input.substr(start,stop-start));
-        start = stop + 1;
-    } while (stop != string::npos);
-}
-
-
 static map<string,sst_big_num> si_unit_map = {
     {"a",sst_big_num("1e-18")},
     {"f",sst_big_num("1e-15")},
@@ -61,10 +47,78 @@ static map<string,sst_big_num> si_unit_map = {
     {"Ei",sst_big_num(1024l*1024l*1024l*1024l*1024l*1024l)}
 };
 
+// Returns the length of the SI prefix at the front of units (0 if
+// there is none) and its value
+static int si_prefix(const char* units, size_t len, const sst_big_num*& value)
+{
+    static const sst_big_num atto("1e-18"), femto("1e-15"), pico("1e-12"), nano("1e-9"),
+        micro("1e-6"), milli("1e-3"), kilo("1e3"), mega("1e6"), giga("1e9"), tera("1e12"),
+        peta("1e15"), exa("1e18");
+    static const sst_big_num kibi(1024l), mebi(1024l*1024l), gibi(1024l*1024l*1024l),
+        tebi(1024l*1024l*1024l*1024l), pebi(1024l*1024l*1024l*1024l*1024l),
+        exbi(1024l*1024l*1024l*1024l*1024l*1024l);
+
+    if ( len == 0 ) return 0;
+    bool binary = ( len > 1 && units[1] == 'i' );
+    switch ( units[0] ) {
+    case 'a': value = &atto; return 1;
+    case 'f': value = &femto; return 1;
+    case 'p': value = &pico; return 1;
+    case 'n': value = &nano; return 1;
+    case 'u': value = &micro; return 1;
+    case 'm': value = &milli; return 1;
+    case 'k':
+    case 'K': value = binary ? &kibi : &kilo; break;
+    case 'M': value = binary ? &mebi : &mega; break;
+    case 'G': value = binary ? &gibi : &giga; break;
+    case 'T': value = binary ? &tebi : &tera; break;
+    case 'P': value = binary ? &pebi : &peta; break;
+    case 'E': value = binary ? &exbi : &exa; break;
+    default: return 0;
+    }
+    return binary ? 2 : 1;
+}
+
+// Parsed unit strings.  Programs use a small set of unit strings over
+// and over, so this is bounded rather than evicting.
+typedef Core::ThreadSafe::InsertOnlyHashMap<string, pair<Units,sst_big_num> > unit_cache_t;
+static const size_t max_cached_units = 1024;
+
+static unit_cache_t& unit_cache()
+{
+    static unit_cache_t cache;
+    return cache;
+}
 
 
 // Class Units
 
+void
+Units::UnitList::insert(unit_id_t id)
+{
+    if ( len == max_units ) {
+        Output abort = Output::getDefaultObject();
+        abort.fatal(CALL_INFO,1,"Error: unit has more than %d terms\n", max_units);
+    }
+    int i = len++;
+    for ( ; i > 0 && ids[i-1] > id; i-- ) ids[i] = ids[i-1];
+    ids[i] = id;
+}
+
+void
+Units::UnitList::merge(const UnitList& a, const UnitList& b)
+{
+    if ( a.len + b.len > max_units ) {
+        Output abort = Output::getDefaultObject();
+        abort.fatal(CALL_INFO,1,"Error: unit has more than %d terms\n", max_units);
+    }
+    int i = 0, j = 0, k = 0;
+    while ( i < a.len && j < b.len ) ids[k++] = ( b.ids[j] < a.ids[i] ) ? b.ids[j++] : a.ids[i++];
+    while ( i < a.len ) ids[k++] = a.ids[i++];
+    while ( j < b.len ) ids[k++] = b.ids[j++];
+    len = k;
+}
+
 std::recursive_mutex Units::unit_lock;
 map<string,Units::unit_id_t> Units::valid_base_units;
 map<string,pair<Units,sst_big_num> > Units::valid_compound_units;
@@ -95,88 +149,68 @@ Units::initialize()
 void
 Units::reduce()
 {
-    // Sort both vectors
-    sort(numerator.begin(),numerator.end());
-    sort(denominator.begin(),denominator.end());
-
-    vector<unit_id_t>::iterator n, d;
-    n = numerator.begin();
-    d = denominator.begin();
-
-    while ( n != numerator.end() && d != denominator.end() ) {
-        // cout << *n << "," << *d << endl;
-        if ( *n == *d ) {
-            n = numerator.erase(n);
-            d = denominator.erase(d);
+    // Both lists are sorted, so cancel matching ids in one pass
+    int n = 0, d = 0;
+    int n_out = 0, d_out = 0;
+    while ( n < numerator.len && d < denominator.len ) {
+        if ( numerator.ids[n] == denominator.ids[d] ) {
+            n++;
+            d++;
+        }
+        else if ( numerator.ids[n] > denominator.ids[d] ) {
+            denominator.ids[d_out++] = denominator.ids[d++];
         }
         else {
-            if ( *n > *d ) ++d;
-            else ++n;
+            numerator.ids[n_out++] = numerator.ids[n++];
         }
     }
+    while ( n < numerator.len ) numerator.ids[n_out++] = numerator.ids[n++];
+    while ( d < denominator.len ) denominator.ids[d_out++] = denominator.ids[d++];
+    numerator.len = n_out;
+    denominator.len = d_out;
 }
 
 void
-Units::addUnit(const std::string& units, sst_big_num& multiplier, bool invert)
+Units::addUnit(const char* units, size_t len, sst_big_num& multiplier, bool invert)
 {
-    std::lock_guard<std::recursive_mutex> lock(unit_lock);
     // Check to see if the unit matches one of the registered unit
     // names.  If not, check for SI units and strip them, then check
     // again.
+    string type(units, len);
     int si_length = 0;
-    if ( valid_base_units.find(units) == valid_base_units.end() &&
-         valid_compound_units.find(units) == valid_compound_units.end() ) {
+    if ( valid_base_units.find(type) == valid_base_units.end() &&
+         valid_compound_units.find(type) == valid_compound_units.end() ) {
         // Now get the si prefix
-        switch ( units[0] ) {
-        case 'a':
-        case 'f':
-        case 'p':
-        case 'n':
-        case 'u':
-        case 'm':
-            si_length = 1;
-            break;
-        case 'k':
-        case 'K':
-        case 'M':
-        case 'G':
-        case 'T':
-        case 'P':
-        case 'E':
-            if ( units[1] == 'i' ) si_length = 2;
-            else si_length = 1;
-            break;
-        default:
-            si_length = 0;
-            break;
+        const sst_big_num* si_mult = nullptr;
+        si_length = si_prefix(units, len, si_mult);
+        if ( si_length > 0 ) {
+            if ( !invert ) multiplier *= *si_mult;
+            else multiplier /= *si_mult;
+            type.erase(0, si_length);
         }
     }
 
-    if ( si_length > 0 ) {
-        string si_unit = units.substr(0,si_length);
-        multiplier *= si_unit_map[si_unit];
-    }
-
     // Check to see if the unit is valid and get it's ID
-    string type = units.substr(si_length);
-    if ( valid_base_units.find(type) != valid_base_units.end() ) {
+    auto base = valid_base_units.find(type);
+    if ( base != valid_base_units.end() ) {
         if ( !invert ) {
-            numerator.push_back(valid_base_units[type]);
+            numerator.insert(base->second);
         }
         else {
-            denominator.push_back(valid_base_units[type]);
+            denominator.insert(base->second);
         }
+        return;
     }
     // Check to see if this is a compound unit
-    else if ( valid_compound_units.find(type) != valid_compound_units.end() ) {
-        pair<Units,sst_big_num> units = valid_compound_units[type];
+    auto compound = valid_compound_units.find(type);
+    if ( compound != valid_compound_units.end() ) {
         if ( !invert ) {
-            *this *= units.first;
-            multiplier *= units.second;
+            *this *= compound->second.first;
+            multiplier *= compound->second.second;
         }
         else {
-            *this /= units.first;
-            multiplier /= units.second;
+            *this /= compound->second.first;
+            multiplier /= compound->second.second;
         }
     }
     // Special case:
@@ -206,56 +240,72 @@ Units::registerCompoundUnit(const std::string& u, const std::string& v)
     std::lock_guard<std::recursive_mutex> lock(unit_lock);
     if ( valid_compound_units.find(u) != valid_compound_units.end() ) return;
     sst_big_num multiplier = 1;
-    Units unit(v,multiplier);
+    Units unit;
+    unit.parse(v,multiplier);
     valid_compound_units[u] = std::pair<Units,sst_big_num>(unit,multiplier);
     return;
 }
 
-Units::Units(const std::string& units, sst_big_num& multiplier)
+void
+Units::parse(const std::string& units, sst_big_num& multiplier)
 {
-    // Get the numerator and the denominator
-    string s_numerator;
-    string s_denominator;
-
-    size_t slash_index = units.find_first_of('/');
-
-    s_numerator = units.substr(0,slash_index);
-    if ( slash_index != string::npos ) s_denominator = units.substr(slash_index+1);
+    std::lock_guard<std::recursive_mutex> lock(unit_lock);
 
-    // Have numerator and denominator, now split each of those into
-    // individual units, which will be separated with '-'
-    // cout << "Numerator: " << s_numerator << endl;
-    vector<string> tokens;
-    split(s_numerator, "-", tokens);
+    // Units before the '/' are in the numerator, the rest in the
+    // denominator.  Individual units are separated with '-'.
+    const char* str = units.c_str();
+    auto add_group = [&](size_t start, size_t end, bool invert) {
+        if ( start >= end ) return;
+        for ( size_t i = start; i <= end; i++ ) {
+            if ( i == end || str[i] == '-' ) {
+                addUnit(str + start, i - start, multiplier, invert);
+                start = i + 1;
+            }
+        }
+    };
 
-    // Add all the numerators
-    for ( unsigned int i = 0; i < tokens.size(); i++ ) {
-        addUnit(tokens[i], multiplier, false);
+    size_t slash_index = units.find_first_of('/');
+    if ( slash_index == string::npos ) {
+        add_group(0, units.length(), false);
     }
-    tokens.clear();
-    split(s_denominator, "-", tokens);
-
-    // Add all the denominators
-    for ( unsigned int i = 0; i < tokens.size(); i++ ) {
-        addUnit(tokens[i], multiplier, true);
+    else {
+        add_group(0, slash_index, false);
+        add_group(slash_index + 1, units.length(), true);
     }
     reduce();
-
 }
 
-Units&
-Units::operator= (const Units& v) {
-    numerator = v.numerator;
-    denominator = v.denominator;
-    return *this;
+Units::Units(const std::string& units, sst_big_num& multiplier)
+{
+    // Unit strings registered after a string was cached do not change
+    // how it parses; registration only happens at start-up.
+    static const sst_big_num one(1);
+    const pair<Units,sst_big_num>* cached = unit_cache().find(units);
+    if ( cached ) {
+        *this = cached->first;
+        if ( cached->second != one ) multiplier *= cached->second;
+        return;
+    }
+
+    sst_big_num mult(1);
+    parse(units, mult);
+    if ( mult != one ) multiplier *= mult;
+
+    std::lock_guard<std::recursive_mutex> lock(unit_lock);
+    if ( unit_cache().size() < max_cached_units && !unit_cache().find(units) ) {
+        unit_cache().insert(units, pair<Units,sst_big_num>(*this, mult));
+    }
 }
 
 Units&
 Units::operator*= (const Units& v) {
 
     // Simply combine the two numerators and denominators, then reduce.
-    numerator.insert(numerator.end(),v.numerator.begin(),v.numerator.end());
-    denominator.insert(denominator.end(),v.denominator.begin(),v.denominator.end());
+    UnitList n, d;
+    n.merge(numerator, v.numerator);
+    d.merge(denominator, v.denominator);
+    numerator = n;
+    denominator = d;
     reduce();
     return *this;
 }
@@ -263,8 +313,11 @@ Units::operator*= (const Units& v) {
 Units&
 Units::operator/= (const Units& v)
 {
-    numerator.insert(numerator.end(),v.denominator.begin(),v.denominator.end());
-    denominator.insert(denominator.end(),v.numerator.begin(),v.numerator.end());
+    UnitList n, d;
+    n.merge(numerator, v.denominator);
+    d.merge(denominator, v.numerator);
+    numerator = n;
+    denominator = d;
     reduce();
     return *this;
 }
@@ -272,23 +325,13 @@ Units::operator/= (const Units& v)
 bool
 Units::operator== (const Units &lhs) const
 {
-    if ( numerator.size() != lhs.numerator.size() ) return false;
-    if ( denominator.size() != lhs.denominator.size() ) return false;
-    for ( unsigned int i = 0; i < numerator.size(); i++ ) {
-        if ( numerator[i] != lhs.numerator[i] ) return false;
-    }
-    for ( unsigned int i = 0; i < denominator.size(); i++ ) {
-        if ( denominator[i] != lhs.denominator[i] ) return false;
-    }
-    return true;
+    return numerator == lhs.numerator && denominator == lhs.denominator;
 }
 
 Units&
 Units::invert()
 {
-    std::vector<unit_id_t> temp = denominator;
-    denominator = numerator;
-    numerator = temp;
+    std::swap(numerator, denominator);
     return *this;
 }
 
@@ -306,7 +349,7 @@ Units::toString() const
     if ( numerator.size() == 0 ) ret.append("1");
     else {
         ret.append(unit_strings[numerator[0]]);
-        for ( unsigned int i = 1; i < numerator.size(); i++ ) {
+        for ( int i = 1; i < numerator.size(); i++ ) {
             ret.append("-");
             ret.append(unit_strings[numerator[i]]);
         }
@@ -315,7 +358,7 @@ Units::toString() const
     if ( denominator.size() != 0 ) {
         ret.append("/");
         ret.append(unit_strings[denominator[0]]);
-        for ( unsigned int i = 1; i < denominator.size(); i++ ) {
+        for ( int i = 1; i < denominator.size(); i++ ) {
             ret.append("-");
             ret.append(unit_strings[denominator[i]]);
         }
@@ -370,7 +413,7 @@ UnitAlgebra::init(const std::string& val)
         abort.fatal(CALL_INFO,1,"Error: invalid number string: %s\n",number.c_str());
     }
 
-    value *= multiplier;
+    if ( multiplier != 1 ) value *= multiplier;
 }
 
 
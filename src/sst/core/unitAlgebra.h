@@ -24,13 +24,17 @@
 #include <mutex>
 
 #include "sst/core/warnmacros.h"
+#include "sst/core/binary_fixedpoint.h"
 #include "sst/core/decimal_fixedpoint.h"
 
 
 namespace SST {
 
 // typedef decimal_fixedpoint<3,3> sst_dec_float;
-typedef decimal_fixedpoint<3,3> sst_big_num;
+// binary_fixedpoint holds the same values as decimal_fixedpoint with
+// faster arithmetic; the decimal version is the reference for it
+// typedef decimal_fixedpoint<3,3> sst_big_num;
+typedef binary_fixedpoint<3,3> sst_big_num;
 
 /**
  * Helper class internal to UnitAlgebra.
@@ -41,6 +45,44 @@ class Units {
 
     typedef uint8_t unit_id_t;
 
+    /**
+     * Sorted list of unit ids with a fixed capacity, so that unit
+     * arithmetic never allocates.  Real units have at most a handful
+     * of terms; exceeding the capacity is a fatal error.
+     */
+    class UnitList {
+    public:
+        static const int max_units = 8;
+
+        UnitList() : len(0) {}
+
+        int size() const { return len; }
+        unit_id_t operator[](int i) const { return ids[i]; }
+
+        /** Insert an id, keeping the list sorted */
+        void insert(unit_id_t id);
+        /** Replace the contents with the sorted merge of a and b */
+        void merge(const UnitList& a, const UnitList& b);
+
+        bool operator==(const UnitList& v) const {
+            if ( len != v.len ) return false;
+            for ( int i = 0; i < len; i++ ) {
+                if ( ids[i] != v.ids[i] ) return false;
+            }
+            return true;
+        }
+
+        void serialize_order(SST::Core::Serialization::serializer &ser) {
+            ser & len;
+            for ( int i = 0; i < len; i++ ) ser & ids[i];
+        }
+
+    private:
+        friend class Units;
+        unit_id_t ids[max_units];
+        uint8_t len;
+    };
+
 private:
     friend class UnitAlgebra;
 
@@ -55,12 +97,14 @@ private:
     static bool initialize();
 
     // Non-static data members and functions
-    std::vector<unit_id_t> numerator;
-    std::vector<unit_id_t> denominator;
+    UnitList numerator;
+    UnitList denominator;
 
     void reduce();
     // Used in constructor to incrementally build up unit from string
-    void addUnit(const std::string&, sst_big_num& multiplier, bool invert);
+    void addUnit(const char* units, size_t len, sst_big_num& multiplier, bool invert);
+    // Parse a unit string without consulting the cache
+    void parse(const std::string& units, sst_big_num& multiplier);
 
 public:
     // Static data members and functions
@@ -76,13 +120,13 @@ public:
      */
     Units(const std::string& units, sst_big_num& multiplier);
     Units() {}
-    virtual ~Units() {}
+    ~Units() {}
 
     /** Copy constructor */
     Units(const Units&) = default;
 
     /** Assignment operator */
-    Units& operator= (const Units& v);
+    Units& operator= (const Units& v) = default;
     /** Self-multiplication operator */
     Units& operator*= (const Units& v);
     /** Self-division operator */
@@ -207,6 +251,8 @@ public:
      * in this object.
      */
     bool hasUnits(const std::string& u) const;
+    /** Returns true if this object has the same units as v */
+    bool hasSameUnits(const UnitAlgebra& v) const { return unit == v.unit; }
     /** Return the raw value */
     sst_big_num getValue() const {return value;}
     /** Return the rounded value as a 64bit integer */
@@ -216,8 +262,8 @@ public:
     
     void serialize_order(SST::Core::Serialization::serializer &ser) override {
         // Do the unit
-        ser & unit.numerator;
-        ser & unit.denominator;
+        unit.numerator.serialize_order(ser);
+        unit.denominator.serialize_order(ser);
 
         // For value, need to convert cpp_dec_float to string and
         // reinit from string
@@ -0,0 +1,136 @@
+# Synthetic benchmarks for the core event engine.  Run with:
+#
+#   sst bench_core.py --model-options="<scenario> [key=value ...]"
+#
+# Scenarios:
+#   pingpong  - chains of components bouncing events back and forth
+#   torus     - 2D torus forwarding events to random neighbors
+#   clockgrid - grid of mostly idle components running only clocks
+#   fanout    - roots broadcasting an event to all their leaves every tick
+#   polling   - ring of clocked components exchanging events over polling links
+#
+# Common options:
+#   scale=N     multiply the number of components (default 1)
+#   stop=TIME   simulated time to run for (default 100us)
+#   latency=T   link latency (default 1ns)
+#   payload=B   bytes carried by each event (default 0)
+#
+# See each scenario below for its own options.
+import sys
+import sst
+
+scenario = "pingpong"
+opts = {}
+for arg in sys.argv[1:]:
+    if "=" in arg:
+        key, value = arg.split("=", 1)
+        opts[key] = value
+    else:
+        scenario = arg
+
+def opt(key, default):
+    return type(default)(opts.get(key, default))
+
+scale = opt("scale", 1)
+latency = opt("latency", "1ns")
+payload = opt("payload", 0)
+
+sst.setProgramOption("timebase", "1 ps")
+sst.setProgramOption("stopAtCycle", opt("stop", "100us"))
+
+def perf(name, params):
+    comp = sst.Component(name, "coreTestElement.coreTestPerfComponent")
+    params["payload"] = payload
+    comp.addParams(params)
+    return comp
+
+def connect(name, comp0, port0, comp1, port1):
+    link = sst.Link(name)
+    link.connect((comp0, "port%d" % port0, latency), (comp1, "port%d" % port1, latency))
+
+if scenario == "pingpong":
+    # chains=N length=L events=E: each component starts E events on
+    # each of its links and replies to everything it receives
+    chains = opt("chains", 64) * scale
+    length = opt("length", 2)
+    events = opt("events", 16)
+    for c in range(chains):
+        comps = [perf("pp_%d_%d" % (c, i), {"num_ports" : 2, "initial_events" : events, "forward" : "reply"})
+                 for i in range(length)]
+        for i in range(length - 1):
+            connect("pp_%d_%d" % (c, i), comps[i], 0, comps[i + 1], 1)
+
+elif scenario == "torus":
+    # x=X y=Y events=E: X by Y torus, each component starts E events
+    # and forwards everything to a random neighbor.  bulk=1 builds the
+    # same torus, with the same params, using sst.addComponents() and
+    # sst.connectComponents()
+    x = opt("x", 16)
+    y = opt("y", 16) * scale
+    events = opt("events", 4)
+    params = {"num_ports" : 4, "initial_events" : events, "forward" : "random", "payload" : payload}
+    if opt("bulk", 0):
+        first = sst.addComponents("t_", "coreTestElement.coreTestPerfComponent", x * y, params)
+        here = [first + i * y + j for i in range(x) for j in range(y)]
+        east = [first + ((i + 1) % x) * y + j for i in range(x) for j in range(y)]
+        north = [first + i * y + (j + 1) % y for i in range(x) for j in range(y)]
+        sst.connectComponents("t_e_", here, "port0", east, "port1", latency)
+        sst.connectComponents("t_n_", here, "port2", north, "port3", latency)
+    else:
+        comps = {}
+        for i in range(x):
+            for j in range(y):
+                comps[(i, j)] = perf("t_%d_%d" % (i, j), dict(params))
+        for i in range(x):
+            for j in range(y):
+                # port0 = east, port1 = west, port2 = north, port3 = south
+                connect("t_%d_%d_e" % (i, j), comps[(i, j)], 0, comps[((i + 1) % x, j)], 1)
+                connect("t_%d_%d_n" % (i, j), comps[(i, j)], 2, comps[(i, (j + 1) % y)], 3)
+
+elif scenario == "clockgrid":
+    # x=X y=Y clock=FREQ: X by Y mesh of components that only run
+    # clocks; the links carry no traffic
+    x = opt("x", 32)
+    y = opt("y", 32) * scale
+    clock = opt("clock", "1GHz")
+    comps = {}
+    for i in range(x):
+        for j in range(y):
+            comps[(i, j)] = perf("g_%d_%d" % (i, j), {"num_ports" : 4, "clock" : clock})
+    for i in range(x):
+        for j in range(y):
+            if i + 1 < x:
+                connect("g_%d_%d_e" % (i, j), comps[(i, j)], 0, comps[(i + 1, j)], 1)
+            if j + 1 < y:
+                connect("g_%d_%d_n" % (i, j), comps[(i, j)], 2, comps[(i, j + 1)], 3)
+
+elif scenario == "fanout":
+    # roots=R leaves=L clock=FREQ: each root sends one event to each of
+    # its L leaves every clock tick
+    roots = opt("roots", 4) * scale
+    leaves = opt("leaves", 64)
+    clock = opt("clock", "1GHz")
+    for r in range(roots):
+        root = perf("f_%d" % r, {"num_ports" : leaves, "clock" : clock, "clock_sends" : 1})
+        for l in range(leaves):
+            leaf = perf("f_%d_%d" % (r, l), {"num_ports" : 1})
+            connect("f_%d_%d" % (r, l), root, l, leaf, 0)
+
+elif scenario == "polling":
+    # comps=N clock=FREQ jitter=PS: ring of components that send an
+    # event to both neighbors on every tick and drain their polling
+    # links.  Each event is delayed by up to jitter ps on top of the
+    # latency, so some arrive out of order.
+    n = opt("comps", 256) * scale
+    clock = opt("clock", "1GHz")
+    jitter = opt("jitter", 1000)
+    latency = opt("latency", "10ns")
+    comps = [perf("p_%d" % i, {"num_ports" : 2, "clock" : clock, "clock_sends" : 1, "poll" : 1,
+                               "send_jitter" : jitter})
+             for i in range(n)]
+    for i in range(n):
+        connect("p_%d" % i, comps[i], 0, comps[(i + 1) % n], 1)
+
+else:
+    print("Unknown benchmark scenario: %s" % scenario)
+    sys.exit(1)
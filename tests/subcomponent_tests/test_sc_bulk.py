@@ -0,0 +1,46 @@
+import array
+import sys
+import sst
+
+# Define SST core options
+sst.setProgramOption("stopAtCycle", "10us")
+
+# Set up senders and receivers in bulk, each loading a user subcomponent
+count = 4
+first_sender = sst.addComponents("Sender", "coreTestElement.SubComponentLoader", count, {"clock" : "1.5GHz"})
+first_receiver = sst.addComponents("Receiver", "coreTestElement.SubComponentLoader", count, {"clock" : "1.0GHz"})
+
+# Sender ids go to connectComponents() through the buffer protocol,
+# receiver ids as a list
+senders = array.array("L")
+receivers = []
+for i in range(count):
+    sub = sst.findComponentById(first_sender + i).setSubComponent("mySubComp", "coreTestElement.SubCompSender", 0)
+    sub.addParam("sendCount", 5 + i)
+    sub.enableAllStatistics()
+    senders.append(sub.getId())
+
+    sub = sst.findComponentById(first_receiver + i).setSubComponent("mySubComp", "coreTestElement.SubCompReceiver", 0)
+    sub.enableAllStatistics()
+    receivers.append(sub.getId())
+
+# Set up links
+sst.connectComponents("bulkLink", senders, "sendPort", receivers, "recvPort", "5ns")
+
+# Bad calls must be rejected before any link is added
+def check(what, call):
+    try:
+        call()
+        print("%s: accepted"%what)
+    except (TypeError, ValueError) as e:
+        print("%s: %s: %s"%(what, type(e).__name__, e))
+    sys.stdout.flush()
+
+check("unknown id", lambda: sst.connectComponents("bad", [first_sender + 2 * count], "sendPort", receivers[:1], "recvPort", "5ns"))
+check("length mismatch", lambda: sst.connectComponents("bad", senders, "sendPort", receivers[:2], "recvPort", "5ns"))
+check("negative id", lambda: sst.connectComponents("bad", array.array("q", [-1]), "sendPort", receivers[:1], "recvPort", "5ns"))
+check("float buffer", lambda: sst.connectComponents("bad", array.array("d", [1.0]), "sendPort", receivers[:1], "recvPort", "5ns"))
+check("port count", lambda: sst.connectComponents("bad", senders, ["sendPort"] * 3, receivers, "recvPort", "5ns"))
+check("no components", lambda: sst.addComponents("None", "coreTestElement.SubComponentLoader", 0))
+
+sst.setStatisticLoadLevel(1)
@@ -0,0 +1,29 @@
+import sst
+
+# Define SST core options
+sst.setProgramOption("stopAtCycle", "10us")
+
+# Set up sender using user subcomponent
+loader0 = sst.Component("Loader0", "coreTestElement.SubComponentLoader")
+loader0.addParam("clock", "1.5GHz")
+
+sub0 = loader0.setSubComponent("mySubComp", "coreTestElement.SubCompSender",0)
+sub0.addParam("sendCount", 15)
+sub0.enableAllStatistics()
+
+# This one is loaded in setup(), after all components are built
+setup0 = loader0.setSubComponent("setupSubComp", "coreTestElement.SubCompParamPrinter",0)
+setup0.addParam("message", "loaded in setup")
+
+# Set up receiver using user subcomponent
+loader1 = sst.Component("Loader1", "coreTestElement.SubComponentLoader")
+loader1.addParam("clock", "1.0GHz")
+
+sub1 = loader1.setSubComponent("mySubComp", "coreTestElement.SubCompReceiver",0)
+sub1.enableAllStatistics()
+
+# Set up link
+link0 = sst.Link("myLink0")
+link0.connect((sub0, "sendPort", "5ns"), (sub1, "recvPort", "5ns"))
+
+sst.setStatisticLoadLevel(1)
@@ -0,0 +1,12 @@
+# Check the interprocess CircularBuffer
+import sst
+
+# Define SST core options
+sst.setProgramOption("timebase", "1 ps")
+sst.setProgramOption("stopAtCycle", "1us")
+
+# Define the simulation components
+comp = sst.Component("ring", "coreTestElement.coreTestCircularBufferComponent")
+comp.addParams({
+      "count" : "100000"
+})
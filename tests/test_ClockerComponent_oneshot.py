@@ -0,0 +1,13 @@
+# Check that canceled OneShots are not called
+import sst
+
+# Define SST core options
+sst.setProgramOption("timebase", "1 ps")
+sst.setProgramOption("stopAtCycle", "10000s")
+
+# Define the simulation components
+comp_clocker0 = sst.Component("clocker0", "coreTestElement.coreTestClockerComponent")
+comp_clocker0.addParams({
+      "clockcount" : """300""",
+      "clock" : """1GHz"""
+})
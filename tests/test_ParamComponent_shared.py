@@ -0,0 +1,38 @@
+# Parameter sets shared between components, with per-component overrides
+import sst
+
+sst.setProgramOption("timebase", "1 ps")
+sst.setProgramOption("stopAtCycle", "25us")
+
+sst.addSharedParams("base", {
+	"int32t-param" : 2147483647,
+	"uint32t-param" : "4294967295",
+	"int64t-param" : 9223372036854775807,
+	"uint64t-param" : 18446744073709551615,
+	"bool-true-param" : True,
+	"bool-false-param" : False,
+	"float-param" : 1.0101,
+	"double-param" : 1.3333e-10,
+	"string-param" : "shared"
+})
+
+sst.addSharedParam("override", "int64t-param", -9223372036854775808)
+sst.addSharedParam("override", "string-param", "override")
+
+# Only the shared set
+param_c0 = sst.Component("c0.0", "coreTestElement.coreTestParamComponent")
+param_c0.addSharedParamSet("base")
+
+# Local values take precedence over the shared set
+param_c1 = sst.Component("c1.0", "coreTestElement.coreTestParamComponent")
+param_c1.addSharedParamSet("base")
+param_c1.addParams({
+	"int32t-param" : -2147483648,
+	"string-param" : "local"
+})
+
+# Sets subscribed earlier take precedence over later ones
+param_c2 = sst.Component("c2.0", "coreTestElement.coreTestParamComponent")
+param_c2.addSharedParamSet("override")
+param_c2.addSharedParamSet("base")
+param_c2.addParam("uint32t-param", 0)
@@ -0,0 +1,9 @@
+# Check the delivery order of events on a polling link
+import sst
+
+# Define SST core options
+sst.setProgramOption("timebase", "1 ps")
+sst.setProgramOption("stopAtCycle", "1ms")
+
+# Define the simulation components
+poll = sst.Component("poll", "coreTestElement.coreTestPollingLinkComponent")
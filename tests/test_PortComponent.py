@@ -0,0 +1,22 @@
+# Check port lookups on components that share a port name table
+import sst
+
+# Define SST core options
+sst.setProgramOption("timebase", "1 ps")
+sst.setProgramOption("stopAtCycle", "1ms")
+
+# Define the simulation components
+comps = []
+for i in range(4):
+    comps.append(sst.Component("p{0}".format(i), "coreTestElement.coreTestPortComponent"))
+
+# Each instance has a different set of connected ports
+def connect(name, a, aport, b, bport):
+    link = sst.Link(name)
+    link.connect( (comps[a], "port{0}".format(aport), "1ns"), (comps[b], "port{0}".format(bport), "1ns") )
+
+connect("l0", 0, 0, 1, 3)
+connect("l1", 0, 2, 2, 2)
+connect("l2", 1, 0, 3, 7)
+connect("l3", 2, 5, 3, 1)
+connect("l4", 2, 6, 2, 4)
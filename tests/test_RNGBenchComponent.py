@@ -0,0 +1,30 @@
+# Benchmark the bulk random number interface against single calls
+import sst
+import sys
+
+# Optional arguments: generator, distribution, count, timing, batch
+rng = "mersenne"
+distrib = "none"
+count = "1000000"
+timing = "1"
+batch = "1024"
+if len(sys.argv) > 1: rng = sys.argv[1]
+if len(sys.argv) > 2: distrib = sys.argv[2]
+if len(sys.argv) > 3: count = sys.argv[3]
+if len(sys.argv) > 4: timing = sys.argv[4]
+if len(sys.argv) > 5: batch = sys.argv[5]
+
+# Define SST core options
+sst.setProgramOption("timebase", "1 ps")
+sst.setProgramOption("stopAtCycle", "10000s")
+
+# Define the simulation components
+comp_bench = sst.Component("bench", "coreTestElement.coreTestRNGBenchComponent")
+comp_bench.addParams({
+      "rng" : rng,
+      "distrib" : distrib,
+      "count" : count,
+      "timing" : timing,
+      "batch" : batch,
+      "seed" : "1447"
+})
@@ -272,3 +272,9 @@ print("'%s'.hasUnits(\"ns\") = %r"%(ua1,ua1.hasUnits("ns")))
 print("'%s'.hasUnits(\"s\") = %r"%(ua1,ua1.hasUnits("s")))
 print("'%s'.hasUnits(\"Hz\") = %r"%(ua1,ua1.hasUnits("Hz")))
 
+
+print("")
+print("SI prefixes in the denominator:")
+for s in ("64B/ns", "8b/us", "1/ms"):
+    print("'%s' = %s"%(s,UnitAlgebra(s)))
+print("'64B/ns' == '64GB/s' = %r"%(UnitAlgebra("64B/ns") == UnitAlgebra("64GB/s")))
@@ -0,0 +1,20 @@
+# Benchmark the UnitAlgebra operations used on component hot paths
+import sst
+import sys
+
+# Optional arguments: count, timing
+count = "100000"
+timing = "1"
+if len(sys.argv) > 1: count = sys.argv[1]
+if len(sys.argv) > 2: timing = sys.argv[2]
+
+# Define SST core options
+sst.setProgramOption("timebase", "1 ps")
+sst.setProgramOption("stopAtCycle", "10000s")
+
+# Define the simulation components
+comp_bench = sst.Component("bench", "coreTestElement.coreTestUnitAlgebraBenchComponent")
+comp_bench.addParams({
+      "count" : count,
+      "timing" : timing
+})
@@ -3,6 +3,8 @@
 from sst_unittest import *
 from sst_unittest_support import *
 
+import re
+
 ################################################################################
 # Code to support a single instance module initialize, must be called setUp method
 
@@ -19,6 +21,35 @@ def initializeTestModule_SingleInstance(class_inst):
         module_init = 1
     module_sema.release()
 
+def parse_profile_report(filename):
+    """ Parse an --output-profile report.  Returns the summary lines as
+        label -> list of numbers, and each table as title -> list of rows,
+        where each row maps the column headers to their values.
+    """
+    summary = {}
+    tables = {}
+    rows = None
+    columns = None
+    with open(filename) as f:
+        for line in f:
+            line = line.strip()
+            if not line or line.startswith("---"):
+                rows = None
+                continue
+            table = re.match(r"^(.*) \(\d+ of \d+, by time\):$", line)
+            if table:
+                rows = tables.setdefault(table.group(1), [])
+                columns = None
+            elif rows is not None and columns is None:
+                columns = re.split(r"\s{2,}", line)
+            elif rows is not None:
+                values = line.split(None, len(columns) - 1)
+                rows.append(dict(zip(columns, values)))
+            elif ":" in line:
+                label, value = line.split(":", 1)
+                summary[label.strip()] = re.findall(r"[0-9.]+", value)
+    return summary, tables
+
 ################################################################################
 
 class testcase_Component(SSTTestCase):
@@ -42,6 +73,204 @@ class testcase_Component(SSTTestCase):
     def test_Component(self):
         self.component_test_template("component")
 
+    def test_Component_ports(self):
+        testsuitedir = self.get_testsuite_dir()
+        outdir = test_output_get_run_dir()
+
+        sdlfile = "{0}/test_PortComponent.py".format(testsuitedir)
+        reffile = "{0}/refFiles/test_PortComponent.out".format(testsuitedir)
+
+        # Port tables are per thread, so check a threaded run as well
+        for threads in (1, 2):
+            outfile = "{0}/test_PortComponent_{1}.out".format(outdir, threads)
+            self.run_sst(sdlfile, outfile, num_threads=threads)
+            cmp_result = testing_compare_sorted_diff("ports", outfile, reffile)
+            self.assertTrue(cmp_result, "Output/Compare file {0} does not match Reference File {1}".format(outfile, reffile))
+
+    def test_Component_polling_link(self):
+        testsuitedir = self.get_testsuite_dir()
+        outdir = test_output_get_run_dir()
+
+        sdlfile = "{0}/test_PollingLinkComponent.py".format(testsuitedir)
+        reffile = "{0}/refFiles/test_PollingLinkComponent.out".format(testsuitedir)
+        outfile = "{0}/test_PollingLinkComponent.out".format(outdir)
+
+        self.run_sst(sdlfile, outfile)
+
+        # Delivery order matters here, so compare without sorting
+        def received(filename):
+            with open(filename) as f:
+                return [l.strip() for l in f if " tick " in l]
+        self.assertEqual(received(outfile), received(reffile),
+                         "Output/Compare file {0} does not match Reference File {1}".format(outfile, reffile))
+
+    def test_Component_oneshot_cancel(self):
+        testsuitedir = self.get_testsuite_dir()
+        outdir = test_output_get_run_dir()
+
+        sdlfile = "{0}/test_ClockerComponent_oneshot.py".format(testsuitedir)
+        outfile = "{0}/test_ClockerComponent_oneshot.out".format(outdir)
+
+        self.run_sst(sdlfile, outfile)
+
+        # OneShots are registered on two ticks of clock #3; of the
+        # cancelable ones, one is canceled a tick later and one at once
+        with open(outfile) as f:
+            lines = f.read().splitlines()
+        self.assertEqual(sum("ONESHOT #1 CALLBACK" in l for l in lines), 2, "Expected 2 calls of OneShot #1 in {0}".format(outfile))
+        self.assertEqual(sum("ONESHOT #2 CALLBACK" in l for l in lines), 2, "Expected 2 calls of OneShot #2 in {0}".format(outfile))
+        self.assertFalse(any("ONESHOT #3" in l for l in lines), "A canceled OneShot was called in {0}".format(outfile))
+        self.assertFalse(any("FAILED TO CANCEL" in l for l in lines), "Failed to cancel a OneShot in {0}".format(outfile))
+        self.assertFalse(any("CANCELED ONESHOT TWICE" in l for l in lines), "Canceled a OneShot twice in {0}".format(outfile))
+
+    def test_Component_circular_buffer(self):
+        testsuitedir = self.get_testsuite_dir()
+        outdir = test_output_get_run_dir()
+
+        sdlfile = "{0}/test_CircularBufferComponent.py".format(testsuitedir)
+        outfile = "{0}/test_CircularBufferComponent.out".format(outdir)
+
+        self.run_sst(sdlfile, outfile)
+
+        # Each check reports ok or WRONG
+        with open(outfile) as f:
+            lines = [l.strip() for l in f if l.strip().endswith(": ok") or l.strip().endswith(": WRONG")]
+        self.assertEqual(len(lines), 3, "Missing CircularBuffer results in {0}".format(outfile))
+        for l in lines:
+            self.assertTrue(l.endswith("ok"), "Wrong CircularBuffer result: {0}".format(l))
+
+    def test_Component_profile(self):
+        testsuitedir = self.get_testsuite_dir()
+        outdir = test_output_get_run_dir()
+
+        sdlfile = "{0}/test_Component.py".format(testsuitedir)
+        outfile = "{0}/test_Component_profile.out".format(outdir)
+        proffile = "{0}/test_Component_profile.prof".format(outdir)
+
+        self.run_sst(sdlfile, outfile, other_args="--output-profile={0}".format(proffile))
+
+        summary, tables = parse_profile_report(proffile)
+        self.assertTrue("Run loop time" in summary, "Missing profile report in {0}".format(proffile))
+
+        # Every component's handlers should have been charged, and the
+        # component calls must add up to the handler totals
+        components = [row for row in tables.get("Components", []) if row["Name"].startswith("c")]
+        self.assertEqual(len(components), 100, "Expected 100 profiled components in {0}".format(proffile))
+        for row in components:
+            self.assertTrue(int(row["Calls"]) > 0, "No calls charged to {0}".format(row["Name"]))
+        handler_calls = int(summary["Event handlers"][1]) + int(summary["Clock handlers"][1])
+        self.assertEqual(sum(int(row["Calls"]) for row in components), handler_calls,
+                         "Component calls do not match handler calls in {0}".format(proffile))
+
+    def test_Component_partition_weights(self):
+        testsuitedir = self.get_testsuite_dir()
+        outdir = test_output_get_run_dir()
+
+        sdlfile = "{0}/test_Component.py".format(testsuitedir)
+        reffile = "{0}/refFiles/test_Component.out".format(testsuitedir)
+        outfile = "{0}/test_Component_weights.out".format(outdir)
+        rerunfile = "{0}/test_Component_weights_rerun.out".format(outdir)
+        weightsfile = "{0}/test_Component_weights.txt".format(outdir)
+
+        self.run_sst(sdlfile, outfile, other_args="--output-partition-weights={0}".format(weightsfile))
+
+        # Every link carries traffic in this model, but links that stay on
+        # one rank are never serialized, so have no byte count
+        with open(weightsfile) as f:
+            links = [l.split() for l in f if l.startswith("link ")]
+        self.assertEqual(len(links), 200, "Expected 200 links in {0}".format(weightsfile))
+        for l in links:
+            self.assertEqual(len(l), 5, "Malformed link record {0}".format(" ".join(l)))
+            self.assertTrue(int(l[2]) > 0, "No traffic recorded for {0}".format(l[1]))
+            self.assertEqual(int(l[3]), 0, "Bytes recorded for local link {0}".format(l[1]))
+        with open(weightsfile) as f:
+            comps = [l.split() for l in f if l.startswith("component ")]
+        self.assertEqual(len(comps), 100, "Expected 100 component costs in {0}".format(weightsfile))
+
+        # Feeding the weights back must not change the results
+        self.run_sst(sdlfile, rerunfile, other_args="--partition-weights={0}".format(weightsfile))
+        cmp_result = testing_compare_sorted_diff("component_weights", rerunfile, reffile)
+        self.assertTrue(cmp_result, "Output/Compare file {0} does not match Reference File {1}".format(rerunfile, reffile))
+
+    @unittest.skipIf(not sst_config_include_file_get_value_int("SST_CONFIG_HAVE_MPI", 0), "Requires MPI")
+    def test_Component_partition_weights_ranks(self):
+        testsuitedir = self.get_testsuite_dir()
+        outdir = test_output_get_run_dir()
+
+        sdlfile = "{0}/test_Component.py".format(testsuitedir)
+        outfile = "{0}/test_Component_weights_ranks.out".format(outdir)
+        weightsfile = "{0}/test_Component_weights_ranks.txt".format(outdir)
+
+        self.run_sst(sdlfile, outfile, num_ranks=2, other_args="--output-partition-weights={0}".format(weightsfile))
+
+        # Counts from both ranks are combined, and only the links that
+        # cross ranks are sized
+        with open(weightsfile) as f:
+            links = [l.split() for l in f if l.startswith("link ")]
+        self.assertEqual(len(links), 200, "Expected 200 links in {0}".format(weightsfile))
+        self.assertTrue(any(l[4] == "rank" for l in links), "No links crossed ranks in {0}".format(weightsfile))
+        for l in links:
+            self.assertTrue(int(l[2]) > 0, "No traffic recorded for {0}".format(l[1]))
+            if l[4] == "rank":
+                self.assertTrue(int(l[3]) > 0, "No bytes recorded for {0}".format(l[1]))
+            else:
+                self.assertEqual(int(l[3]), 0, "Bytes recorded for local link {0}".format(l[1]))
+
+    @unittest.skipIf(not sst_config_include_file_get_value_int("SST_CONFIG_HAVE_MPI", 0), "Requires MPI")
+    def test_Component_rank_sync(self):
+        testsuitedir = self.get_testsuite_dir()
+        outdir = test_output_get_run_dir()
+
+        sdlfile = "{0}/test_Component.py".format(testsuitedir)
+        reffile = "{0}/refFiles/test_Component.out".format(testsuitedir)
+
+        # Each multi-threaded rank sync should give the same results
+        for sync in ("parallel", "segmented"):
+            outfile = "{0}/test_Component_{1}.out".format(outdir, sync)
+            self.run_sst(sdlfile, outfile, num_ranks=2, num_threads=2,
+                         other_args="--rank-sync={0}".format(sync))
+
+            cmp_result = testing_compare_sorted_diff("component_{0}".format(sync), outfile, reffile)
+            self.assertTrue(cmp_result, "Output/Compare file {0} does not match Reference File {1}".format(outfile, reffile))
+
+    def test_Component_weighted_linear_partition(self):
+        testsuitedir = self.get_testsuite_dir()
+        outdir = test_output_get_run_dir()
+
+        sdlfile = "{0}/test_Component.py".format(testsuitedir)
+        outfile = "{0}/test_Component_weighted.out".format(outdir)
+        weightsfile = "{0}/test_Component_weighted.txt".format(outdir)
+        partfile = "{0}/test_Component_weighted.part".format(outdir)
+
+        # c0.0 costs as much as half of the other components together
+        with open(weightsfile, "w") as f:
+            f.write("component c0.0 50.0 1\n")
+            for x in range(10):
+                for y in range(10):
+                    if x or y:
+                        f.write("component c{0}.{1} 1.0 1\n".format(x, y))
+
+        self.run_sst(sdlfile, outfile, num_threads=2,
+                     other_args="--partition-weights={0} --output-partition={1}".format(weightsfile, partfile))
+
+        # The part holding c0.0 should get fewer components than the rest
+        parts = {}
+        owner = None
+        current = None
+        with open(partfile) as f:
+            for l in f:
+                if l.startswith("Rank:"):
+                    current = l.split()[1]
+                    parts[current] = 0
+                elif "(ID=" in l:
+                    parts[current] += 1
+                    if l.split()[0] == "c0.0":
+                        owner = current
+        self.assertTrue(owner is not None, "c0.0 not found in {0}".format(partfile))
+        for part, count in parts.items():
+            if part != owner:
+                self.assertTrue(parts[owner] < count, "Weighted partition did not balance: {0}".format(parts))
+
 #####
 
     def component_test_template(self, testtype):
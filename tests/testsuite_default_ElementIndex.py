@@ -0,0 +1,87 @@
+# -*- coding: utf-8 -*-
+
+import os
+
+from sst_unittest import *
+from sst_unittest_support import *
+
+################################################################################
+# Code to support a single instance module initialize, must be called setUp method
+
+module_init = 0
+module_sema = threading.Semaphore()
+
+def initializeTestModule_SingleInstance(class_inst):
+    global module_init
+    global module_sema
+
+    module_sema.acquire()
+    if module_init != 1:
+        # Put your single instance Init Code Here
+        module_init = 1
+    module_sema.release()
+
+################################################################################
+
+class testcase_ElementIndex(SSTTestCase):
+
+    def initializeClass(self, testName):
+        super(type(self), self).initializeClass(testName)
+        # Put test based setup code here. it is called before testing starts
+        # NOTE: This method is called once for every test
+
+    def setUp(self):
+        super(type(self), self).setUp()
+        initializeTestModule_SingleInstance(self)
+        # Put test based setup code here. it is called once before every test
+
+    def tearDown(self):
+        # Put test based teardown code here. it is called once after every test
+        super(type(self), self).tearDown()
+
+#####
+
+    # sst-info --write-index writes an index of the element libraries into
+    # each library directory, and sst then finds its libraries through the
+    # index
+    def test_ElementIndex(self):
+        testsuitedir = self.get_testsuite_dir()
+        outdir = test_output_get_run_dir()
+
+        libdir = sstsimulator_conf_get_value_str("SSTCore", "CORE_TEST_ELEMENT_LIBDIR", "")
+        if not os.access(libdir, os.W_OK):
+            self.skipTest("Library directory '{0}' is not writable".format(libdir))
+
+        # Without the option, sst-info leaves the directory alone
+        indexfile = "{0}/sst-element-index".format(libdir)
+        if os.path.isfile(indexfile):
+            os.remove(indexfile)
+        cmd = "sst-info -q -n"
+        rtn, output = os_simple_command(cmd)
+        self.assertEqual(rtn, 0, "'{0}' failed".format(cmd))
+        self.assertFalse(os.path.isfile(indexfile), "'{0}' wrote {1}".format(cmd, indexfile))
+
+        outfile = "{0}/test_ElementIndex_sstinfo.out".format(outdir)
+        cmd = "sst-info -q -i"
+        rtn, output = os_simple_command(cmd)
+        with open(outfile, "w") as f:
+            f.write(output)
+        self.assertEqual(rtn, 0, "'{0}' failed; see {1}".format(cmd, outfile))
+        self.assertTrue("ELEMENT 0 = coreTestElement" in output,
+                        "sst-info did not find coreTestElement; see {0}".format(outfile))
+
+        self.assertTrue(os.path.isfile(indexfile), "sst-info did not write {0}".format(indexfile))
+        with open(indexfile) as f:
+            entries = [l.split()[:2] for l in f if not l.startswith("#")]
+        self.assertTrue(["coreTestElement", "libcoreTestElement"] in entries,
+                        "coreTestElement missing from {0}".format(indexfile))
+
+        # Run a simulation with the library found through the index
+        sdlfile = "{0}/test_Component.py".format(testsuitedir)
+        reffile = "{0}/refFiles/test_Component.out".format(testsuitedir)
+        outfile = "{0}/test_ElementIndex_Component.out".format(outdir)
+
+        self.run_sst(sdlfile, outfile)
+
+        cmp_result = testing_compare_sorted_diff("ElementIndex", outfile, reffile)
+        self.assertTrue(cmp_result, "Output/Compare file {0} does not match Reference File {1}".format(outfile, reffile))
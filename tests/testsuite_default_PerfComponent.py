@@ -0,0 +1,121 @@
+# -*- coding: utf-8 -*-
+
+import os
+import re
+
+from sst_unittest import *
+from sst_unittest_support import *
+
+################################################################################
+# Code to support a single instance module initialize, must be called setUp method
+
+module_init = 0
+module_sema = threading.Semaphore()
+
+def initializeTestModule_SingleInstance(class_inst):
+    global module_init
+    global module_sema
+
+    module_sema.acquire()
+    if module_init != 1:
+        # Put your single instance Init Code Here
+        module_init = 1
+    module_sema.release()
+
+################################################################################
+
+class testcase_PerfComponent(SSTTestCase):
+
+    def initializeClass(self, testName):
+        super(type(self), self).initializeClass(testName)
+        # Put test based setup code here. it is called before testing starts
+        # NOTE: This method is called once for every test
+
+    def setUp(self):
+        super(type(self), self).setUp()
+        initializeTestModule_SingleInstance(self)
+        # Put test based setup code here. it is called once before every test
+
+    def tearDown(self):
+        # Put test based teardown code here. it is called once after every test
+        super(type(self), self).tearDown()
+
+#####
+
+    def test_Perf_pingpong(self):
+        self.perf_test_template("pingpong", 128, 4093952, 0)
+
+    def test_Perf_torus(self):
+        self.perf_test_template("torus", 256, 2046976, 0)
+
+    def test_Perf_torus_bulk(self):
+        self.perf_test_template("torus", 256, 2046976, 0, "bulk=1")
+
+    def test_Perf_clockgrid(self):
+        self.perf_test_template("clockgrid", 1024, 0, 2046976)
+
+    def test_Perf_fanout(self):
+        self.perf_test_template("fanout", 260, 511488, 7996)
+
+    def test_Perf_polling(self):
+        self.perf_test_template("polling", 256, 1017856, 511744)
+
+    # The native synthetic graph generator used to measure start-up
+    def test_Perf_synthetic_model(self):
+        outdir = test_output_get_run_dir()
+        outfile = "{0}/test_Perf_synthetic_model.out".format(outdir)
+
+        cmd = "sst --print-timing-info --synthetic-model=components=500,degree=4,depth=2,events=2,stop=2us"
+        rtn, output = os_simple_command(cmd)
+        with open(outfile, "w") as f:
+            f.write(output)
+        self.assertEqual(rtn, 0, "'{0}' failed; see {1}".format(cmd, outfile))
+
+        self.check_counts(outfile, [500, 1999000, 0])
+
+        # Every start-up phase is reported
+        for phase in ["Graph generation", "Partition", "Graph broadcast", "Load libraries", "Wire-up", "Initialize", "Setup"]:
+            self.assertTrue(re.search(r"^\s+{0}\s+[0-9.]+\s".format(phase), output, re.MULTILINE),
+                            "Missing start-up phase '{0}' in {1}".format(phase, outfile))
+
+        # The memory report breaks the allocations down by subsystem and
+        # by component type
+        if "Allocation accounting is not enabled" not in output:
+            for tag in ["Other", "ConfigGraph", "Components", "Links", "TimeVortex", "Statistics"]:
+                self.assertTrue(re.search(r"^\s+{0}(\s+-?[0-9.]+ \w*B){{4}}$".format(tag), output, re.MULTILINE),
+                                "Missing memory for '{0}' in {1}".format(tag, outfile))
+            self.assertTrue(re.search(r"\s500 components, .* coreTestElement\.", output),
+                            "Missing component type memory in {0}".format(outfile))
+
+        # The graph is released after wire-up
+        self.assertTrue(re.search(r"^Graph release reclaimed RSS:\s+[0-9.]+ \w*B$", output, re.MULTILINE),
+                        "Missing reclaimed RSS in {0}".format(outfile))
+
+#####
+
+    # Runs a short version of each core benchmark (see sst-bench-core) to
+    # make sure they keep working.  The counts do not depend on the
+    # number of ranks or threads.
+    def perf_test_template(self, benchmark, components, events, ticks, options=""):
+        testsuitedir = self.get_testsuite_dir()
+        outdir = test_output_get_run_dir()
+
+        sdlfile = "{0}/benchmarks/bench_core.py".format(testsuitedir)
+        label = "_".join([benchmark] + options.replace("=", "").split())
+        outfile = "{0}/test_Perf_{1}.out".format(outdir, label)
+
+        self.run_sst(sdlfile, outfile, other_args="--model-options=\"{0} {1} stop=2us\"".format(benchmark, options))
+
+        self.check_counts(outfile, [components, events, ticks])
+
+    def check_counts(self, outfile, expected):
+        found = [0, 0, 0]
+        with open(outfile) as f:
+            for l in f:
+                m = re.search(r"received (\d+) events, sent \d+ events, (\d+) clock ticks", l)
+                if m:
+                    found[0] += 1
+                    found[1] += int(m.group(1))
+                    found[2] += int(m.group(2))
+        self.assertEqual(found, expected,
+                         "Unexpected [components, events, ticks] in {0}".format(outfile))
@@ -51,8 +51,60 @@ class testcase_RNGComponent(SSTTestCase):
     def test_RNG_xorshift(self):
         self.RNG_test_template("xorshift")
 
+    def test_RNG_philox(self):
+        self.RNG_test_template("philox")
+
+    def test_RNG_bulk_Mersenne(self):
+        self.RNG_bulk_test_template("mersenne")
+
+    def test_RNG_bulk_Marsaglia(self):
+        self.RNG_bulk_test_template("marsaglia")
+
+    def test_RNG_bulk_xorshift(self):
+        self.RNG_bulk_test_template("xorshift")
+
+    def test_RNG_bulk_philox(self):
+        self.RNG_bulk_test_template("philox")
+
+    def test_RNG_bulk_gaussian(self):
+        self.RNG_bulk_test_template("mersenne", "gaussian")
+
+    def test_RNG_bulk_exponential(self):
+        self.RNG_bulk_test_template("xorshift", "exponential")
+
+    def test_RNG_bulk_poisson(self):
+        self.RNG_bulk_test_template("marsaglia", "poisson")
+
 #####
 
+    def RNG_bulk_test_template(self, testtype, distrib = "none"):
+        testsuitedir = self.get_testsuite_dir()
+        outdir = test_output_get_run_dir()
+
+        sdlfile = "{0}/test_RNGBenchComponent.py".format(testsuitedir)
+        outfile = "{0}/test_RNGBenchComponent_{1}_{2}.out".format(outdir, testtype, distrib)
+
+        # An odd batch size ends every other Gaussian bulk fill on half a
+        # pair, which the next fill has to return first
+        self.run_sst(sdlfile, outfile, other_args="--model-options=\"{0} {1} 100000 0 1023\"".format(testtype, distrib))
+
+        # Bulk fills must return exactly what the single calls return and
+        # leave the generator in the same state
+        with open(outfile) as f:
+            lines = [l for l in f if "bulk matches single" in l]
+        expected = 3 if distrib == "none" else 2
+        self.assertEqual(len(lines), expected, "Missing bulk comparison in {0}".format(outfile))
+        for l in lines:
+            self.assertTrue(l.strip().endswith("yes"), "Bulk/single mismatch: {0}".format(l.strip()))
+
+        # Jumping through the Philox stream must agree with drawing from it
+        if testtype == "philox" and distrib == "none":
+            with open(outfile) as f:
+                lines = [l for l in f if "skipAhead matches sequential" in l or "setPosition replays stream" in l]
+            self.assertEqual(len(lines), 2, "Missing Philox position checks in {0}".format(outfile))
+            for l in lines:
+                self.assertTrue(l.strip().endswith("yes"), "Philox position mismatch: {0}".format(l.strip()))
+
     def RNG_test_template(self, testtype):
         testsuitedir = self.get_testsuite_dir()
         outdir = test_output_get_run_dir()
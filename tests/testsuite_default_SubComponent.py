@@ -91,6 +91,18 @@ class testcase_SubComponent(SSTTestCase):
     def test_SubComponent_sc_uu(self):
         self.subcomponent_test_template("sc_uu")
 
+    # Loads a user subcomponent in setup(), after the graph may have
+    # been released
+    @unittest.skipIf(testing_check_get_num_ranks() > 2, rankerr)
+    def test_SubComponent_sc_setup(self):
+        self.subcomponent_test_template("sc_setup")
+
+    # Builds user subcomponents from bulk created components, links them
+    # by id and checks that bad ids are rejected
+    @unittest.skipIf(testing_check_get_num_ranks() > 2, rankerr)
+    def test_SubComponent_sc_bulk(self):
+        self.subcomponent_test_template("sc_bulk")
+
 #####
 
     def subcomponent_test_template(self, testtype):
@@ -42,6 +42,22 @@ class testcase_UnitAlgebra(SSTTestCase):
     def test_UnitAlgebra(self):
         self.unitalgebra_test_template("UnitAlgebra")
 
+    def test_UnitAlgebraBench(self):
+        testsuitedir = self.get_testsuite_dir()
+        outdir = test_output_get_run_dir()
+
+        sdlfile = "{0}/test_UnitAlgebraBench.py".format(testsuitedir)
+        outfile = "{0}/test_UnitAlgebraBench.out".format(outdir)
+
+        self.run_sst(sdlfile, outfile, other_args="--model-options=\"1000 0\"")
+
+        # Every result computed in C++ must match the expected value
+        with open(outfile) as f:
+            lines = [l for l in f if l.strip().endswith(": ok") or l.strip().endswith(": WRONG")]
+        self.assertEqual(len(lines), 10, "Missing UnitAlgebra results in {0}".format(outfile))
+        for l in lines:
+            self.assertTrue(l.strip().endswith("ok"), "Wrong UnitAlgebra result: {0}".format(l.strip()))
+
 #####
 
     def unitalgebra_test_template(self, testtype):